@@ -10,11 +10,7 @@ namespace Library
 
 	const Vector<Signature> Action::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{"Name"s, Datum::DatumTypes::String, true, 1, offsetof(Action, mName)},
-			{ "RunOnce"s, Datum::DatumTypes::Integer, true, 1, offsetof(Action, mRunOnce) },
-		};
+		return AttributeReflection::Signatures<Action>();
 	}
 
 	Action::Action(RTTI::IdType typeId) : Attributed(typeId) {}
@@ -44,7 +40,7 @@ namespace Library
 		if (mParent != nullptr && (ret == nullptr || *ret != value))
 		{
 			Scope* scopeAction;
-			Datum* actions = mParent->Find("Actions");
+			const Datum* actions = std::as_const(*mParent).Find("Actions");
 
 			if (actions != nullptr)
 			{
@@ -70,13 +66,13 @@ namespace Library
 		return ret;
 	}
 
-	Datum* Action::Search(const std::string& name, WorldState& worldState)
+	const Datum* Action::Search(std::string_view name, WorldState& worldState) const
 	{
-		Datum* retDatum = nullptr;
+		const Datum* retDatum = nullptr;
 
 		if (!worldState.GetArgumentStack().IsEmpty())
 		{
-			Scope& argumentScope = worldState.GetArgumentStack().Peek();
+			const Scope& argumentScope = worldState.GetArgumentStack().Peek();
 			retDatum = argumentScope.Find(name);
 		}
 		
@@ -88,6 +84,13 @@ namespace Library
 		return retDatum;
 	}
 
+	void Action::Reset()
+	{
+		ResetAttributes();
+		mName.clear();
+		mRunOnce = 0;
+	}
+
 	const std::string& Action::Name() const
 	{
 		return mName;
@@ -96,6 +99,7 @@ namespace Library
 	void Action::SetName(const std::string& name)
 	{
 		mName = name;
+		MarkModified("Name");
 	}
 
 	std::string Action::ToString() const
@@ -1,5 +1,6 @@
 #pragma once
 #include "Attributed.h"
+#include "AttributeReflection.h"
 #include "WorldState.h"
 
 namespace Library
@@ -14,6 +15,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Name", Action, mName),
+				PRESCRIBED_ATTRIBUTE("RunOnce", Action, mRunOnce)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor.
@@ -62,8 +75,8 @@ namespace Library
 		/// </summary>
 		/// <param name="name">The name of the Datum being searched for</param>
 		/// <param name="worldState">The current WorldState that holds the ArgumentStack</param>
-		/// <returns></returns>
-		Datum* Search(const std::string& name, WorldState& worldState);
+		/// <returns>A read only pointer to the Datum found or nullptr otherwise</returns>
+		const Datum* Search(std::string_view name, WorldState& worldState) const;
 
 		/// <summary>
 		/// Returns a reference to the name of the Action.
@@ -82,6 +95,12 @@ namespace Library
 		/// <param name="state">A reference to the current WorldState that this Action exists within</param>
 		virtual void Update(WorldState & state) = 0;
 
+		/// <summary>
+		/// Returns the Action to the state of a default constructed one, so that a RecyclingPool can hand it out again without populating a new Action.
+		/// Derived classes reset their own prescribed attributes and then call this method
+		/// </summary>
+		virtual void Reset();
+
 		/// <summary>
 		/// Creates and returns a clone of this Action.
 		/// </summary>
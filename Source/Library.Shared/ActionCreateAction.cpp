@@ -8,11 +8,7 @@ namespace Library
 
 	const Vector<Signature> ActionCreateAction::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "ActionName"s, Datum::DatumTypes::String, true, 1, offsetof(ActionCreateAction, mActionName) },
-			{ "Prototype"s, Datum::DatumTypes::String, true, 1, offsetof(ActionCreateAction, mPrototype) }
-		};
+		return AttributeReflection::Signatures<ActionCreateAction>();
 	}
 
 	ActionCreateAction::ActionCreateAction() : Action(TypeIdClass()) {}
@@ -39,6 +35,13 @@ namespace Library
 		state.World->MarkScopeForDelete(*this);
 	}
 
+	void ActionCreateAction::Reset()
+	{
+		mActionName.clear();
+		mPrototype.clear();
+		Action::Reset();
+	}
+
 	gsl::owner<Scope*> ActionCreateAction::Clone() const
 	{
 		return new ActionCreateAction(*this);
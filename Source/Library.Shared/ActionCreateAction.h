@@ -24,6 +24,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("ActionName", ActionCreateAction, mActionName),
+				PRESCRIBED_ATTRIBUTE("Prototype", ActionCreateAction, mPrototype)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor
@@ -67,6 +79,11 @@ namespace Library
 		/// <param name="state">The curent state of the world</param>
 		void Update(WorldState & state) override;
 
+		/// <summary>
+		/// Clears the prescribed attributes of this ActionCreateAction along with those of Action.
+		/// </summary>
+		void Reset() override;
+
 		/// <summary>
 		/// Creates and returns a clone of this ActionCreateAction.
 		/// </summary>
@@ -99,6 +116,6 @@ namespace Library
 		std::string mPrototype;
 	};
 
-	ConcreteFactory(ActionCreateAction, Scope)
+	RecyclingConcreteFactory(ActionCreateAction, Scope)
 }
 
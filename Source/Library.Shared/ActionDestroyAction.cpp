@@ -9,10 +9,7 @@ namespace Library
 
 	const Vector<Signature> ActionDestroyAction::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Action"s, Datum::DatumTypes::String, true, 1, offsetof(ActionDestroyAction, mAction) }
-		};
+		return AttributeReflection::Signatures<ActionDestroyAction>();
 	}
 
 	ActionDestroyAction::ActionDestroyAction() : Action(TypeIdClass()) {}
@@ -31,6 +28,12 @@ namespace Library
 		state.World->MarkScopeForDelete(*this);
 	}
 
+	void ActionDestroyAction::Reset()
+	{
+		mAction.clear();
+		Action::Reset();
+	}
+
 	gsl::owner<Scope*> ActionDestroyAction::Clone() const
 	{
 		return new ActionDestroyAction(*this);
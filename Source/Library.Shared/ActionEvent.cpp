@@ -13,11 +13,7 @@ namespace Library
 
 	const Vector<Signature> ActionEvent::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Subtype"s, Datum::DatumTypes::String, true, 1, offsetof(ActionEvent, mSubtype) },
-			{ "Delay"s, Datum::DatumTypes::Integer, true, 1, offsetof(ActionEvent, mDelay) }
-		};
+		return AttributeReflection::Signatures<ActionEvent>();
 	}
 
 	ActionEvent::ActionEvent() : Action(TypeIdClass()) {}
@@ -43,6 +39,13 @@ namespace Library
 		}
 	}
 
+	void ActionEvent::Reset()
+	{
+		mSubtype.clear();
+		mDelay = 0;
+		Action::Reset();
+	}
+
 	gsl::owner<Scope*> ActionEvent::Clone() const
 	{
 		return new ActionEvent(*this);
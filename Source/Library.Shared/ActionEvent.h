@@ -19,6 +19,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Subtype", ActionEvent, mSubtype),
+				PRESCRIBED_ATTRIBUTE("Delay", ActionEvent, mDelay)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor.
@@ -64,6 +76,11 @@ namespace Library
 		/// <param name="state">The current state of the world</param>
 		void Update(WorldState& state) override;
 
+		/// <summary>
+		/// Clears the prescribed attributes of this ActionEvent along with those of Action.
+		/// </summary>
+		void Reset() override;
+
 		/// <summary>
 		/// Creates and returns a clone of this ActionEvent.
 		/// </summary>
@@ -82,6 +99,6 @@ namespace Library
 		int mDelay = 0;
 	};
 
-	ConcreteFactory(ActionEvent, Scope);
+	RecyclingConcreteFactory(ActionEvent, Scope);
 }
 
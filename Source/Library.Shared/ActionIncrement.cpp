@@ -8,11 +8,7 @@ namespace Library
 
 	const Vector<Signature> ActionIncrement::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Target"s, Datum::DatumTypes::String, true, 1, offsetof(ActionIncrement, mTarget) },
-			{ "Step"s, Datum::DatumTypes::Integer, true, 1, offsetof(ActionIncrement, mStep) }
-		};
+		return AttributeReflection::Signatures<ActionIncrement>();
 	}
 
 	ActionIncrement::ActionIncrement() : Action(TypeIdClass()) {}
@@ -24,12 +20,19 @@ namespace Library
 		Datum* target = World::FindRelativeDatum(*this, Search("Target", state)->GetString()); 
 		if (target != nullptr)
 		{
-			target->GetInt() += Search("Step", state)->GetInt();
+			target->Edit<int>() += Search("Step", state)->GetInt();
 		}
 
 		Action::Update(state);
 	}
 
+	void ActionIncrement::Reset()
+	{
+		mTarget.clear();
+		mStep = 1;
+		Action::Reset();
+	}
+
 	gsl::owner<Scope*> ActionIncrement::Clone() const
 	{
 		return new ActionIncrement(*this);
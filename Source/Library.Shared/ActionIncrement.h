@@ -15,6 +15,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Target", ActionIncrement, mTarget),
+				PRESCRIBED_ATTRIBUTE("Step", ActionIncrement, mStep)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor
@@ -58,6 +70,11 @@ namespace Library
 		/// <param name="state">The curent state of the world</param>
 		void Update(WorldState& state) override;
 
+		/// <summary>
+		/// Clears the prescribed attributes of this ActionIncrement along with those of Action.
+		/// </summary>
+		void Reset() override;
+
 		/// <summary>
 		/// Creates and returns a clone of this ActionIncrement.
 		/// </summary>
@@ -84,6 +101,6 @@ namespace Library
 		std::string mTarget;
 	};
 
-	ConcreteFactory(ActionIncrement, Scope)
+	RecyclingConcreteFactory(ActionIncrement, Scope)
 }
 
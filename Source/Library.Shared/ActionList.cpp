@@ -9,10 +9,7 @@ namespace Library
 
 	const Vector<Signature> ActionList::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Actions"s, Datum::DatumTypes::Table, false, 1, 0 }
-		};
+		return AttributeReflection::Signatures<ActionList>();
 	}
 
 	ActionList::ActionList() : Action(TypeIdClass()) {}
@@ -35,10 +32,11 @@ namespace Library
 
 	void ActionList::Update(WorldState& state)
 	{
-		for (size_t i = 0; i < Actions().Size(); i++)
+		const Datum& actions = std::as_const(*this).Actions();
+		for (size_t i = 0; i < actions.Size(); i++)
 		{
-			assert(Actions().GetScope(i)->Is(Action::TypeIdClass()));
-			Action* action = static_cast<Action*>(Actions().GetScope(i));
+			assert(actions.GetScope(i)->Is(Action::TypeIdClass()));
+			Action* action = static_cast<Action*>(actions.GetScope(i));
 			state.Action = action;
 			action->Update(state);
 			state.Action = this;
@@ -8,10 +8,7 @@ namespace Library
 
 	const Vector<Signature> ActionListWhile::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Condition"s, Datum::DatumTypes::String, true, 1, offsetof(ActionListWhile, mCondition) }
-		};
+		return AttributeReflection::Signatures<ActionListWhile>();
 	}
 
 	ActionListWhile::ActionListWhile() : ActionList(TypeIdClass()) {}
@@ -20,7 +17,7 @@ namespace Library
 
 	void ActionListWhile::Update(WorldState& state)
 	{
-		Datum* preambleScope = Search("Preamble", state);
+		const Datum* preambleScope = Search("Preamble", state);
 		if (preambleScope != nullptr)
 		{
 			assert(preambleScope->GetScope()->Is(Action::TypeIdClass()));
@@ -29,7 +26,7 @@ namespace Library
 			preambleAction->Update(state);
 		}
 
-		Datum* condition = World::FindRelativeDatum(*this, Search("Condition", state)->GetString());
+		const Datum* condition = World::FindRelativeDatum(*this, Search("Condition", state)->GetString());
 		if (condition != nullptr)
 		{
 			while (condition->GetInt() != 0)
@@ -38,7 +35,7 @@ namespace Library
 			}
 		}
 
-		Datum* postambleScope = Search("Postamble", state);
+		const Datum* postambleScope = Search("Postamble", state);
 		if (postambleScope != nullptr)
 		{
 			assert(postambleScope->GetScope()->Is(Action::TypeIdClass()));
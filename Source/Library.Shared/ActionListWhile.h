@@ -5,7 +5,7 @@ namespace Library
 {
 	class ActionListWhile final : public ActionList
 	{
-		RTTI_DECLARATIONS(ActionIncrement, ActionList)
+		RTTI_DECLARATIONS(ActionListWhile, ActionList)
 
 	public:
 
@@ -14,6 +14,17 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Condition", ActionListWhile, mCondition)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string_view>
+#include "AttributeReflection.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Reads and writes an external prescribed attribute of an Attributed type through the offset of its member, without looking up its name or going through its Datum.
+	/// Resolved once per type from the signatures registered with the TypeManager, then usable on any instance of that type or of a type derived from it
+	/// </summary>
+	/// <typeparam name="T">The type of the elements of the attribute, such as int32_t or std::string</typeparam>
+	template<typename T>
+	class AttributeHandle final
+	{
+	public:
+		/// <summary>
+		/// Resolves the named attribute from the prescribed signatures of the type and its parents.
+		/// </summary>
+		/// <param name="typeId">The RTTI type id of the type that prescribes the attribute, or of a type derived from it</param>
+		/// <param name="name">The name of the attribute</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the type is not registered, or has no external attribute with that name whose elements are of type T</exception>
+		AttributeHandle(RTTI::IdType typeId, std::string_view name);
+		AttributeHandle(const AttributeHandle&) = default;
+		AttributeHandle(AttributeHandle&&) noexcept = default;
+		AttributeHandle& operator=(const AttributeHandle&) = default;
+		AttributeHandle& operator=(AttributeHandle&&) noexcept = default;
+		~AttributeHandle() = default;
+
+		/// <summary>
+		/// Resolves the named attribute of the passed in type.
+		/// </summary>
+		/// <typeparam name="TClass">The type that prescribes the attribute, or a type derived from it</typeparam>
+		/// <param name="name">The name of the attribute</param>
+		/// <returns>The handle of the attribute</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if the type has no external attribute with that name whose elements are of type T</exception>
+		template<typename TClass>
+		static AttributeHandle Resolve(std::string_view name);
+
+		/// <summary>
+		/// Returns a reference to an element of the attribute of the object. Writes made through it are not seen by the change tracking of the object, use Set for those.
+		/// In debug builds asserts that the object is of the type the handle was resolved for and that the index is in range
+		/// </summary>
+		/// <param name="object">An instance of the type the handle was resolved for</param>
+		/// <param name="index">The index of the element</param>
+		/// <returns>A reference to the element</returns>
+		T& Get(Attributed& object, size_t index = 0) const;
+		/// <summary>
+		/// Returns a const reference to an element of the attribute of the object.
+		/// In debug builds asserts that the object is of the type the handle was resolved for and that the index is in range
+		/// </summary>
+		/// <param name="object">An instance of the type the handle was resolved for</param>
+		/// <param name="index">The index of the element</param>
+		/// <returns>A const reference to the element</returns>
+		const T& Get(const Attributed& object, size_t index = 0) const;
+		/// <summary>
+		/// Writes an element of the attribute of the object and marks its Datum modified.
+		/// </summary>
+		/// <param name="object">An instance of the type the handle was resolved for</param>
+		/// <param name="value">The value being written</param>
+		/// <param name="index">The index of the element</param>
+		void Set(Attributed& object, const T& value, size_t index = 0) const;
+
+		/// <summary>
+		/// Returns the offset of the member behind the attribute within the object
+		/// </summary>
+		/// <returns>The offset in bytes</returns>
+		size_t Offset() const;
+		/// <summary>
+		/// Returns the position of the attribute among the attributes of the object, as used by Scope::operator[]
+		/// </summary>
+		/// <returns>The index of the attribute</returns>
+		size_t Index() const;
+		/// <summary>
+		/// Returns the number of elements of the attribute
+		/// </summary>
+		/// <returns>The number of elements</returns>
+		size_t Size() const;
+
+	private:
+		/// <summary>
+		/// The type the handle was resolved for
+		/// </summary>
+		RTTI::IdType mTypeId;
+		/// <summary>
+		/// The offset of the member behind the attribute
+		/// </summary>
+		size_t mOffset = 0;
+		/// <summary>
+		/// The position of the attribute in the order vector of the object. Prescribed attributes follow the "this" attribute in the order of their signatures
+		/// </summary>
+		size_t mIndex = 0;
+		/// <summary>
+		/// The number of elements of the attribute
+		/// </summary>
+		size_t mSize = 0;
+	};
+}
+
+#include "AttributeHandle.inl"
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "AttributeHandle.h"
+
+namespace Library
+{
+	template<typename T>
+	inline AttributeHandle<T>::AttributeHandle(RTTI::IdType typeId, std::string_view name) :
+		mTypeId(typeId)
+	{
+		const TypeManager::SignatureList signatures = TypeManager::GetPrescribedSignatures(typeId);
+		for (size_t i = 0; i < signatures.Size(); ++i)
+		{
+			const Signature& signature = signatures[i];
+			if (signature.Name == name)
+			{
+				if (!signature.IsExternal)
+				{
+					throw std::runtime_error("An AttributeHandle can only access external attributes");
+				}
+
+				if (signature.Type != DatumTypeOf<T>::Type)
+				{
+					throw std::runtime_error("The attribute is not of the type of the AttributeHandle");
+				}
+
+				mOffset = signature.Offset;
+				mIndex = i + 1;
+				mSize = signature.Size / DatumTypeOf<T>::Size;
+				return;
+			}
+		}
+
+		throw std::runtime_error("The type has no prescribed attribute with that name");
+	}
+
+	template<typename T>
+	template<typename TClass>
+	inline AttributeHandle<T> AttributeHandle<T>::Resolve(std::string_view name)
+	{
+		return AttributeHandle(TClass::TypeIdClass(), name);
+	}
+
+	template<typename T>
+	inline T& AttributeHandle<T>::Get(Attributed& object, size_t index) const
+	{
+		return const_cast<T&>(Get(std::as_const(object), index));
+	}
+
+	template<typename T>
+	inline const T& AttributeHandle<T>::Get(const Attributed& object, size_t index) const
+	{
+		assert(object.Is(mTypeId));
+		assert(index < mSize);
+
+		return reinterpret_cast<const T*>(reinterpret_cast<const uint8_t*>(&object) + mOffset)[index];
+	}
+
+	template<typename T>
+	inline void AttributeHandle<T>::Set(Attributed& object, const T& value, size_t index) const
+	{
+		Get(object, index) = value;
+		object[mIndex].MarkModified();
+	}
+
+	template<typename T>
+	inline size_t AttributeHandle<T>::Offset() const
+	{
+		return mOffset;
+	}
+
+	template<typename T>
+	inline size_t AttributeHandle<T>::Index() const
+	{
+		return mIndex;
+	}
+
+	template<typename T>
+	inline size_t AttributeHandle<T>::Size() const
+	{
+		return mSize;
+	}
+}
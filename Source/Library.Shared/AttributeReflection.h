@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <array>
+#include <glm/glm.hpp>
+#include "Attributed.h"
+
+/// <summary>
+/// Declares an external prescribed attribute backed by a data member. The type and element count of the attribute are deduced from the member.
+/// Used inside the PrescribedAttributes function of a class, where the class is complete
+/// </summary>
+#define PRESCRIBED_ATTRIBUTE(Name, Type, Member) Library::PrescribeExternal<decltype(Type::Member)>(Name, offsetof(Type, Member))
+
+namespace Library
+{
+	/// <summary>
+	/// Maps the type of a data member to the type of the Datum that stores it. Arrays are stored with one element per array element
+	/// </summary>
+	template<typename T>
+	struct DatumTypeOf;
+
+	template<>
+	struct DatumTypeOf<int32_t> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::Integer;
+		static constexpr size_t Size = 1;
+	};
+
+	template<>
+	struct DatumTypeOf<float> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::Float;
+		static constexpr size_t Size = 1;
+	};
+
+	template<>
+	struct DatumTypeOf<glm::vec4> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::Vector;
+		static constexpr size_t Size = 1;
+	};
+
+	template<>
+	struct DatumTypeOf<glm::mat4> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::Matrix;
+		static constexpr size_t Size = 1;
+	};
+
+	template<>
+	struct DatumTypeOf<std::string> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::String;
+		static constexpr size_t Size = 1;
+	};
+
+	template<>
+	struct DatumTypeOf<RTTI*> final
+	{
+		static constexpr Datum::DatumTypes Type = Datum::DatumTypes::Pointer;
+		static constexpr size_t Size = 1;
+	};
+
+	template<typename T, size_t N>
+	struct DatumTypeOf<T[N]> final
+	{
+		static constexpr Datum::DatumTypes Type = DatumTypeOf<T>::Type;
+		static constexpr size_t Size = N * DatumTypeOf<T>::Size;
+	};
+
+	/// <summary>
+	/// Hashes an attribute name at compile time. Equal to DefaultHash of the name, which Scopes use to find their attributes
+	/// </summary>
+	/// <param name="name">The name of the attribute</param>
+	/// <returns>The hash of the name</returns>
+	constexpr size_t AttributeNameHash(std::string_view name);
+
+	/// <summary>
+	/// The compile time description of a prescribed attribute
+	/// </summary>
+	struct PrescribedAttribute final
+	{
+		std::string_view Name;
+		size_t NameHash;
+		Datum::DatumTypes Type;
+		bool IsExternal;
+		size_t Size;
+		size_t Offset;
+	};
+
+	/// <summary>
+	/// Describes an external prescribed attribute stored in a data member. PRESCRIBED_ATTRIBUTE deduces the arguments from the member
+	/// </summary>
+	/// <typeparam name="TMember">The type of the data member</typeparam>
+	/// <param name="name">The name of the attribute</param>
+	/// <param name="offset">The offset of the data member within its class</param>
+	/// <returns>The description of the attribute</returns>
+	template<typename TMember>
+	constexpr PrescribedAttribute PrescribeExternal(std::string_view name, size_t offset);
+
+	/// <summary>
+	/// Describes an internal prescribed attribute, whose storage is owned by its Datum
+	/// </summary>
+	/// <param name="name">The name of the attribute</param>
+	/// <param name="type">The type of the attribute</param>
+	/// <param name="size">The number of elements reserved for the attribute</param>
+	/// <returns>The description of the attribute</returns>
+	constexpr PrescribedAttribute PrescribeInternal(std::string_view name, Datum::DatumTypes type, size_t size = 1);
+
+	/// <summary>
+	/// Builds the runtime type information of Attributed classes that declare their prescribed attributes once, in a static constexpr PrescribedAttributes function
+	/// returning a std::array of PrescribedAttribute. The signatures registered with the TypeManager and the code that populates an instance are both generated from it
+	/// </summary>
+	class AttributeReflection final
+	{
+	public:
+		AttributeReflection() = delete;
+		AttributeReflection(const AttributeReflection&) = delete;
+		AttributeReflection(AttributeReflection&&) = delete;
+		AttributeReflection& operator=(const AttributeReflection&) = delete;
+		AttributeReflection& operator=(AttributeReflection&&) = delete;
+		~AttributeReflection() = delete;
+
+		/// <summary>
+		/// Returns the signatures of the prescribed attributes declared by the class, not including those of its parents
+		/// </summary>
+		/// <typeparam name="TClass">The class declaring the attributes</typeparam>
+		/// <returns>The signatures of the attributes, in the order they are declared</returns>
+		template<typename TClass>
+		static Vector<Signature> Signatures();
+
+		/// <summary>
+		/// Registers the class with the TypeManager, together with the generated function that populates its instances
+		/// </summary>
+		/// <typeparam name="TClass">The class being registered</typeparam>
+		/// <typeparam name="TParent">The Attributed class it derives from</typeparam>
+		template<typename TClass, typename TParent>
+		static void RegisterType();
+
+		/// <summary>
+		/// Appends the prescribed attributes of the parent classes and then those declared by the class, using the name hashes computed at compile time.
+		/// Registered with the TypeManager as the PopulateFunction of the class
+		/// </summary>
+		/// <typeparam name="TClass">The class declaring the attributes</typeparam>
+		/// <typeparam name="TParent">The Attributed class it derives from</typeparam>
+		/// <param name="object">The object being populated, while it is constructed</param>
+		template<typename TClass, typename TParent>
+		static void Populate(Attributed& object);
+
+	private:
+		/// <summary>
+		/// Appends one prescribed attribute to the object
+		/// </summary>
+		/// <param name="object">The object being populated</param>
+		/// <param name="attribute">The description of the attribute</param>
+		static void Append(Attributed& object, const PrescribedAttribute& attribute);
+	};
+}
+
+#include "AttributeReflection.inl"
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "AttributeReflection.h"
+
+namespace Library
+{
+	constexpr size_t AttributeNameHash(std::string_view name)
+	{
+		size_t hashValue = 0;
+		for (char character : name)
+		{
+			hashValue += HashPrime * static_cast<uint8_t>(character);
+		}
+
+		return hashValue;
+	}
+
+	template<typename TMember>
+	constexpr PrescribedAttribute PrescribeExternal(std::string_view name, size_t offset)
+	{
+		return PrescribedAttribute{ name, AttributeNameHash(name), DatumTypeOf<TMember>::Type, true, DatumTypeOf<TMember>::Size, offset };
+	}
+
+	constexpr PrescribedAttribute PrescribeInternal(std::string_view name, Datum::DatumTypes type, size_t size)
+	{
+		return PrescribedAttribute{ name, AttributeNameHash(name), type, false, size, 0 };
+	}
+
+	template<typename TClass>
+	inline Vector<Signature> AttributeReflection::Signatures()
+	{
+		constexpr auto attributes = TClass::PrescribedAttributes();
+
+		Vector<Signature> signatures(attributes.size());
+		for (const PrescribedAttribute& attribute : attributes)
+		{
+			signatures.EmplaceBack(std::string(attribute.Name), attribute.Type, attribute.IsExternal, attribute.Size, attribute.Offset);
+		}
+
+		return signatures;
+	}
+
+	template<typename TClass, typename TParent>
+	inline void AttributeReflection::RegisterType()
+	{
+		TypeManager::RegisterType(TClass::TypeIdClass(), TParent::TypeIdClass(), Signatures<TClass>(), &Populate<TClass, TParent>);
+	}
+
+	template<typename TClass, typename TParent>
+	inline void AttributeReflection::Populate(Attributed& object)
+	{
+		if constexpr (!std::is_same_v<TParent, Attributed>)
+		{
+			object.Populate(TParent::TypeIdClass());
+		}
+
+		constexpr auto attributes = TClass::PrescribedAttributes();
+		for (const PrescribedAttribute& attribute : attributes)
+		{
+			Append(object, attribute);
+		}
+	}
+
+	inline void AttributeReflection::Append(Attributed& object, const PrescribedAttribute& attribute)
+	{
+		Datum& datum = object.AppendHashed(attribute.Name, attribute.NameHash);
+		datum.SetType(attribute.Type);
+
+		if (attribute.IsExternal)
+		{
+			datum.SetStorage<void>(reinterpret_cast<uint8_t*>(&object) + attribute.Offset, attribute.Size);
+		}
+		else
+		{
+			datum.Reserve(attribute.Size);
+		}
+	}
+}
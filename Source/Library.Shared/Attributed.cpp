@@ -51,14 +51,14 @@ namespace Library
 		return *this;
 	}
 
-	bool Attributed::IsAttribute(const std::string& name) const
+	bool Attributed::IsAttribute(std::string_view name) const
 	{
-		return mMap.ContainsKey(name);
+		return Find(name) != nullptr;
 	}
 
-	bool Attributed::IsPrescribedAttribute(const std::string& name) const
+	bool Attributed::IsPrescribedAttribute(std::string_view name) const
 	{
-		const Vector<Signature>& prescribedAttributes = TypeManager::GetPrescribedSignatures(this->TypeIdInstance());
+		const TypeManager::SignatureList& prescribedAttributes = TypeManager::GetPrescribedSignatures(this->TypeIdInstance());
 		for (const Signature& signature : prescribedAttributes)
 		{
 			if (signature.Name == name)
@@ -69,7 +69,7 @@ namespace Library
 		return false;
 	}
 
-	bool Attributed::IsAuxiliaryAttribute(const std::string& name) const
+	bool Attributed::IsAuxiliaryAttribute(std::string_view name) const
 	{
 		return IsAttribute(name) && !IsPrescribedAttribute(name);
 	}
@@ -84,14 +84,21 @@ namespace Library
 		return Append(name);
 	}
 
-	const Vector<Scope::PairType*>& Attributed::GetAttributes() const
+	const Scope::OrderVectorType& Attributed::GetAttributes() const
 	{
 		return mOrderVector;
 	}
 
 	void Attributed::Populate(RTTI::IdType typeId)
 	{
-		const Vector<Signature>& prescribedAttributes = TypeManager::GetPrescribedSignatures(typeId);
+		TypeManager::PopulateFunction populate = TypeManager::GetPopulateFunction(typeId);
+		if (populate != nullptr)
+		{
+			populate(*this);
+			return;
+		}
+
+		const TypeManager::SignatureList& prescribedAttributes = TypeManager::GetPrescribedSignatures(typeId);
 
 		for (const Signature& signature : prescribedAttributes)
 		{
@@ -110,9 +117,42 @@ namespace Library
 		}
 	}
 
+	void Attributed::ResetAttributes()
+	{
+		const TypeManager::SignatureList& prescribedAttributes = TypeManager::GetPrescribedSignatures(TypeIdInstance());
+
+		// The this attribute comes first, followed by the prescribed attributes in the order of their signatures
+		TruncateAttributes(prescribedAttributes.Size() + 1);
+
+		for (size_t i = 0; i < prescribedAttributes.Size(); ++i)
+		{
+			if (prescribedAttributes[i].IsExternal)
+			{
+				continue;
+			}
+
+			Datum& datum = mOrderVector[i + 1]->second;
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				for (size_t j = 0; j < datum.Size(); ++j)
+				{
+					Scope* childScope = datum.GetScope(j);
+					if (childScope->GetParent() == this)
+					{
+						delete childScope;
+					}
+				}
+			}
+			datum.Clear();
+		}
+
+		// The members behind the external attributes are reset by the derived classes without going through their Datums
+		MarkModified();
+	}
+
 	void Attributed::UpdateExternalStorage(RTTI::IdType typeId)
 	{
-		Vector<Signature> signatures = TypeManager::GetPrescribedSignatures(typeId);
+		const TypeManager::SignatureList signatures = TypeManager::GetPrescribedSignatures(typeId);
 
 		for (const Signature& signature : signatures)
 		{
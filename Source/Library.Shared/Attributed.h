@@ -10,6 +10,8 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(Attributed, Scope);
 
+		friend class AttributeReflection;
+
 	public:
 		/// <summary>
 		/// Copy constructor. Copies all data from the rhs Attributed object and then fixes up the this attribute to point to this object,
@@ -42,21 +44,21 @@ namespace Library
 		/// </summary>
 		/// <param name="name">The name used to check if there is an attribute associated with it</param>
 		/// <returns>True if this Attributed object contains an attribute with the passed in name, false otherwise</returns>
-		bool IsAttribute(const std::string& name) const;
+		bool IsAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Checks if this Attributed object contains a prescribed attribute associated with the passed in name.
 		/// </summary>
 		/// <param name="name">The name used to check if there is a prescribed attribute associated with it</param>
 		/// <returns>True if this Attributed object contains a prescribed attribute with the passed in name, false otherwise</returns>
-		bool IsPrescribedAttribute(const std::string& name) const;
+		bool IsPrescribedAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Checks if this Attributed object contains an auxiliary attribute associated with the passed in name.
 		/// </summary>
 		/// <param name="name">The name used to check if there is an auxiliary attribute associated with it</param>
 		/// <returns>True if this Attributed object contains an auxiliary attribute with the passed in name, false otherwise</returns>
-		bool IsAuxiliaryAttribute(const std::string& name) const;
+		bool IsAuxiliaryAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Appends a new attribute with the associated passed in name and a default constructed Datum.
@@ -71,7 +73,7 @@ namespace Library
 		/// Accessor method to get a Vector of all of the attributes of this Attributed object
 		/// </summary>
 		/// <returns>Vector of pointers to each attribute contained within this object</returns>
-		const Vector<PairType*>& GetAttributes() const;
+		const OrderVectorType& GetAttributes() const;
 
 		/// <summary>
 		/// Virtual clone method. Required in order for derived attributed classes to be cloned with the correct type instead of becoming a Scope.
@@ -87,7 +89,8 @@ namespace Library
 		explicit Attributed(RTTI::IdType typeId);
 
 		/// <summary>
-		/// Populates this object with all of the prescribed attributes of itself and its parents
+		/// Populates this object with all of the prescribed attributes of itself and its parents.
+		/// Uses the populate function registered for the type if it has one, and walks its signatures otherwise
 		/// </summary>
 		/// <param name="typeId">The typeId of this object. Used to determine what presecribed attributes this method grabs from the TypeManager</param>
 		void Populate(RTTI::IdType typeId);
@@ -97,6 +100,13 @@ namespace Library
 		/// </summary>
 		/// <param name="typeId">The typeId of this object instance used to get the correct signatures</param>
 		void UpdateExternalStorage(RTTI::IdType typeId);
+
+		/// <summary>
+		/// Removes the auxiliary attributes of this object and empties its internal prescribed attributes, deleting the Scopes they own.
+		/// External prescribed attributes keep their storage, so derived classes reset the data members behind them themselves.
+		/// Marks this object modified, so its cached hash is recomputed once they have
+		/// </summary>
+		void ResetAttributes();
 	};
 }
 
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include "HashMap.h"
+
+namespace Library
+{
+	/// <summary>
+	/// A HashMap that can be shared between threads. Keys are spread over ShardCount independent HashMaps that each have their own
+	/// reader/writer lock, so a lookup only takes a shared lock on one shard and a registration only blocks readers of the shard it writes to.
+	/// Since another thread may remove an entry at any time, elements are never handed out through iterators or references. Instead the
+	/// caller passes a visitor that is run while the shard holding the element is locked.
+	/// </summary>
+	template<typename TKey, typename TData, size_t ShardCount = 8>
+	class ConcurrentHashMap final
+	{
+		static_assert(ShardCount > 0, "A ConcurrentHashMap needs at least one shard");
+
+	public:
+		using MapType = HashMap<TKey, TData>;
+		using PairType = typename MapType::PairType;
+		using HashFunctor = typename MapType::HashFunctor;
+		using KeyEqualityFunctor = typename MapType::KeyEqualityFunctor;
+
+#pragma region MemberMethods
+		/// <summary>
+		/// Constructor that spreads bucketSize buckets over the shards. Every shard receives at least one bucket
+		/// </summary>
+		/// <param name="bucketSize">The total number of buckets across all of the shards</param>
+		/// <param name="hashFunctor">Functor used to hash the keys, both to pick a shard and a bucket within it</param>
+		/// <param name="keyEquality">Functor used to compare keys for equality</param>
+		explicit ConcurrentHashMap(size_t bucketSize = 11, HashFunctor hashFunctor = DefaultHash<TKey>(), KeyEqualityFunctor keyEquality = DefaultEquality<TKey>());
+		ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+		ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+		~ConcurrentHashMap() = default;
+#pragma endregion
+
+#pragma region ElementAccess
+		/// <summary>
+		/// Finds the element associated with the key and calls the visitor with it while holding a shared lock on its shard.
+		/// The visitor must not call back into this map for a key in the same shard
+		/// </summary>
+		/// <param name="key">The key of the element being looked for</param>
+		/// <param name="visitor">A functor taking a const reference to the data of the element</param>
+		/// <returns>True if the key was found and the visitor was called, false otherwise</returns>
+		template<typename Visitor>
+		bool Visit(const TKey& key, Visitor visitor) const;
+
+		/// <summary>
+		/// Calls the visitor with every element in the map. Each shard is locked for reading while it is being visited,
+		/// so the elements seen are consistent per shard but not across the whole map
+		/// </summary>
+		/// <param name="visitor">A functor taking a const reference to a PairType</param>
+		template<typename Visitor>
+		void ForEach(Visitor visitor) const;
+
+		/// <summary>
+		/// Checks if the key is contained within the map
+		/// </summary>
+		/// <param name="key">The key being searched for</param>
+		/// <returns>True if the key exists, false otherwise</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Returns the number of elements in the map. Other threads may change the map while the shards are being counted
+		/// </summary>
+		/// <returns>The number of elements in the map</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Returns the total number of buckets across all of the shards
+		/// </summary>
+		/// <returns>The total number of buckets</returns>
+		size_t BucketSize() const;
+#pragma endregion
+
+#pragma region Modifiers
+		/// <summary>
+		/// Inserts a copy of the pair if its key is not already in the map
+		/// </summary>
+		/// <param name="data">The key/data pair being inserted</param>
+		/// <returns>True if the pair was inserted, false if the key already existed</returns>
+		bool Insert(const PairType& data);
+
+		/// <summary>
+		/// Moves the pair into the map if its key is not already in the map
+		/// </summary>
+		/// <param name="data">The key/data pair being inserted</param>
+		/// <returns>True if the pair was inserted, false if the key already existed</returns>
+		bool Insert(PairType&& data);
+
+		/// <summary>
+		/// Constructs the data in place from args if the key is not already in the map
+		/// </summary>
+		/// <param name="key">The key of the new element</param>
+		/// <param name="args">Arguments forwarded to the constructor of TData</param>
+		/// <returns>True if the element was constructed, false if the key already existed</returns>
+		template<typename... Args>
+		bool TryEmplace(const TKey& key, Args&&... args);
+
+		/// <summary>
+		/// Removes the element associated with the key
+		/// </summary>
+		/// <param name="key">The key of the element being removed</param>
+		/// <returns>True if an element was removed, false otherwise</returns>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Redistributes the elements over a new total number of buckets. Each shard is rehashed under its own lock
+		/// </summary>
+		/// <param name="bucketSize">The new total number of buckets</param>
+		void Resize(size_t bucketSize);
+
+		/// <summary>
+		/// Removes every element from the map
+		/// </summary>
+		void Clear();
+#pragma endregion
+
+	private:
+		/// <summary>
+		/// One stripe of the map. Aligned to a cache line so that readers locking neighbouring shards do not contend on the same line
+		/// </summary>
+		struct alignas(64) Shard final
+		{
+			mutable std::shared_mutex Mutex;
+			MapType Map;
+		};
+
+		/// <summary>
+		/// Returns the shard that owns the key
+		/// </summary>
+		/// <param name="key">The key being looked up</param>
+		/// <returns>The shard the key hashes to</returns>
+		const Shard& ShardFor(const TKey& key) const;
+		Shard& ShardFor(const TKey& key);
+
+		/// <summary>
+		/// Returns how many of bucketSize buckets the shard at shardIndex receives
+		/// </summary>
+		/// <param name="bucketSize">The total number of buckets</param>
+		/// <param name="shardIndex">The index of the shard</param>
+		/// <returns>The bucket count of the shard, never less than one</returns>
+		static size_t ShardBucketSize(size_t bucketSize, size_t shardIndex);
+
+		HashFunctor mHashFunctor;
+		KeyEqualityFunctor mKeyEquality;
+		std::array<Shard, ShardCount> mShards;
+	};
+}
+
+#include "ConcurrentHashMap.inl"
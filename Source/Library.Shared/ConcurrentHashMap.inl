@@ -0,0 +1,166 @@
+#include "ConcurrentHashMap.h"
+
+namespace Library
+{
+#pragma region MemberMethods
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline ConcurrentHashMap<TKey, TData, ShardCount>::ConcurrentHashMap(size_t bucketSize, HashFunctor hashFunctor, KeyEqualityFunctor keyEquality) :
+		mHashFunctor(hashFunctor), mKeyEquality(keyEquality)
+	{
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			mShards[i].Map = MapType(ShardBucketSize(bucketSize, i), mHashFunctor, mKeyEquality);
+		}
+	}
+#pragma endregion
+
+#pragma region ElementAccess
+	template<typename TKey, typename TData, size_t ShardCount>
+	template<typename Visitor>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::Visit(const TKey& key, Visitor visitor) const
+	{
+		const Shard& shard = ShardFor(key);
+		std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+
+		auto it = shard.Map.Find(key);
+		if (it == shard.Map.end())
+		{
+			return false;
+		}
+
+		visitor(it->second);
+		return true;
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	template<typename Visitor>
+	inline void ConcurrentHashMap<TKey, TData, ShardCount>::ForEach(Visitor visitor) const
+	{
+		for (const Shard& shard : mShards)
+		{
+			std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+			for (const PairType& pair : shard.Map)
+			{
+				visitor(pair);
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::ContainsKey(const TKey& key) const
+	{
+		const Shard& shard = ShardFor(key);
+		std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+		return shard.Map.ContainsKey(key);
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline size_t ConcurrentHashMap<TKey, TData, ShardCount>::Size() const
+	{
+		size_t size = 0;
+		for (const Shard& shard : mShards)
+		{
+			std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+			size += shard.Map.Size();
+		}
+
+		return size;
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline size_t ConcurrentHashMap<TKey, TData, ShardCount>::BucketSize() const
+	{
+		size_t bucketSize = 0;
+		for (const Shard& shard : mShards)
+		{
+			std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+			bucketSize += shard.Map.BucketSize();
+		}
+
+		return bucketSize;
+	}
+#pragma endregion
+
+#pragma region Modifiers
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::Insert(const PairType& data)
+	{
+		Shard& shard = ShardFor(data.first);
+		std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+		return shard.Map.Insert(data).second;
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::Insert(PairType&& data)
+	{
+		Shard& shard = ShardFor(data.first);
+		std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+		return shard.Map.Insert(std::move(data)).second;
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	template<typename... Args>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::TryEmplace(const TKey& key, Args&&... args)
+	{
+		Shard& shard = ShardFor(key);
+		std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+		return shard.Map.TryEmplace(key, std::forward<Args>(args)...).second;
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline bool ConcurrentHashMap<TKey, TData, ShardCount>::Remove(const TKey& key)
+	{
+		Shard& shard = ShardFor(key);
+		std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+		return shard.Map.Remove(key);
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline void ConcurrentHashMap<TKey, TData, ShardCount>::Resize(size_t bucketSize)
+	{
+		for (size_t i = 0; i < ShardCount; ++i)
+		{
+			std::unique_lock<std::shared_mutex> lock(mShards[i].Mutex);
+			mShards[i].Map.Resize(ShardBucketSize(bucketSize, i));
+		}
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline void ConcurrentHashMap<TKey, TData, ShardCount>::Clear()
+	{
+		for (Shard& shard : mShards)
+		{
+			std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+			shard.Map.Clear();
+		}
+	}
+#pragma endregion
+
+#pragma region Helpers
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline const typename ConcurrentHashMap<TKey, TData, ShardCount>::Shard& ConcurrentHashMap<TKey, TData, ShardCount>::ShardFor(const TKey& key) const
+	{
+		// The shard HashMaps pick their bucket with hash % bucketSize, so the hash is remixed before picking the shard
+		// to keep keys that share a bucket index from also piling into the same shard
+		size_t hash = mHashFunctor(key);
+		hash ^= hash >> 16;
+		hash *= 0x45D9F3B;
+		hash ^= hash >> 16;
+
+		return mShards[hash % ShardCount];
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline typename ConcurrentHashMap<TKey, TData, ShardCount>::Shard& ConcurrentHashMap<TKey, TData, ShardCount>::ShardFor(const TKey& key)
+	{
+		return const_cast<Shard&>(static_cast<const ConcurrentHashMap*>(this)->ShardFor(key));
+	}
+
+	template<typename TKey, typename TData, size_t ShardCount>
+	inline size_t ConcurrentHashMap<TKey, TData, ShardCount>::ShardBucketSize(size_t bucketSize, size_t shardIndex)
+	{
+		size_t shardBucketSize = bucketSize / ShardCount + (shardIndex < bucketSize % ShardCount ? 1 : 0);
+		return std::max(shardBucketSize, size_t(1));
+	}
+#pragma endregion
+}
@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "Datum.h"
+#include "Scope.h"
+#include "DefaultHash.h"
+#include <new>
 
 namespace Library
 {
@@ -112,13 +115,9 @@ namespace Library
 
 	Datum::~Datum()
 	{
+		mOwner = nullptr;
 		Clear();
-
-		if (!mIsExternal)
-		{
-			mCapacity = 0;
-			free(mData.vo);
-		}
+		ReleaseStorage();
 	}
 
 
@@ -126,19 +125,19 @@ namespace Library
 	{
 		if (!mIsExternal && rhs.mCapacity > 0)
 		{
-			Reserve(rhs.mCapacity);
-
-			if (mType == DatumTypes::String)
+			if (mType == DatumTypes::Table)
 			{
-				for (size_t i = 0; i < rhs.mSize; ++i)
-				{
-					PushBack(rhs.mData.s[i]);
-				}
+				Reserve(rhs.mCapacity);
+				mSize = rhs.mSize;
+				std::memcpy(mData.b, rhs.mData.b, mSize * DataTypeSizes[static_cast<size_t>(mType)]);
 			}
 			else
 			{
+				// Nothing is copied until one of the two datums is written to
+				rhs.References().fetch_add(1, std::memory_order_relaxed);
+				mData.vo = rhs.mData.vo;
 				mSize = rhs.mSize;
-				std::memcpy(mData.b, rhs.mData.b, mSize * DataTypeSizes[static_cast<size_t>(mType)]);
+				mCapacity = rhs.mCapacity;
 			}
 		}
 		else
@@ -160,11 +159,7 @@ namespace Library
 		if (this != &rhs)
 		{
 			Clear();
-
-			if (!mIsExternal)
-			{
-				free(mData.vo);
-			}
+			ReleaseStorage();
 
 			SetType(rhs.mType);
 			mIsExternal = rhs.mIsExternal;
@@ -179,6 +174,9 @@ namespace Library
 	{
 		if (this != &rhs)
 		{
+			Clear();
+			ReleaseStorage();
+
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
 			mData.vo = rhs.mData.vo;
@@ -287,6 +285,37 @@ namespace Library
 		return !operator==(rhs);
 	}
 
+	size_t Datum::Hash() const
+	{
+		size_t hash = CombineHash(static_cast<size_t>(mType), mSize);
+		switch (mType)
+		{
+		case DatumTypes::String:
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				hash = CombineHash(hash, OrderedHash(reinterpret_cast<const uint8_t*>(mData.s[i].data()), mData.s[i].size()));
+			}
+			break;
+
+		case DatumTypes::Table:
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				hash = CombineHash(hash, mData.t[i]->Hash());
+			}
+			break;
+
+		case DatumTypes::Unknown:
+		case DatumTypes::Pointer:
+			break;
+
+		default:
+			hash = CombineHash(hash, OrderedHash(mData.b, mSize * DataTypeSizes[static_cast<size_t>(mType)]));
+			break;
+		}
+
+		return hash;
+	}
+
 #pragma endregion
 
 #pragma region Type
@@ -327,6 +356,21 @@ namespace Library
 		return mIsExternal;
 	}
 
+	bool Datum::IsSharedStorage() const
+	{
+		return !mIsExternal && mData.vo != nullptr && References().load(std::memory_order_acquire) > 1;
+	}
+
+	size_t Datum::Version() const
+	{
+		return mVersion;
+	}
+
+	size_t Datum::ChangeFrame() const
+	{
+		return mChangeFrame;
+	}
+
 	bool Datum::IsEmpty() const
 	{
 		return mSize == 0;
@@ -339,6 +383,8 @@ namespace Library
 			throw std::runtime_error("Invalid operation");
 		}
 
+		BeginWrite();
+
 		if (mSize > newSize && mType == DatumTypes::String)
 		{
 			for (size_t i = newSize; i < mSize; ++i)
@@ -372,9 +418,21 @@ namespace Library
 
 		if (capacity > mCapacity)
 		{
-			void* newData = realloc(mData.vo, capacity * DataTypeSizes[static_cast<size_t>(mType)]);
-			assert(newData != nullptr);
-			mData.vo = newData;
+			if (IsSharedStorage())
+			{
+				CopyStorage(capacity);
+				return;
+			}
+
+			bool isNew = mData.vo == nullptr;
+			void* block = realloc(isNew ? nullptr : mData.b - StorageHeaderSize, StorageHeaderSize + capacity * DataTypeSizes[static_cast<size_t>(mType)]);
+			assert(block != nullptr);
+			if (isNew)
+			{
+				new(block) ReferenceCount(1);
+			}
+
+			mData.b = static_cast<uint8_t*>(block) + StorageHeaderSize;
 			mCapacity = capacity;
 		}
 	}
@@ -386,6 +444,55 @@ namespace Library
 #pragma region Get
 
 	int& Datum::GetInt(size_t index)
+	{
+		std::as_const(*this).GetInt(index);
+		Detach();
+		return mData.i[index];
+	}
+
+	float& Datum::GetFloat(size_t index)
+	{
+		std::as_const(*this).GetFloat(index);
+		Detach();
+		return mData.f[index];
+	}
+
+	glm::vec4& Datum::GetVector(size_t index)
+	{
+		std::as_const(*this).GetVector(index);
+		Detach();
+		return mData.v[index];
+	}
+
+	glm::mat4& Datum::GetMatrix(size_t index)
+	{
+		std::as_const(*this).GetMatrix(index);
+		Detach();
+		return mData.m[index];
+	}
+
+	std::string& Datum::GetString(size_t index)
+	{
+		std::as_const(*this).GetString(index);
+		Detach();
+		return mData.s[index];
+	}
+
+	Datum::RTTIPointer& Datum::GetPointer(size_t index)
+	{
+		std::as_const(*this).GetPointer(index);
+		Detach();
+		return mData.p[index];
+	}
+
+	Datum::ScopePointer& Datum::GetScope(size_t index)
+	{
+		std::as_const(*this).GetScope(index);
+		Detach();
+		return mData.t[index];
+	}
+
+	const int& Datum::GetInt(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Integer)
 		{
@@ -395,7 +502,7 @@ namespace Library
 		return mData.i[index];
 	}
 
-	float& Datum::GetFloat(size_t index)
+	const float& Datum::GetFloat(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Float)
 		{
@@ -405,7 +512,7 @@ namespace Library
 		return mData.f[index];
 	}
 
-	glm::vec4& Datum::GetVector(size_t index)
+	const glm::vec4& Datum::GetVector(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Vector)
 		{
@@ -415,7 +522,7 @@ namespace Library
 		return mData.v[index];
 	}
 
-	glm::mat4& Datum::GetMatrix(size_t index)
+	const glm::mat4& Datum::GetMatrix(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Matrix)
 		{
@@ -425,7 +532,7 @@ namespace Library
 		return mData.m[index];
 	}
 
-	std::string& Datum::GetString(size_t index)
+	const std::string& Datum::GetString(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::String)
 		{
@@ -435,7 +542,7 @@ namespace Library
 		return mData.s[index];
 	}
 
-	Datum::RTTIPointer& Datum::GetPointer(size_t index)
+	const Datum::RTTIPointer& Datum::GetPointer(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Pointer)
 		{
@@ -445,7 +552,7 @@ namespace Library
 		return mData.p[index];
 	}
 
-	Datum::ScopePointer& Datum::GetScope(size_t index)
+	const Datum::ScopePointer& Datum::GetScope(size_t index) const
 	{
 		if (index >= mSize || mType != DatumTypes::Table)
 		{
@@ -455,41 +562,6 @@ namespace Library
 		return mData.t[index];
 	}
 
-	const int& Datum::GetInt(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetInt(index);
-	}
-
-	const float& Datum::GetFloat(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetFloat(index);
-	}
-
-	const glm::vec4& Datum::GetVector(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetVector(index);
-	}
-
-	const glm::mat4& Datum::GetMatrix(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetMatrix(index);
-	}
-
-	const std::string& Datum::GetString(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetString(index);
-	}
-
-	const Datum::RTTIPointer& Datum::GetPointer(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetPointer(index);
-	}
-
-	const Datum::ScopePointer& Datum::GetScope(size_t index) const
-	{
-		return const_cast<Datum&>(*this).GetScope(index);
-	}
-
 #pragma endregion
 
 	std::string Datum::ToString(size_t index)
@@ -506,6 +578,22 @@ namespace Library
 
 #pragma region RemoveData
 
+	void Datum::Set(std::string&& data, size_t index)
+	{
+		if (mType != DatumTypes::String || index >= mSize)
+		{
+			throw std::runtime_error("Can't set data of a different type than the Datum. Or index is out of range");
+		}
+
+		BeginWrite();
+		mData.s[index] = std::move(data);
+	}
+
+	void Datum::PushBack(std::string&& value)
+	{
+		EmplaceBack<std::string>(std::move(value));
+	}
+
 	void Datum::SetFromString(const std::string& str, size_t index)
 	{
 		if (index >= mSize || mType == DatumTypes::Unknown || mType == DatumTypes::Pointer || mType == DatumTypes::Table)
@@ -513,6 +601,7 @@ namespace Library
 			throw std::runtime_error("Unable to SetFromString");
 		}
 
+		BeginWrite();
 		SetFromStringFunctions[static_cast<size_t>(mType) - 1](str, mData.vo, index);
 	}
 
@@ -525,6 +614,7 @@ namespace Library
 
 		if (!IsEmpty())
 		{
+			BeginWrite();
 			if (mType == DatumTypes::String)
 			{
 				mData.s[mSize - 1].~basic_string();
@@ -545,6 +635,7 @@ namespace Library
 			return false;
 		}
 
+		BeginWrite();
 		if (mType == DatumTypes::String)
 		{
 			mData.s[index].~basic_string();
@@ -558,12 +649,17 @@ namespace Library
 
 	void Datum::Clear()
 	{
+		MarkModified();
 		if (mIsExternal)
 		{
 			mCapacity = 0;
 			mData.vo = nullptr;
 			mIsExternal = false;
 		}
+		else if (IsSharedStorage())
+		{
+			ReleaseStorage();
+		}
 		else if (mType == DatumTypes::String)
 		{
 			for (size_t i = 0; i < mSize; ++i)
@@ -575,6 +671,89 @@ namespace Library
 		mSize = 0;
 	}
 
+#pragma endregion
+
+#pragma region SharedStorage
+
+	Datum::ReferenceCount& Datum::References() const
+	{
+		assert(!mIsExternal && mData.vo != nullptr);
+		return *std::launder(reinterpret_cast<ReferenceCount*>(mData.b - StorageHeaderSize));
+	}
+
+	void Datum::BeginWrite()
+	{
+		Detach();
+		MarkModified();
+	}
+
+	void Datum::Detach()
+	{
+		if (IsSharedStorage())
+		{
+			CopyStorage(mCapacity);
+		}
+	}
+
+	void Datum::MarkModified()
+	{
+		++mVersion;
+		mChangeFrame = Scope::ChangeFrame();
+		if (mOwner != nullptr)
+		{
+			mOwner->MarkModified();
+		}
+	}
+
+	void Datum::CopyStorage(size_t capacity)
+	{
+		const size_t typeSize = DataTypeSizes[static_cast<size_t>(mType)];
+		void* block = malloc(StorageHeaderSize + capacity * typeSize);
+		assert(block != nullptr);
+		new(block) ReferenceCount(1);
+		uint8_t* data = static_cast<uint8_t*>(block) + StorageHeaderSize;
+
+		if (mType == DatumTypes::String)
+		{
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				new(reinterpret_cast<std::string*>(data) + i) std::string(mData.s[i]);
+			}
+		}
+		else
+		{
+			std::memcpy(data, mData.b, mSize * typeSize);
+		}
+
+		ReleaseStorage();
+		mData.b = data;
+		mCapacity = capacity;
+	}
+
+	void Datum::ReleaseStorage()
+	{
+		if (mIsExternal || mData.vo == nullptr)
+		{
+			return;
+		}
+
+		if (References().fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			if (mType == DatumTypes::String)
+			{
+				for (size_t i = 0; i < mSize; ++i)
+				{
+					mData.s[i].~basic_string();
+				}
+			}
+
+			free(mData.b - StorageHeaderSize);
+		}
+
+		mData.vo = nullptr;
+		mCapacity = 0;
+	}
+
 #pragma endregion
 }
 
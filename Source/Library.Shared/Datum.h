@@ -8,6 +8,8 @@
 #include <gsl/gsl>
 #include <glm/glm.hpp>
 #include <cstdint>
+#include <cstddef>
+#include <atomic>
 #include <RTTI.h>
 
 #pragma warning( push )
@@ -143,7 +145,8 @@ namespace Library
 		Datum(std::initializer_list<RTTIPointer> list, ReserveStrategy reserveStategy = DefaultRerserveStrategy());
 
 		/// <summary>
-		/// Copy constructor for Datum. Shallow copies unless of type String in which case it deep copies
+		/// Copy constructor for Datum. Internal storage of every type but Table is shared with rhs until either Datum is written to, at which point the writer takes its own copy.
+		/// External storage and Tables are shallow copied
 		/// </summary>
 		/// <param name="rhs">The Datum whose data should be copied into this Datum</param>
 		Datum(const Datum& rhs);
@@ -163,7 +166,8 @@ namespace Library
 #pragma region AssigmentOperators
 
 		/// <summary>
-		/// Copy assignment operator. Shallow copies unless of type String in which case it deep copies
+		/// Copy assignment operator. Internal storage of every type but Table is shared with rhs until either Datum is written to, at which point the writer takes its own copy.
+		/// External storage and Tables are shallow copied
 		/// </summary>
 		/// <param name="rhs">The Datum whose data should be copied into this Datum</param>
 		/// <returns>A reference to this Datum after its mutation</returns>
@@ -272,6 +276,13 @@ namespace Library
 		/// <returns>True if the datums are not equivalent, false otherwise</returns>
 		bool operator!=(const Datum& rhs) const;
 
+		/// <summary>
+		/// Hashes the type and contents of the datum, so that equal datums have equal hashes. Tables hash the structure of their Scopes.
+		/// Pointers only contribute their count, since their equality is up to RTTI::Equals and the objects they point to can change without this datum knowing
+		/// </summary>
+		/// <returns>The structural hash of the datum</returns>
+		size_t Hash() const;
+
 		/// <summary>
 		/// Scalar equality operator. Compares this datum to a scalar value. 
 		/// Will not compile if you try to call this method with an unsupported data type.
@@ -323,6 +334,28 @@ namespace Library
 		/// </summary>
 		/// <returns>True if the datum has external storage, false otherwise</returns>
 		bool IsExternalStorage() const;
+		/// <summary>
+		/// Tells the user whether this datum shares its internal storage with a copy that neither has written to yet
+		/// </summary>
+		/// <returns>True if the storage is shared, false otherwise</returns>
+		bool IsSharedStorage() const;
+
+		/// <summary>
+		/// Returns the number of times this datum has been written to. Every mutating method counts, including Clear, assignment, Set and Edit.
+		/// The non-const getters, Find and Span don't count, so writes through the references they return are not seen unless reported with MarkModified. Write through Edit or Set instead
+		/// </summary>
+		/// <returns>The modification count of this datum</returns>
+		size_t Version() const;
+		/// <summary>
+		/// Returns the Scope change frame this datum was last written to in, or 0 if it never was.
+		/// </summary>
+		/// <returns>The change frame of the last write</returns>
+		size_t ChangeFrame() const;
+		/// <summary>
+		/// Records a write that bypassed this datum, such as one made directly to the member behind external storage.
+		/// Bumps the version, stamps the current change frame and marks the owning Scope modified. The mutating methods of the datum call this on their own
+		/// </summary>
+		void MarkModified();
 
 		/// <summary>
 		/// Tells whether the datum contains any data or not
@@ -365,6 +398,32 @@ namespace Library
 		template<typename T>
 		const T* Find(const T& value) const;
 
+		/// <summary>
+		/// Returns a view over every element of the datum. The view's iterators are contiguous, so the data can be handed directly to the standard and parallel algorithms.
+		/// </summary>
+		/// <returns>A span of the datums elements</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if T is not the type of the datum</exception>
+		template<typename T>
+		gsl::span<T> Span();
+
+		/// <summary>
+		/// Returns a read only view over every element of the datum.
+		/// </summary>
+		/// <returns>A span of the datums elements</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if T is not the type of the datum</exception>
+		template<typename T>
+		gsl::span<const T> Span() const;
+
+		/// <summary>
+		/// Gets a reference to the element at the passed in index for writing. Unlike the getters, this marks the datum and its owning Scope modified,
+		/// so writes through the reference are seen by change tracking and the cached hash of the Scope. Writes through a getter have to be reported with MarkModified.
+		/// </summary>
+		/// <param name="index">The index of the data to return a reference to</param>
+		/// <returns>A reference to the element contained at the given index</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if the index is outside the datums range, or if T is not the type of the datum</exception>
+		template<typename T>
+		T& Edit(size_t index = 0);
+
 		/// <summary>
 		/// Gets a reference to the integer contained at the passed in index.
 		/// </summary>
@@ -496,6 +555,14 @@ namespace Library
 		template<typename T>
 		void Set(const T& data, size_t index);
 
+		/// <summary>
+		/// Moves the passed in r-value string into the passed in index
+		/// </summary>
+		/// <param name="data">The new string to be moved into the specified index</param>
+		/// <param name="index">The index of where the new data is being set to</param>
+		/// <exception cref="std::runtime_error">Throws an exception if this datum does not hold strings or the index is out of range</exception>
+		void Set(std::string&& data, size_t index);
+
 		/// <summary>
 		/// Pushes the user passed data into the datum at the back of the datums data. Will increase the capacity of the datum if it is already filled.
 		/// Uses a default or user defined reserve strategy for increasing capacity
@@ -506,6 +573,23 @@ namespace Library
 		template<typename T>
 		void PushBack(const T& value);
 
+		/// <summary>
+		/// Moves the passed in r-value string into the back of the datums data. Will increase the capacity of the datum if it is already filled.
+		/// </summary>
+		/// <param name="value">The string to be moved into the datum</param>
+		/// <exception cref="std::runtime_error">Throws an exception if this datum does not hold strings</exception>
+		void PushBack(std::string&& value);
+
+		/// <summary>
+		/// Constructs a new element of type T in place at the back of the datums data from the passed in arguments.
+		/// Will increase the capacity of the datum if it is already filled.
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>A reference to the newly constructed element</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if T is a different type than what this datum can hold</exception>
+		template<typename T, typename... Args>
+		T& EmplaceBack(Args&&... args);
+
 		/// <summary>
 		/// Converts the string passed in into data of the current datums type and sets the data at the passed in index to that converted string data.
 		/// </summary>
@@ -544,7 +628,7 @@ namespace Library
 
 		/// <summary>
 		/// If the datum is external storage, clear will nullify the data pointer and set capacity and size to 0 and set the datum to not be external anymore.
-		/// If the datum is internal storage, clear will destruct any allocated memory and set size to 0. Will not affect capacity
+		/// If the datum is internal storage, clear will destruct any allocated memory and set size to 0. Will not affect capacity unless the storage was shared, in which case it is released
 		/// </summary>
 		void Clear();
 
@@ -554,6 +638,11 @@ namespace Library
 		
 	private:
 
+		/// <summary>
+		/// The type of the count of datums sharing one block of internal storage
+		/// </summary>
+		using ReferenceCount = std::atomic<size_t>;
+
 #pragma region PrivateSpecializations
 		/// <summary>
 		/// Private PushBack for adding new Scopes to the end of the Datum.
@@ -619,11 +708,35 @@ namespace Library
 		Datum& AssignmentHelper(std::initializer_list<T> list);
 
 		/// <summary>
-		/// Helper function for copy semantics. Does a deep copy of the passed in datum into this datum.
+		/// Helper function for copy semantics. Shares the internal storage of the passed in datum, or shallow copies its external storage or Scope pointers.
 		/// </summary>
 		/// <param name="rhs">The datum to be copied</param>
 		void CopyHelper(const Datum& rhs);
 
+		/// <summary>
+		/// Returns the reference count stored in the header in front of the internal storage.
+		/// </summary>
+		/// <returns>The number of datums sharing the internal storage</returns>
+		ReferenceCount& References() const;
+		/// <summary>
+		/// Called by every method that mutates the data. Gives this datum its own copy of its storage if it is shared, and marks it modified.
+		/// </summary>
+		void BeginWrite();
+		/// <summary>
+		/// Called by every method that hands out a mutable reference to an element. Gives this datum its own copy of its storage if it is shared,
+		/// so a write through the reference never reaches the datums sharing it, without counting as a write itself.
+		/// </summary>
+		void Detach();
+		/// <summary>
+		/// Copies the elements of this datum into newly allocated storage of the given capacity and releases the old storage.
+		/// </summary>
+		/// <param name="capacity">The capacity of the new storage</param>
+		void CopyStorage(size_t capacity);
+		/// <summary>
+		/// Drops the reference of this datum to its internal storage, destructing the elements and freeing the storage if it was the last one.
+		/// </summary>
+		void ReleaseStorage();
+
 		/// <summary>
 		/// Templated ToStringHelper that is called by the ToString method which returns a string representation of the data contained at the passed in index.
 		/// </summary>
@@ -671,6 +784,12 @@ namespace Library
 #pragma endregion
 
 #pragma region LookUpTables
+		/// <summary>
+		/// The number of bytes in front of internal storage that hold its ReferenceCount. Keeps the elements aligned like any other allocation
+		/// </summary>
+		static constexpr size_t StorageHeaderSize = alignof(std::max_align_t);
+		static_assert(sizeof(ReferenceCount) <= StorageHeaderSize);
+
 		/// <summary>
 		/// A look up table for data sizes based upon what type a datum is set to
 		/// </summary>
@@ -782,6 +901,18 @@ namespace Library
 		/// </summary>
 		bool mIsExternal{ false };
 		/// <summary>
+		/// The Scope whose attribute this datum is, told about every change so it can discard its cached hash. Not copied or moved with the data
+		/// </summary>
+		Scope* mOwner{ nullptr };
+		/// <summary>
+		/// The number of times this datum has been written to
+		/// </summary>
+		size_t mVersion{ 0 };
+		/// <summary>
+		/// The Scope change frame of the last write
+		/// </summary>
+		size_t mChangeFrame{ 0 };
+		/// <summary>
 		/// The number of elements contained within this datum
 		/// </summary>
 		size_t mSize{ 0 };
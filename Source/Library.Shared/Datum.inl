@@ -24,6 +24,20 @@ namespace Library
 
 	template<typename T>
 	inline T* Datum::Find(const T& value)
+	{
+		const T* found = std::as_const(*this).Find(value);
+		if (found == nullptr)
+		{
+			return nullptr;
+		}
+
+		const size_t index = found - reinterpret_cast<const T*>(mData.vo);
+		Detach();
+		return reinterpret_cast<T*>(mData.vo) + index;
+	}
+
+	template<typename T>
+	inline const T* Datum::Find(const T& value) const
 	{
 		static_assert(TypeOf<T>() != DatumTypes::Unknown
 			|| TypeOf<T>() != DatumTypes::Size
@@ -33,7 +47,7 @@ namespace Library
 
 		for (size_t i = 0; i < mSize; ++i)
 		{
-			T& data = reinterpret_cast<T*>(mData.vo)[i];
+			const T& data = reinterpret_cast<const T*>(mData.vo)[i];
 			if (DataTypeEquality[static_cast<size_t>(mType) - 1](&data, &(value)))
 			{
 				return &data;
@@ -44,9 +58,32 @@ namespace Library
 	}
 
 	template<typename T>
-	inline const T* Datum::Find(const T& value) const
+	inline gsl::span<T> Datum::Span()
 	{
-		return const_cast<Datum*>(this)->Find(value);
+		std::as_const(*this).Span<T>();
+		Detach();
+		return gsl::span<T>(reinterpret_cast<T*>(mData.vo), mSize);
+	}
+
+	template<typename T>
+	inline gsl::span<const T> Datum::Span() const
+	{
+		static_assert(TypeOf<T>() != DatumTypes::Unknown, "Cannot create a span of an unsupported Datum type");
+
+		if (TypeOf<T>() != mType)
+		{
+			throw std::runtime_error("Can't create a span of a different type than the Datum");
+		}
+
+		return gsl::span<const T>(reinterpret_cast<const T*>(mData.vo), mSize);
+	}
+
+	template<typename T>
+	inline T& Datum::Edit(size_t index)
+	{
+		T& data = GetHelper<T>(index);
+		MarkModified();
+		return data;
 	}
 
 	template<typename T>
@@ -59,6 +96,7 @@ namespace Library
 			"Cannot set storage with unsupported Datum type");
 
 		SetType(TypeOf<T>());
+		MarkModified();
 		mIsExternal = true;
 		mData.vo = data;
 		mSize = size;
@@ -80,19 +118,24 @@ namespace Library
 			throw std::runtime_error("Can't set data of a different type than the Datum. Or index is out of range");
 		}
 
-		T& dataToSet = GetHelper<T>(index);
-		dataToSet = data;
+		Edit<T>(index) = data;
 	}
 
 	template<typename T>
-	void Datum::PushBack(const T& value)
+	inline void Datum::PushBack(const T& value)
+	{
+		EmplaceBack<T>(value);
+	}
+
+	template<typename T, typename... Args>
+	T& Datum::EmplaceBack(Args&&... args)
 	{
 		static_assert(TypeOf<T>() != DatumTypes::Unknown
 			|| TypeOf<T>() != DatumTypes::Size
 			|| TypeOf<T>() != DatumTypes::Begin
 			|| TypeOf<T>() != DatumTypes::End
 			|| TypeOf<T>() != DatumTypes::Table,
-			"Cannot preform PushBack on unsupported DatumTypes");
+			"Cannot preform EmplaceBack on unsupported DatumTypes");
 
 		if (mIsExternal)
 		{
@@ -109,12 +152,13 @@ namespace Library
 			throw std::runtime_error("You can't push data that is not of the same type as this datum");
 		}
 
+		BeginWrite();
 		if (mSize >= mCapacity)
 		{
 			Reserve(std::max(mCapacity + 1, mReserveStrategy(mSize, mCapacity)));
 		}
 
-		new(reinterpret_cast<T*>(mData.vo) + mSize++) T(value);
+		return *new(reinterpret_cast<T*>(mData.vo) + mSize++) T(std::forward<Args>(args)...);
 	}
 
 	template<typename T>
@@ -138,6 +182,7 @@ namespace Library
 			return false;
 		}
 
+		MarkModified();
 		if (mType == DatumTypes::String)
 		{
 			itemToDelete->~T();
@@ -163,6 +208,7 @@ namespace Library
 			SetType(DatumTypes::Table);
 		}
 
+		BeginWrite();
 		if (mSize >= mCapacity)
 		{
 			Reserve(std::max(mCapacity + 1, mReserveStrategy(mSize, mCapacity)));
@@ -179,12 +225,14 @@ namespace Library
 			throw std::runtime_error("Index is out of range");
 		}
 
+		BeginWrite();
 		mData.t[index] = &const_cast<Scope&>(data);
 	}
 
 	template<>
 	inline void Datum::SetStorage(void* data, size_t size)
 	{
+		MarkModified();
 		mIsExternal = true;
 		mData.vo = data;
 		mSize = size;
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <string_view>
 
 namespace Library
 {
@@ -48,4 +50,19 @@ namespace Library
 			return strcmp(lhs, rhs) == 0;
 		}
 	};
+
+	/// <summary>
+	/// Compares two strings ignoring the case of their ASCII letters, without making lowercase copies of them. Pair with CaseInsensitiveHash
+	/// </summary>
+	struct CaseInsensitiveEquality final
+	{
+		bool operator()(std::string_view lhs, std::string_view rhs) const
+		{
+			return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char lhsCharacter, char rhsCharacter)
+			{
+				auto toLower = [](char character) { return character >= 'A' && character <= 'Z' ? static_cast<char>(character - 'A' + 'a') : character; };
+				return toLower(lhsCharacter) == toLower(rhsCharacter);
+			});
+		}
+	};
 }
\ No newline at end of file
@@ -13,4 +13,32 @@ namespace Library
 
 		return hashValue;
 	}
+
+	size_t OrderedHash(const uint8_t* data, size_t size)
+	{
+		uint64_t hashValue = 14695981039346656037ull;
+		for (size_t i = 0; i < size; i++)
+		{
+			hashValue = (hashValue ^ data[i]) * 1099511628211ull;
+		}
+
+		return static_cast<size_t>(hashValue);
+	}
+
+	size_t CombineHash(size_t seed, size_t value)
+	{
+		return seed ^ (value + static_cast<size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2));
+	}
+
+	size_t CaseInsensitiveHash::operator()(std::string_view key) const
+	{
+		uint64_t hashValue = 14695981039346656037ull;
+		for (char character : key)
+		{
+			const uint8_t byte = static_cast<uint8_t>(character >= 'A' && character <= 'Z' ? character - 'A' + 'a' : character);
+			hashValue = (hashValue ^ byte) * 1099511628211ull;
+		}
+
+		return static_cast<size_t>(hashValue);
+	}
 }
\ No newline at end of file
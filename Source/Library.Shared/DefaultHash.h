@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 namespace Library
@@ -9,12 +10,46 @@ namespace Library
 
 	size_t AdditiveHash(const uint8_t* data, size_t size);
 
+	/// <summary>
+	/// FNV-1a hash of the bytes. Unlike AdditiveHash it depends on their order, so it can tell apart values with the same bytes in a different order
+	/// </summary>
+	/// <param name="data">The bytes to hash</param>
+	/// <param name="size">The number of bytes</param>
+	/// <returns>The hash of the bytes</returns>
+	size_t OrderedHash(const uint8_t* data, size_t size);
+
+	/// <summary>
+	/// Mixes a hash into a running hash, for building the hash of a value out of the hashes of its parts.
+	/// </summary>
+	/// <param name="seed">The hash so far</param>
+	/// <param name="value">The hash being added to it</param>
+	/// <returns>The combined hash</returns>
+	size_t CombineHash(size_t seed, size_t value);
+
+	/// <summary>
+	/// Hashes a string as if its ASCII letters were lowercase, without making a lowercase copy of it. Pair with CaseInsensitiveEquality
+	/// </summary>
+	struct CaseInsensitiveHash final
+	{
+		size_t operator()(std::string_view key) const;
+	};
+
 	template<typename T>
 	struct DefaultHash final
 	{
 		size_t operator()(const T& key) const;
 	};
 
+	/// <summary>
+	/// Hashes a pointer by its address rather than the bytes of the address summed together, which collide for nearby allocations.
+	/// Strings of chars keep their own specializations below
+	/// </summary>
+	template<typename T>
+	struct DefaultHash<T*> final
+	{
+		size_t operator()(T* key) const;
+	};
+
 	template<>
 	struct DefaultHash<std::string> final
 	{
@@ -27,6 +62,12 @@ namespace Library
 		size_t operator()(const std::string& key) const;
 	};
 
+	template<>
+	struct DefaultHash<std::string_view> final
+	{
+		size_t operator()(std::string_view key) const;
+	};
+
 	template<>
 	struct DefaultHash<std::wstring> final
 	{
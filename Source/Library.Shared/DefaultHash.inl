@@ -11,6 +11,13 @@ namespace Library
 		return AdditiveHash(data, sizeof(T));
 	}
 
+	template<typename T>
+	inline size_t DefaultHash<T*>::operator()(T* key) const
+	{
+		// HashMap bucket counts are odd, so the alignment zeros at the bottom of the address don't leave buckets unused
+		return reinterpret_cast<size_t>(key);
+	}
+
 	inline size_t DefaultHash<std::string>::operator()(const std::string& key) const
 	{
 		const uint8_t* data = reinterpret_cast<const uint8_t*>(key.c_str());
@@ -23,6 +30,12 @@ namespace Library
 		return AdditiveHash(data, key.length());
 	}
 
+	inline size_t DefaultHash<std::string_view>::operator()(std::string_view key) const
+	{
+		const uint8_t* data = reinterpret_cast<const uint8_t*>(key.data());
+		return AdditiveHash(data, key.length());
+	}
+
 	inline size_t DefaultHash<std::wstring>::operator()(const std::wstring& key) const
 	{
 		const uint8_t* data = reinterpret_cast<const uint8_t*>(key.c_str());
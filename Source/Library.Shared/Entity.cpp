@@ -7,11 +7,7 @@ namespace Library
 
 	const Library::Vector<Signature> Entity::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{ "Name"s, Datum::DatumTypes::String, true, 1, offsetof(Entity, mName) },
-			{ "Actions"s, Datum::DatumTypes::Table, false, 1, 0 },
-		};
+		return AttributeReflection::Signatures<Entity>();
 	}
 
 	Entity::Entity() : Attributed(this->TypeIdClass()) {}
@@ -41,7 +37,7 @@ namespace Library
 		{
 			Scope* scopeEntity;
 			assert(GetSector() != nullptr);
-			Datum& entities = GetSector()->Entities();
+			const Datum& entities = std::as_const(*GetSector()).Entities();
 
 			for (size_t i = 0; i < entities.Size(); ++i)
 			{
@@ -98,6 +94,7 @@ namespace Library
 	void Entity::SetName(const std::string& name)
 	{
 		mName = name;
+		MarkModified("Name");
 	}
 
 	Sector* Entity::GetSector() const
@@ -118,10 +115,11 @@ namespace Library
 
 	void Entity::Update(WorldState& state) 
 	{
-		for (size_t i = 0; i < Actions().Size(); i++)
+		const Datum& actions = std::as_const(*this).Actions();
+		for (size_t i = 0; i < actions.Size(); i++)
 		{
-			assert(Actions().GetScope(i)->Is(Action::TypeIdClass()));
-			Action* action = static_cast<Action*>(Actions().GetScope(i));
+			assert(actions.GetScope(i)->Is(Action::TypeIdClass()));
+			Action* action = static_cast<Action*>(actions.GetScope(i));
 			state.Action = action;
 			action->Update(state);
 			state.Action = nullptr;
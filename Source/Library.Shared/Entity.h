@@ -1,5 +1,6 @@
 #pragma once
 #include "Attributed.h"
+#include "AttributeReflection.h"
 #include "Sector.h"
 #include "WorldState.h"
 #include "Action.h"
@@ -22,6 +23,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Name", Entity, mName),
+				PrescribeInternal("Actions", Datum::DatumTypes::Table)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor.
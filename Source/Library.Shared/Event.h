@@ -1,6 +1,7 @@
 #pragma once
 #include "EventPublisher.h"
 #include <mutex>
+#include <shared_mutex>
 #include <future>
 #include <thread>
 
@@ -108,12 +109,13 @@ namespace Library
 		/// <summary>
 		/// Static list of subscribers to this type of event
 		/// </summary>
-		inline static Vector<EventSubscriber*> Subscribers;
+		inline static SubscriberList Subscribers;
 
 		/// <summary>
-		/// Mutex that locks access to the shared data of the Event.
+		/// Reader/writer lock guarding the shared data of the Event. Deliveries only read the subscriber list, so events of the
+		/// same type published from different threads do not serialize on each other.
 		/// </summary>
-		inline static std::mutex Mutex;
+		inline static std::shared_mutex Mutex;
 
 		/// <summary>
 		/// The payload message that will be sent when this event fires off.
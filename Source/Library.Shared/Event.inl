@@ -10,7 +10,7 @@ namespace Library
 	template<typename T>
 	inline void Event<T>::Subscribe(EventSubscriber& subscriber)
 	{
-		scoped_lock<mutex> lock(Mutex);
+		unique_lock<shared_mutex> lock(Mutex);
 
 		if (Subscribers.Find(&subscriber) != Subscribers.end())
 		{
@@ -22,14 +22,14 @@ namespace Library
 	template<typename T>
 	inline void Event<T>::Unsubscribe(EventSubscriber& subscriber)
 	{
-		scoped_lock<mutex> lock(Mutex);
+		unique_lock<shared_mutex> lock(Mutex);
 		Subscribers.Remove(&subscriber);
 	}
 
 	template<typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
-		scoped_lock<mutex> lock(Mutex);
+		unique_lock<shared_mutex> lock(Mutex);
 		Subscribers.Clear();
 		Subscribers.ShrinkToFit();
 	}
@@ -37,14 +37,14 @@ namespace Library
 	template<typename T>
 	inline void Event<T>::ShrinkSubscribersToFit()
 	{
-		scoped_lock<mutex> lock(Mutex);
+		unique_lock<shared_mutex> lock(Mutex);
 		Subscribers.ShrinkToFit();
 	}
 
 	template<typename T>
 	inline size_t Event<T>::NumSubscribers()
 	{
-		scoped_lock<mutex> lock(Mutex);
+		shared_lock<shared_mutex> lock(Mutex);
 		return Subscribers.Size();
 	}
 
@@ -7,7 +7,7 @@ namespace Library
 
 	const Vector<Signature> EventMessageAttributed::GetSignatures()
 	{
-		return Vector<Signature>();
+		return AttributeReflection::Signatures<EventMessageAttributed>();
 	}
 
 	EventMessageAttributed::EventMessageAttributed(const std::string& subtype, World& world) :
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Attributed.h"
+#include "AttributeReflection.h"
 #include "World.h"
 
 namespace Library
@@ -16,6 +17,14 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array<PrescribedAttribute, 0>();
+		}
 
 		/// <summary>
 		/// Default constructor. Takes in a string subtype and a reference to the world this message lives in.
@@ -9,7 +9,7 @@ namespace Library
 {
 	RTTI_DEFINITIONS(EventPublisher)
 
-	EventPublisher::EventPublisher(Vector<EventSubscriber*>& subscribers, std::mutex& eventMutex) :
+	EventPublisher::EventPublisher(SubscriberList& subscribers, std::shared_mutex& eventMutex) :
 		mSubscribers(&subscribers), mMutex(&eventMutex)
 	{
 	}
@@ -19,7 +19,7 @@ namespace Library
 		vector<future<void>> threads;
 		
 		{
-			scoped_lock<mutex> lock(*mMutex);
+			shared_lock<shared_mutex> lock(*mMutex);
 
 			for (EventSubscriber* subscriber : *mSubscribers)
 			{
@@ -2,10 +2,11 @@
 
 #include <chrono>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <future>
 #include "RTTI.h"
-#include "Vector.h"
+#include "SmallVector.h"
 #include "EventSubscriber.h"
 
 namespace Library
@@ -17,6 +18,10 @@ namespace Library
 		RTTI_DECLARATIONS(EventPublisher, RTTI)
 		
 	public:
+		/// <summary>
+		/// The container of subscribers for a single event type. Events rarely have more than a few subscribers, so they are stored inline
+		/// </summary>
+		using SubscriberList = SmallVector<EventSubscriber*, 4>;
 
 		/// <summary>
 		/// Virtual default destructor. 
@@ -34,7 +39,7 @@ namespace Library
 		/// </summary>
 		/// <param name="subscribers">The list of EventSubscribers</param>
 		/// <param name="eventMutex">The mutex for the EventSubscriber to lock async calls</param>
-		EventPublisher(Vector<EventSubscriber*>& subscribers, std::mutex& eventMutex);
+		EventPublisher(SubscriberList& subscribers, std::shared_mutex& eventMutex);
 		/// <summary>
 		/// Default copy constructor.
 		/// </summary>
@@ -66,12 +71,12 @@ namespace Library
 		/// <summary>
 		/// A vector that contains all the subscribers to this EventPublisher.
 		/// </summary>
-		Vector<EventSubscriber*>* mSubscribers;
+		SubscriberList* mSubscribers;
 
 		/// <summary>
 		/// Mutex used to lock access to the shared resources of the EventPublisher.
 		/// </summary>
-		mutable std::mutex* mMutex;
+		mutable std::shared_mutex* mMutex;
 	};
 }
 
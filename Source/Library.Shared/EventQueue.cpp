@@ -1,6 +1,6 @@
 #include "pch.h"
 #include "EventQueue.h"
-#include <algorithm>
+#include "ParallelAlgorithms.h"
 #include <vector>
 
 using namespace std;
@@ -46,7 +46,7 @@ namespace Library
 		{
 			scoped_lock<mutex> lock(mMutex);
 
-			auto expiredIt = std::partition(mEventQueue.begin(), mEventQueue.end(), [&gameTime](QueueFrame frame) { return (gameTime.CurrentTime() < frame.ExpiredTime); });
+			auto expiredIt = ParallelPartition(mEventQueue.begin(), mEventQueue.end(), [&gameTime](const QueueFrame& frame) { return (gameTime.CurrentTime() < frame.ExpiredTime); });
 			auto it = expiredIt;
 
 			while (it != mEventQueue.end())
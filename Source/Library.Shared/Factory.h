@@ -2,20 +2,85 @@
 
 #include <string>
 #include <memory>
+#include <atomic>
+#include <type_traits>
 #include <gsl/gsl>
-#include "HashMap.h"
+#include "ConcurrentHashMap.h"
+#include "Vector.h"
+#include "RecyclingPool.h"
 
 namespace Library
 {
+	/// <summary>
+	/// True if TConcrete provides a static NewBatch, such as Scope::NewBatch, that constructs several instances in one allocation which can still be deleted one at a time
+	/// </summary>
+	template<typename TConcrete, typename TProduct, typename = void>
+	struct SupportsBatchAllocation : std::false_type {};
+
+	template<typename TConcrete, typename TProduct>
+	struct SupportsBatchAllocation<TConcrete, TProduct, std::void_t<decltype(TConcrete::template NewBatch<TConcrete>(size_t(), std::declval<Vector<TProduct*>&>()))>> : std::true_type {};
+
 	template<typename T>
 	class Factory
 	{
 #pragma region FactoryManager
 
 	public:
+		/// <summary>
+		/// A class name bound once and kept for later calls to Create and CreateBatch, which only read it and can share a handle between threads.
+		/// Get caches the factory it finds and looks the name up again only when the set of registered factories changes, so it is used by one thread at a time
+		/// </summary>
+		class Handle final
+		{
+		public:
+			/// <summary>
+			/// Constructs a handle bound to no class
+			/// </summary>
+			Handle() = default;
+			/// <summary>
+			/// Constructs a handle bound to the passed in class name. The factory is looked up on first use
+			/// </summary>
+			/// <param name="className">The name of the class whose factory the handle finds</param>
+			explicit Handle(std::string className);
+			Handle(const Handle&) = default;
+			Handle(Handle&&) noexcept = default;
+			Handle& operator=(const Handle&) = default;
+			Handle& operator=(Handle&&) noexcept = default;
+			~Handle() = default;
+
+			/// <summary>
+			/// Returns the factory of the class, looking it up only if factories were added or removed since it was last found.
+			/// Nothing stops another thread from removing the factory while the pointer is held, create through Factory::Create(const Handle&) instead
+			/// </summary>
+			/// <returns>A pointer to the factory, or nullptr if no factory is registered for the class</returns>
+			const Factory* Get() const;
+			/// <summary>
+			/// Binds the handle to the passed in class name if it isn't already, then returns its factory.
+			/// </summary>
+			/// <param name="className">The name of the class whose factory the handle finds</param>
+			/// <returns>A pointer to the factory, or nullptr if no factory is registered for the class</returns>
+			const Factory* Get(const std::string& className);
+			/// <summary>
+			/// Returns the name of the class the handle is bound to
+			/// </summary>
+			/// <returns>The class name</returns>
+			const std::string& ClassName() const;
+
+		private:
+			std::string mClassName;
+			/// <summary>
+			/// The factory last found for the class
+			/// </summary>
+			mutable const Factory* mFactory = nullptr;
+			/// <summary>
+			/// The registry generation mFactory was found in. 0 if it was never looked up
+			/// </summary>
+			mutable size_t mGeneration = 0;
+		};
+
 
 		/// <summary>
-		/// Given a class name it returns the associated factory. Runs in constant time.
+		/// Given a class name it returns the associated factory. Runs in constant time and is safe to call from any thread.
 		/// </summary>
 		/// <param name="name">The class name of the factory being looked for</param>
 		/// <returns>A pointer to the factory associated with that class name. Returns nullptr if no factory was found.</returns>
@@ -23,10 +88,42 @@ namespace Library
 
 		/// <summary>
 		/// Given a class name it returns a new object of that type created from the associated factory.
+		/// Safe to call from any thread. The factory cannot be unregistered while it is creating the object.
 		/// </summary>
 		/// <param name="name">The class name of the object being created</param>
 		/// <returns>A pointer of the abstract product type that points to a newly created concrete product object</returns>
 		static gsl::owner<T*> Create(const std::string& name);
+		/// <summary>
+		/// Returns a new object created by the factory of the class the handle is bound to.
+		/// Safe to call from any thread. The factory cannot be unregistered while it is creating the object.
+		/// </summary>
+		/// <param name="handle">The handle of the factory</param>
+		/// <returns>A pointer to the new object, or nullptr if no factory is registered for the class of the handle</returns>
+		static gsl::owner<T*> Create(const Handle& handle);
+
+		/// <summary>
+		/// Given a class name it returns several new objects of that type, created with one lookup and, if the type supports it, one allocation.
+		/// </summary>
+		/// <param name="name">The class name of the objects being created</param>
+		/// <param name="count">The number of objects to create</param>
+		/// <returns>The new objects, or an empty Vector if no factory was found. The caller deletes each of them</returns>
+		static Vector<gsl::owner<T*>> CreateBatch(const std::string& name, size_t count);
+		/// <summary>
+		/// Returns several new objects created by the factory of the class the handle is bound to, with one allocation if the type supports it.
+		/// Safe to call from any thread. The factory cannot be unregistered while it is creating the objects.
+		/// </summary>
+		/// <param name="handle">The handle of the factory</param>
+		/// <param name="count">The number of objects to create</param>
+		/// <returns>The new objects, or an empty Vector if no factory is registered for the class of the handle. The caller deletes each of them</returns>
+		static Vector<gsl::owner<T*>> CreateBatch(const Handle& handle, size_t count);
+
+		/// <summary>
+		/// Hands an object that is no longer used back to the factory of its exact type, which resets it and keeps it for a later Create.
+		/// Only factories made with RecyclingConcreteFactory keep objects. Safe to call from any thread
+		/// </summary>
+		/// <param name="product">The heap allocated object, which must not be part of a hierarchy</param>
+		/// <returns>True if a factory took ownership of the object. False if the caller still owns it and has to delete it</returns>
+		static bool Recycle(gsl::owner<T*> product);
 
 		/// <summary>
 		/// Resizes the internal HashMap. Should be called before adding new factories so that the buckets of the HashMap don't have too many collisions. 
@@ -40,10 +137,10 @@ namespace Library
 		static void Clear();
 
 		/// <summary>
-		/// Returns a const reference of the internal HashMap of factories.
+		/// Returns a const reference of the internal map of factories.
 		/// </summary>
-		/// <returns>Const reference to the internal HashMap</returns>
-		static const HashMap<std::string, const Factory<T>&>& Factories();
+		/// <returns>Const reference to the internal map</returns>
+		static const ConcurrentHashMap<std::string, const Factory<T>&>& Factories();
 
 	protected:
 
@@ -61,9 +158,42 @@ namespace Library
 		static void Remove(const Factory& factory);
 
 		/// <summary>
-		/// The factories being managed by this class. The HashMap is used for quick look up based on string class names.
+		/// Registers a factory as the one that recycles objects of the passed in type.
+		/// </summary>
+		/// <param name="factory">A const reference to the factory</param>
+		/// <param name="typeId">The RTTI type id of the objects it recycles</param>
+		static void AddRecycler(const Factory& factory, size_t typeId);
+
+		/// <summary>
+		/// Unregisters the factory that recycles objects of the passed in type.
+		/// </summary>
+		/// <param name="typeId">The RTTI type id of the objects it recycles</param>
+		static void RemoveRecycler(size_t typeId);
+
+		/// <summary>
+		/// Creates objects of the concrete type for CreateBatch, in one allocation if the type provides a NewBatch and one by one otherwise.
 		/// </summary>
-		static HashMap<std::string, const Factory&> mFactories;
+		/// <typeparam name="TConcrete">The concrete product type</typeparam>
+		/// <param name="count">The number of objects to create</param>
+		/// <returns>The new objects</returns>
+		template<typename TConcrete>
+		static Vector<gsl::owner<T*>> CreateContiguous(size_t count);
+
+		/// <summary>
+		/// The factories being managed by this class. The map is used for quick look up based on string class names.
+		/// It is sharded and locked per shard, since products are created from actions and event reactions running on worker threads.
+		/// </summary>
+		static ConcurrentHashMap<std::string, const Factory&> mFactories;
+
+		/// <summary>
+		/// The factories that recycle objects, keyed by the RTTI type id of their products so that recycling an object doesn't build its class name
+		/// </summary>
+		static ConcurrentHashMap<size_t, const Factory&> mRecyclers;
+
+		/// <summary>
+		/// Incremented whenever a factory is added or removed, which tells handles that their factory may have changed
+		/// </summary>
+		inline static std::atomic<size_t> sGeneration{ 1 };
 
 #pragma endregion FactoryManager
 
@@ -92,6 +222,21 @@ namespace Library
 		/// <exception cref="std::runtime_error">Thros an exception if you try to call Create with a factory that is not registered.</exception>
 		virtual gsl::owner<T*> Create() const = 0;
 
+		/// <summary>
+		/// Creates several objects of the Concrete Product. Factories made with ConcreteFactory create Scopes in one contiguous allocation,
+		/// other factories call Create for each of them.
+		/// </summary>
+		/// <param name="count">The number of objects to create</param>
+		/// <returns>The new objects. The caller deletes each of them</returns>
+		virtual Vector<gsl::owner<T*>> CreateBatch(size_t count) const;
+
+		/// <summary>
+		/// Takes back an object created by this factory to reuse it. Factories that don't recycle their products refuse it.
+		/// </summary>
+		/// <param name="product">The object to recycle</param>
+		/// <returns>True if the factory took ownership of the object, false otherwise</returns>
+		virtual bool RecycleProduct(gsl::owner<T*> product) const;
+
 		/// <summary>
 		/// Returns a string representation of the Concrete Product Class that this factory creates.
 		/// </summary>
@@ -136,11 +281,72 @@ namespace Library
 			return new ConcreteProductType;														\
 		} 																						\
 																								\
+		Library::Vector<gsl::owner<AbstractProductType*>> CreateBatch(size_t count) const override	\
+		{																						\
+			return CreateContiguous<ConcreteProductType>(count);								\
+		}																						\
+																								\
 		const std::string ClassName() const override											\
 		{																						\
 			return StringLit(ConcreteProductType)s;												\
 		} 																						\
 	};																							
+
+	/// <summary>
+	/// Macro to create Concrete Factory classes that keep the objects handed back to Factory::Recycle in a RecyclingPool and reuse them.
+	/// The ConcreteProductType must have RTTI and a Reset method that returns it to the state of a default constructed object.
+	/// </summary>
+#define RecyclingConcreteFactory(ConcreteProductType, AbstractProductType)						\
+	class ConcreteProductType##Factory final : public Library::Factory<AbstractProductType>		\
+	{																							\
+	public:																						\
+		ConcreteProductType##Factory()															\
+		{																						\
+			Factory<AbstractProductType>::Add(*this);											\
+			Factory<AbstractProductType>::AddRecycler(*this, ConcreteProductType::TypeIdClass());	\
+		}																						\
+																								\
+		~ConcreteProductType##Factory()															\
+		{																						\
+			Factory<AbstractProductType>::RemoveRecycler(ConcreteProductType::TypeIdClass());	\
+			Factory<AbstractProductType>::Remove(*this);										\
+		}																						\
+																								\
+		ConcreteProductType##Factory(ConcreteProductType##Factory&&) = delete;					\
+		ConcreteProductType##Factory & operator=(ConcreteProductType##Factory&&) = delete;		\
+		ConcreteProductType##Factory(const ConcreteProductType##Factory&) = delete;				\
+		ConcreteProductType##Factory& operator=(const ConcreteProductType##Factory&) = delete;	\
+																								\
+		gsl::owner<AbstractProductType*> Create() const override								\
+		{																						\
+			gsl::owner<ConcreteProductType*> product = mPool.Acquire();							\
+			return product != nullptr ? product : new ConcreteProductType;						\
+		} 																						\
+																								\
+		Library::Vector<gsl::owner<AbstractProductType*>> CreateBatch(size_t count) const override	\
+		{																						\
+			return CreateContiguous<ConcreteProductType>(count);								\
+		}																						\
+																								\
+		bool RecycleProduct(gsl::owner<AbstractProductType*> product) const override			\
+		{																						\
+			assert(product->Is(ConcreteProductType::TypeIdClass()));							\
+			return mPool.Release(static_cast<ConcreteProductType*>(product));					\
+		}																						\
+																								\
+		const std::string ClassName() const override											\
+		{																						\
+			return StringLit(ConcreteProductType)s;												\
+		} 																						\
+																								\
+		Library::RecyclingPool<ConcreteProductType>& Pool() const								\
+		{																						\
+			return mPool;																		\
+		}																						\
+																								\
+	private:																					\
+		mutable Library::RecyclingPool<ConcreteProductType> mPool;								\
+	};
 }
 
 #include "Factory.inl"
\ No newline at end of file
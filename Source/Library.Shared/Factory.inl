@@ -3,53 +3,137 @@
 namespace Library
 {
 	template<typename T>
-	HashMap<std::string, const Factory<T>&> Factory<T>::mFactories(41);
+	ConcurrentHashMap<std::string, const Factory<T>&> Factory<T>::mFactories(41);
+
+	template<typename T>
+	ConcurrentHashMap<size_t, const Factory<T>&> Factory<T>::mRecyclers(17);
 
 	template<typename T>
 	inline const Factory<T>* Factory<T>::Find(const std::string& name)
 	{
-		auto it = mFactories.Find(name);
-		if (it == mFactories.end())
+		const Factory* factory = nullptr;
+		mFactories.Visit(name, [&factory](const Factory& found) { factory = &found; });
+
+		return factory;
+	}
+
+	template<typename T>
+	inline gsl::owner<T*> Factory<T>::Create(const std::string& name)
+	{
+		gsl::owner<T*> product = nullptr;
+		mFactories.Visit(name, [&product](const Factory& found) { product = found.Create(); });
+
+		return product;
+	}
+
+	template<typename T>
+	inline gsl::owner<T*> Factory<T>::Create(const Handle& handle)
+	{
+		return Create(handle.ClassName());
+	}
+
+	template<typename T>
+	inline Vector<gsl::owner<T*>> Factory<T>::CreateBatch(const std::string& name, size_t count)
+	{
+		Vector<gsl::owner<T*>> products;
+		mFactories.Visit(name, [&products, count](const Factory& found) { products = found.CreateBatch(count); });
+
+		return products;
+	}
+
+	template<typename T>
+	inline Vector<gsl::owner<T*>> Factory<T>::CreateBatch(const Handle& handle, size_t count)
+	{
+		return CreateBatch(handle.ClassName(), count);
+	}
+
+	template<typename T>
+	inline bool Factory<T>::Recycle(gsl::owner<T*> product)
+	{
+		assert(product != nullptr);
+
+		bool recycled = false;
+		mRecyclers.Visit(product->TypeIdInstance(), [product, &recycled](const Factory& found) { recycled = found.RecycleProduct(product); });
+
+		return recycled;
+	}
+
+	template<typename T>
+	inline Vector<gsl::owner<T*>> Factory<T>::CreateBatch(size_t count) const
+	{
+		Vector<gsl::owner<T*>> products(count);
+		for (size_t i = 0; i < count; ++i)
 		{
-			return nullptr;
+			products.PushBack(Create());
 		}
 
-		return &it->second;
+		return products;
 	}
 
 	template<typename T>
-	inline gsl::owner<T*> Factory<T>::Create(const std::string& name)
+	inline bool Factory<T>::RecycleProduct(gsl::owner<T*>) const
+	{
+		return false;
+	}
+
+	template<typename T>
+	template<typename TConcrete>
+	inline Vector<gsl::owner<T*>> Factory<T>::CreateContiguous(size_t count)
 	{
-		auto it = mFactories.Find(name);
-		if (it == mFactories.end())
+		Vector<gsl::owner<T*>> products(count);
+		if constexpr (SupportsBatchAllocation<TConcrete, T>::value)
 		{
-			return nullptr;
+			TConcrete::template NewBatch<TConcrete>(count, products);
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				products.PushBack(new TConcrete);
+			}
 		}
 
-		return it->second.Create();
+		return products;
 	}
 
 	template<typename T>
 	inline void Factory<T>::Add(const Factory& factory)
 	{
-		if (mFactories.ContainsKey(factory.ClassName()))
+		if (!mFactories.TryEmplace(factory.ClassName(), factory))
 		{
 			throw std::runtime_error("Unable to add duplicate factories");
 		}
-
-		mFactories.Insert(std::pair<const std::string&, const Factory&>(factory.ClassName(), factory));
+		sGeneration.fetch_add(1, std::memory_order_release);
 	}
 
 	template<typename T>
 	inline void Factory<T>::Remove(const Factory& factory)
 	{
 		mFactories.Remove(factory.ClassName());
+		sGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	template<typename T>
+	inline void Factory<T>::AddRecycler(const Factory& factory, size_t typeId)
+	{
+		if (!mRecyclers.TryEmplace(typeId, factory))
+		{
+			throw std::runtime_error("Unable to add duplicate factories");
+		}
+	}
+
+	template<typename T>
+	inline void Factory<T>::RemoveRecycler(size_t typeId)
+	{
+		mRecyclers.Remove(typeId);
 	}
 
 	template<typename T>
 	inline void Factory<T>::Clear()
 	{
 		mFactories.Clear();
+		mRecyclers.Clear();
+		sGeneration.fetch_add(1, std::memory_order_release);
 	}
 
 	template<typename T>
@@ -59,8 +143,45 @@ namespace Library
 	}
 
 	template<typename T>
-	inline const HashMap<std::string, const Factory<T>&>& Factory<T>::Factories()
+	inline const ConcurrentHashMap<std::string, const Factory<T>&>& Factory<T>::Factories()
 	{
 		return mFactories;
 	}
+
+	template<typename T>
+	inline Factory<T>::Handle::Handle(std::string className) :
+		mClassName(std::move(className))
+	{
+	}
+
+	template<typename T>
+	inline const Factory<T>* Factory<T>::Handle::Get() const
+	{
+		size_t generation = sGeneration.load(std::memory_order_acquire);
+		if (mGeneration != generation)
+		{
+			mFactory = mClassName.empty() ? nullptr : Find(mClassName);
+			mGeneration = generation;
+		}
+
+		return mFactory;
+	}
+
+	template<typename T>
+	inline const Factory<T>* Factory<T>::Handle::Get(const std::string& className)
+	{
+		if (className != mClassName)
+		{
+			mClassName = className;
+			mGeneration = 0;
+		}
+
+		return Get();
+	}
+
+	template<typename T>
+	inline const std::string& Factory<T>::Handle::ClassName() const
+	{
+		return mClassName;
+	}
 }
\ No newline at end of file
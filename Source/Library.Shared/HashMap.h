@@ -3,7 +3,12 @@
 #include <functional>
 #include <algorithm>
 #include <utility>
+#include <tuple>
 #include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <memory>
 #include "Vector.h"
 #include "SList.h"
 #include "DefaultHash.h"
@@ -11,16 +16,28 @@
 
 namespace Library
 {
-	template<typename TKey, typename TData>
+	/// <summary>
+	/// A chained hash map. The hash and equality policies are template parameters so the compiler can inline them into every lookup.
+	/// Use DynamicHashMap when the functors are only known at runtime
+	/// </summary>
+	template<typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TKeyEquality = DefaultEquality<TKey>>
 	class HashMap final
 	{
 	public:
-		using HashFunctor = std::function<size_t(const TKey&)>;
-		using KeyEqualityFunctor = std::function<bool(const TKey & lhs, const TKey & rhs)>;
+		using HashFunctor = THash;
+		using KeyEqualityFunctor = TKeyEquality;
 		using PairType = std::pair<const TKey, TData>;
-		using ChainType = SList<PairType>;
+		using ChainType = SList<PairType, SharedNodes>;
 		using BucketType = Vector<ChainType>;
 
+		/// <summary>
+		/// Enabled for key types that can be looked up in a HashMap with std::string keys without constructing a std::string first,
+		/// such as std::string_view and string literals
+		/// </summary>
+		template<typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<std::is_same_v<TKey, std::string> && !std::is_same_v<std::decay_t<TLookup>, std::string> &&
+			std::is_convertible_v<const TLookup&, std::string_view>>;
+
 #pragma region Iterator
 		class Iterator final
 		{
@@ -244,7 +261,7 @@ namespace Library
 		/// <param name="size">User defined starting size for the hashmap. This will assert in debug mode if size is 0</param>
 		/// <param name="hashFunctor">A user defined hash function for hashing the keys</param>
 		/// <param name="keyEquality">A user defined equality comparison for keys</param>
-		explicit HashMap(size_t bucketSize = 11, HashFunctor hashFunctor = DefaultHash<TKey>(), KeyEqualityFunctor keyEquality = DefaultEquality<TKey>());
+		explicit HashMap(size_t bucketSize = 11, HashFunctor hashFunctor = DefaultHashFunctor(), KeyEqualityFunctor keyEquality = DefaultKeyEquality());
 		/// <summary>
 		/// Initializer list constructor that initializes the map to contain the passed in elements with the specified bucket size.
 		/// </summary>
@@ -252,7 +269,7 @@ namespace Library
 		/// <param name="size">User defined starting size for the hashmap. This will assert in debug mode if size is 0</param>
 		/// <param name="hashFunctor">A user defined hash function for hashing the keys</param>
 		/// <param name="keyEquality">A user defined equality comparison for keys</param>
-		HashMap(std::initializer_list<PairType> list, size_t bucketSize = 0, HashFunctor hashFunctor = DefaultHash<TKey>(), KeyEqualityFunctor keyEquality = DefaultEquality<TKey>());
+		HashMap(std::initializer_list<PairType> list, size_t bucketSize = 0, HashFunctor hashFunctor = DefaultHashFunctor(), KeyEqualityFunctor keyEquality = DefaultKeyEquality());
 		/// /// <summary>
 		/// Copy constructor that deep copies the HashMap passed in
 		/// </summary>
@@ -303,6 +320,22 @@ namespace Library
 		/// <returns>A const reference to the data associated with the key</returns>
 		/// <exception cref="std::runtime_error">Throws an exception if there is no data associated with the key</exception>
 		const TData& At(const TKey& key) const;
+		/// <summary>
+		/// Finds the data associated with a key given as a std::string_view or string literal without constructing a std::string
+		/// </summary>
+		/// <param name="key">The key whose associated data should be returned</param>
+		/// <returns>A reference to the data associated with the key</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if there is no data associated with the key</exception>
+		template<typename TLookup, typename = EnableIfTransparent<TLookup>>
+		TData& At(const TLookup& key);
+		/// <summary>
+		/// Const version of the heterogeneous At method
+		/// </summary>
+		/// <param name="key">The key whose associated data should be returned</param>
+		/// <returns>A const reference to the data associated with the key</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if there is no data associated with the key</exception>
+		template<typename TLookup, typename = EnableIfTransparent<TLookup>>
+		const TData& At(const TLookup& key) const;
 
 		/// <summary>
 		/// Finds the key value pair within the HashMap that contains the specified data and returns an Iterator pointing to it.
@@ -323,6 +356,21 @@ namespace Library
 		/// <param name="value">The key of the data you are looking for</param>
 		/// <returns>ConstIterator pointing to the key value pair that contains the specified data. Returns end() if the HashMap did not contain the key at all</returns>
 		ConstIterator Find(const TKey& key) const;
+		/// <summary>
+		/// Finds the pair associated with a key given as a std::string_view or string literal. No std::string is constructed
+		/// unless the HashMap uses a custom hash or equality functor, since those can only be called with a std::string
+		/// </summary>
+		/// <param name="key">The key of the data you are looking for</param>
+		/// <returns>Iterator pointing to the key value pair. Returns end() if the HashMap did not contain the key at all</returns>
+		template<typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+		/// <summary>
+		/// Const version of the heterogeneous Find method
+		/// </summary>
+		/// <param name="key">The key of the data you are looking for</param>
+		/// <returns>ConstIterator pointing to the key value pair. Returns end() if the HashMap did not contain the key at all</returns>
+		template<typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
 
 		/// <summary>
 		/// Checks if the HashMap contains a pair with the passed in key
@@ -330,6 +378,13 @@ namespace Library
 		/// <param name="key">The key that is being checked if it is within the HashMap</param>
 		/// <returns>True if the key is within the HashMap, false otherwise</returns>
 		bool ContainsKey(const TKey& key) const;
+		/// <summary>
+		/// Checks if the HashMap contains a pair with a key given as a std::string_view or string literal
+		/// </summary>
+		/// <param name="key">The key that is being checked if it is within the HashMap</param>
+		/// <returns>True if the key is within the HashMap, false otherwise</returns>
+		template<typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key) const;
 
 		/// <summary>
 		/// Returns the number of elements contained within the HashMap
@@ -342,6 +397,33 @@ namespace Library
 		/// </summary>
 		/// <returns>The size of the internal vector</returns>
 		size_t BucketSize() const;
+
+		/// <summary>
+		/// Returns the average number of pairs per bucket
+		/// </summary>
+		/// <returns>Size divided by BucketSize</returns>
+		float LoadFactor() const;
+		/// <summary>
+		/// Returns the load factor that, once exceeded by an insertion, makes the HashMap grow its buckets
+		/// </summary>
+		/// <returns>The max load factor of the HashMap</returns>
+		float MaxLoadFactor() const;
+		/// <summary>
+		/// Sets the load factor that, once exceeded by an insertion, makes the HashMap grow its buckets. Takes effect on the next insertion
+		/// </summary>
+		/// <param name="maxLoadFactor">The new max load factor. This will assert in debug mode if it is not greater than 0</param>
+		void SetMaxLoadFactor(float maxLoadFactor);
+		/// <summary>
+		/// Checks if pairs are still being migrated from the buckets the HashMap had before it last grew
+		/// </summary>
+		/// <returns>True if some pairs still live in the old buckets, false otherwise</returns>
+		bool IsRehashing() const;
+		/// <summary>
+		/// Returns the number of pairs that a lookup of the key compares against, including the old bucket while the HashMap is rehashing
+		/// </summary>
+		/// <param name="key">The key being looked up</param>
+		/// <returns>The length of the chains that a lookup of the key walks in the worst case</returns>
+		size_t LookupLength(const TKey& key) const;
 #pragma endregion
 
 #pragma region Modifiers
@@ -365,9 +447,33 @@ namespace Library
 		/// <param name="data">The key value pair to be inserted into the HashMap</param>
 		/// <returns>A std::pair containing and Iterator pointing to the inserted pair or an already existing one with that key, and a bool that is true if the data was inserted or false if the key already existed</returns>
 		std::pair<Iterator, bool> Insert(const PairType& data);
+		/// <summary>
+		/// Hash's the key of the r-value PairType passed in and moves the PairType into that index if the key is not already in the HashMap
+		/// </summary>
+		/// <param name="data">The key value pair to be moved into the HashMap</param>
+		/// <returns>A std::pair containing and Iterator pointing to the inserted pair or an already existing one with that key, and a bool that is true if the data was inserted or false if the key already existed</returns>
+		std::pair<Iterator, bool> Insert(PairType&& data);
+
+		/// <summary>
+		/// Constructs a new pair in place with the passed in key and data arguments if the key is not already in the HashMap. Nothing is constructed if the key already exists
+		/// </summary>
+		/// <param name="key">The key of the pair to be constructed</param>
+		/// <param name="args">The arguments forwarded to the constructor of TData</param>
+		/// <returns>A std::pair containing and Iterator pointing to the inserted pair or an already existing one with that key, and a bool that is true if the data was inserted or false if the key already existed</returns>
+		template<typename... Args>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, Args&&... args);
+		/// <summary>
+		/// Constructs a new pair in place, moving the passed in key into it, if the key is not already in the HashMap. The key is left untouched if it already exists
+		/// </summary>
+		/// <param name="key">The r-value key of the pair to be constructed</param>
+		/// <param name="args">The arguments forwarded to the constructor of TData</param>
+		/// <returns>A std::pair containing and Iterator pointing to the inserted pair or an already existing one with that key, and a bool that is true if the data was inserted or false if the key already existed</returns>
+		template<typename... Args>
+		std::pair<Iterator, bool> TryEmplace(TKey&& key, Args&&... args);
 
 		/// <summary>
-		/// Removes the std::pair in the HashMap that contains the passed in key
+		/// Removes the std::pair in the HashMap that contains the passed in key. Insertions and removals migrate a few buckets while the HashMap is rehashing,
+		/// which invalidates any other Iterator but never moves the pairs themselves
 		/// </summary>
 		/// <param name="key">The key of the pair of data to be removed</param>
 		/// <returns>True if the key was removed, false if the key was not in the HashMap</returns>
@@ -380,7 +486,8 @@ namespace Library
 		bool Remove(const Iterator& it);
 
 		/// <summary>
-		/// Resizes the number of slots within the HashMap. Rehashes all of the key value pairs to their new associated indices within the inner vector
+		/// Resizes the number of slots within the HashMap. Rehashes all of the key value pairs to their new associated indices within the inner vector at once.
+		/// The pairs are relinked rather than copied, so pointers to them stay valid
 		/// </summary>
 		/// <param name="size">The new size of the HashMap. This will assert in debug mode if size is 0</param>
 		/// <exception cref="std::runtime_error">Throws this exception if the method is unable to reallocate new memory for the inner vector</exception>
@@ -427,23 +534,155 @@ namespace Library
 #pragma endregion
 
 	private:
+		/// <summary>
+		/// Returns the chain at an iterator index. Indices past the current buckets refer to the old buckets that are still being migrated
+		/// </summary>
+		/// <param name="index">The iterator index of the chain</param>
+		/// <returns>The chain at that index</returns>
+		ChainType& Chain(size_t index);
+		/// <summary>
+		/// Const version of Chain
+		/// </summary>
+		/// <param name="index">The iterator index of the chain</param>
+		/// <returns>The chain at that index</returns>
+		const ChainType& Chain(size_t index) const;
+		/// <summary>
+		/// Returns the number of chains an iterator steps through, which is the number of current buckets plus the number of old buckets still being migrated
+		/// </summary>
+		/// <returns>The iterator index of end()</returns>
+		size_t ChainCount() const;
+
+		/// <summary>
+		/// Searches the current bucket of the hash, then its old bucket while the HashMap is rehashing
+		/// </summary>
+		/// <param name="hash">The hash of the key being searched for</param>
+		/// <param name="index">Output param that returns the index of the current bucket of the hash</param>
+		/// <param name="matches">Predicate that returns true for the pair being searched for</param>
+		/// <returns>Iterator pointing to the matching pair, or end() if there is none</returns>
+		template<typename Predicate>
+		Iterator FindInChains(size_t hash, size_t& index, Predicate matches);
+
+		/// <summary>
+		/// Starts growing the buckets if one more pair would exceed the max load factor
+		/// </summary>
+		/// <param name="key">The key about to be inserted</param>
+		/// <param name="index">The bucket of the key, updated to its bucket in the grown array if the HashMap grows</param>
+		void ReserveForInsert(const TKey& key, size_t& index);
+		/// <summary>
+		/// Resizes a bucket array and points every chain in it at the node pool of the HashMap
+		/// </summary>
+		/// <param name="buckets">The current or old buckets</param>
+		/// <param name="bucketSize">The size of the bucket array</param>
+		void ResizeBuckets(BucketType& buckets, size_t bucketSize);
+		/// <summary>
+		/// Returns the node storage to the heap once the HashMap is empty, so long lived maps such as the registries of factories
+		/// don't hold on to the nodes of pairs they no longer have
+		/// </summary>
+		void ReleaseNodesIfEmpty();
+		/// <summary>
+		/// Copies the pairs of both bucket arrays of rhs into chains that take their nodes from the node pool of this HashMap
+		/// </summary>
+		/// <param name="rhs">The HashMap being copied. This HashMap must be empty</param>
+		void CopyBuckets(const HashMap& rhs);
+		/// <summary>
+		/// Makes the current buckets the old buckets and allocates a new bucket array that the pairs are migrated into
+		/// </summary>
+		/// <param name="bucketSize">The size of the new bucket array</param>
+		void BeginRehash(size_t bucketSize);
+		/// <summary>
+		/// Migrates the old buckets a single insertion or removal is responsible for, so the migration finishes before the next growth is due
+		/// </summary>
+		void MigrateBuckets();
+		/// <summary>
+		/// Relinks the pairs of up to bucketCount old buckets into the current buckets, and frees the old buckets once they are all empty
+		/// </summary>
+		/// <param name="bucketCount">The number of old buckets to migrate</param>
+		void MigrateBuckets(size_t bucketCount);
+		/// <summary>
+		/// Returns the number of old buckets to migrate now. The remaining buckets are spread over the operations left before an insertion
+		/// grows the HashMap again, counting that insertion, which migrates before it grows
+		/// </summary>
+		/// <returns>At least MigrationStep, or every remaining old bucket if the next insertion grows the HashMap</returns>
+		size_t MigrationBudget() const;
+
+		/// <summary>
+		/// Returns the hash functor of a HashMap constructed without one. Type-erased functors default to DefaultHash, since an empty std::function cannot be called
+		/// </summary>
+		/// <returns>The default hash functor</returns>
+		static HashFunctor DefaultHashFunctor();
+		/// <summary>
+		/// Returns the equality functor of a HashMap constructed without one. Type-erased functors default to DefaultEquality
+		/// </summary>
+		/// <returns>The default equality functor</returns>
+		static KeyEqualityFunctor DefaultKeyEquality();
+
+		/// <summary>
+		/// True if the policies are DefaultHash and DefaultEquality, which hash and compare a std::string_view exactly like the std::string it views
+		/// </summary>
+		static constexpr bool HasDefaultPolicies = std::is_same_v<THash, DefaultHash<TKey>> && std::is_same_v<TKeyEquality, DefaultEquality<TKey>>;
+
+		/// <summary>
+		/// Checks whether the functors are the defaults, which hash and compare a std::string_view exactly like the std::string it views.
+		/// Only type-erased functors need to be checked at runtime
+		/// </summary>
+		/// <param name="hashFunctor">The hash functor of the HashMap</param>
+		/// <param name="keyEquality">The equality functor of the HashMap</param>
+		/// <returns>True if keys can be looked up without constructing a TKey</returns>
+		static bool SupportsTransparentLookup(const HashFunctor& hashFunctor, const KeyEqualityFunctor& keyEquality);
+
+		/// <summary>
+		/// The max load factor of a HashMap that was not given one
+		/// </summary>
+		static constexpr float DefaultMaxLoadFactor = 2.0f;
+		/// <summary>
+		/// The least number of old buckets migrated by each insertion or removal while the HashMap is rehashing
+		/// </summary>
+		static constexpr size_t MigrationStep = 4;
+
 		/// <summary>
 		/// The number of elements contained within the HashMap.
 		/// </summary>
 		size_t mSize = 0;
 		/// <summary>
+		/// The nodes of every chain, in both the current and the old buckets, so inserting and removing pairs reuses nodes
+		/// and migrating a pair only relinks its node. Declared before the buckets so it outlives them
+		/// </summary>
+		std::unique_ptr<typename ChainType::NodePool> mNodePool;
+		/// <summary>
 		/// The vector that contains all the key value pairs within the HashMap
 		/// </summary>
 		BucketType mBuckets;
 		/// <summary>
+		/// The buckets the HashMap had before it last grew. Empty unless the HashMap is rehashing
+		/// </summary>
+		BucketType mOldBuckets;
+		/// <summary>
+		/// The index of the next old bucket to migrate
+		/// </summary>
+		size_t mMigrationIndex = 0;
+		/// <summary>
+		/// The load factor that makes the HashMap grow once an insertion exceeds it
+		/// </summary>
+		float mMaxLoadFactor = DefaultMaxLoadFactor;
+		/// <summary>
 		/// The functor used to hash the key values into indices
 		/// </summary>
-		HashFunctor mHashFunctor = DefaultHash<const TKey>();
+		HashFunctor mHashFunctor;
 		/// <summary>
 		/// The functor used to compare keys for equality
 		/// </summary>
-		KeyEqualityFunctor mKeyEquality = DefaultEquality<const TKey>();
+		KeyEqualityFunctor mKeyEquality;
+		/// <summary>
+		/// Cached result of SupportsTransparentLookup for the functors of this HashMap
+		/// </summary>
+		bool mTransparentLookup = false;
 	};
+
+	/// <summary>
+	/// A HashMap whose hash and equality functors are chosen at runtime, such as lambdas passed to the constructor. Every lookup calls through std::function
+	/// </summary>
+	template<typename TKey, typename TData>
+	using DynamicHashMap = HashMap<TKey, TData, std::function<size_t(const TKey&)>, std::function<bool(const TKey& lhs, const TKey& rhs)>>;
 }
 
 #include "HashMap.inl"
\ No newline at end of file
@@ -5,11 +5,11 @@
 namespace Library
 {
 #pragma region Iterator
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::Iterator::Iterator(HashMap& owner, size_t index, const typename HashMap<TKey, TData>::ChainType::Iterator& chainIterator) : mOwner(&owner), mIndex(index), mChainIterator(chainIterator) {}
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::Iterator::Iterator(HashMap& owner, size_t index, const typename HashMap<TKey, TData, THash, TKeyEquality>::ChainType::Iterator& chainIterator) : mOwner(&owner), mIndex(index), mChainIterator(chainIterator) {}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::PairType& HashMap<TKey, TData>::Iterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::PairType& HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr || mOwner->Size() == 0)
 		{
@@ -19,52 +19,52 @@ namespace Library
 		return *mChainIterator;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::PairType* HashMap<TKey, TData>::Iterator::operator->() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::PairType* HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::Iterator::operator==(const Iterator& it) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator==(const Iterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::Iterator::operator!=(const Iterator& it) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator!=(const Iterator& it) const
 	{
 		return (mOwner != it.mOwner || mIndex != it.mIndex || mChainIterator != it.mChainIterator);
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator& HashMap<TKey, TData>::Iterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator& HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator++()
 	{
-		if (mOwner == nullptr || mIndex >= mOwner->mBuckets.Size())
+		if (mOwner == nullptr || mIndex >= mOwner->ChainCount())
 		{
 			throw std::runtime_error("You cannot increment the end iterator");
 		}
 
-		if (++mChainIterator == mOwner->mBuckets[mIndex].end())
+		if (++mChainIterator == mOwner->Chain(mIndex).end())
 		{
 			do 
 			{
 				++mIndex;
-				if (mIndex >= mOwner->mBuckets.Size())
+				if (mIndex >= mOwner->ChainCount())
 				{
 					mChainIterator = ChainType::Iterator();
 					return *this;
 				}
-			} while (mOwner->mBuckets[mIndex].IsEmpty());
+			} while (mOwner->Chain(mIndex).IsEmpty());
 
-			mChainIterator = mOwner->mBuckets[mIndex].begin();
+			mChainIterator = mOwner->Chain(mIndex).begin();
 		}
 
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Iterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::Iterator::operator++(int)
 	{
 		Iterator it = *this;
 		operator++();
@@ -73,15 +73,15 @@ namespace Library
 #pragma endregion
 
 #pragma region ConstIterator
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::ConstIterator::ConstIterator(const HashMap& owner, size_t index, const typename HashMap<TKey, TData>::ChainType::ConstIterator& chainIterator) : mOwner(&owner), mIndex(index), mChainIterator(chainIterator) {}
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::ConstIterator(const HashMap& owner, size_t index, const typename HashMap<TKey, TData, THash, TKeyEquality>::ChainType::ConstIterator& chainIterator) : mOwner(&owner), mIndex(index), mChainIterator(chainIterator) {}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::ConstIterator::ConstIterator(const Iterator& it) :
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::ConstIterator(const Iterator& it) :
 		mOwner(it.mOwner), mIndex(it.mIndex), mChainIterator(it.mChainIterator) {}
 
-	template<typename TKey, typename TData>
-	inline typename const HashMap<TKey, TData>::PairType& HashMap<TKey, TData>::ConstIterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename const HashMap<TKey, TData, THash, TKeyEquality>::PairType& HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator*() const
 	{
 		if (mOwner == nullptr || mOwner->Size() == 0)
 		{
@@ -91,52 +91,52 @@ namespace Library
 		return *mChainIterator;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename const HashMap<TKey, TData>::PairType* HashMap<TKey, TData>::ConstIterator::operator->() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename const HashMap<TKey, TData, THash, TKeyEquality>::PairType* HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ConstIterator::operator==(const ConstIterator& it) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator==(const ConstIterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ConstIterator::operator!=(const ConstIterator& it) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator!=(const ConstIterator& it) const
 	{
 		return (mOwner != it.mOwner || mIndex != it.mIndex || mChainIterator != it.mChainIterator);
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator& HashMap<TKey, TData>::ConstIterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator& HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator++()
 	{
-		if (mOwner == nullptr || mIndex >= mOwner->mBuckets.Size())
+		if (mOwner == nullptr || mIndex >= mOwner->ChainCount())
 		{
 			throw std::runtime_error("You cannot increment the end iterator");
 		}
 
-		if (++mChainIterator == mOwner->mBuckets[mIndex].end())
+		if (++mChainIterator == mOwner->Chain(mIndex).end())
 		{
 			do
 			{
 				++mIndex;
-				if (mIndex >= mOwner->mBuckets.Size())
+				if (mIndex >= mOwner->ChainCount())
 				{
 					mChainIterator = ChainType::Iterator();
 					return *this;
 				}
-			} while (mOwner->mBuckets[mIndex].IsEmpty());
+			} while (mOwner->Chain(mIndex).IsEmpty());
 
-			mChainIterator = mOwner->mBuckets[mIndex].begin();
+			mChainIterator = mOwner->Chain(mIndex).begin();
 		}
 
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::ConstIterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator::operator++(int)
 	{
 		ConstIterator it = *this;
 		operator++();
@@ -145,25 +145,21 @@ namespace Library
 #pragma endregion
 
 #pragma region MemberMethods
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::HashMap(size_t bucketSize, HashFunctor hashFunctor, KeyEqualityFunctor keyEquality) :
-		mSize(0), mHashFunctor(hashFunctor), mKeyEquality(keyEquality)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(size_t bucketSize, HashFunctor hashFunctor, KeyEqualityFunctor keyEquality) :
+		mSize(0), mNodePool(std::make_unique<typename ChainType::NodePool>()), mHashFunctor(hashFunctor), mKeyEquality(keyEquality),
+		mTransparentLookup(SupportsTransparentLookup(mHashFunctor, mKeyEquality))
 	{
 		assert(bucketSize != 0);
-		mBuckets.Resize(bucketSize);
+		ResizeBuckets(mBuckets, bucketSize);
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::HashMap(std::initializer_list<PairType> list, size_t bucketSize, HashFunctor hashFunctor, KeyEqualityFunctor keyEquality)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(std::initializer_list<PairType> list, size_t bucketSize, HashFunctor hashFunctor, KeyEqualityFunctor keyEquality) :
+		mNodePool(std::make_unique<typename ChainType::NodePool>()), mHashFunctor(hashFunctor), mKeyEquality(keyEquality),
+		mTransparentLookup(SupportsTransparentLookup(mHashFunctor, mKeyEquality))
 	{
-		if (bucketSize == 0)
-		{
-			mBuckets.Resize(list.size());
-		}
-		else
-		{
-			mBuckets.Resize(bucketSize);
-		}
+		ResizeBuckets(mBuckets, bucketSize == 0 ? list.size() : bucketSize);
 
 		for (const auto& item : list)
 		{
@@ -171,52 +167,68 @@ namespace Library
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::HashMap(const HashMap& rhs) :
-		mSize(rhs.mSize), mBuckets(rhs.mBuckets), mHashFunctor(rhs.mHashFunctor), mKeyEquality(rhs.mKeyEquality)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(const HashMap& rhs) :
+		mNodePool(std::make_unique<typename ChainType::NodePool>()), mMigrationIndex(rhs.mMigrationIndex), mMaxLoadFactor(rhs.mMaxLoadFactor),
+		mHashFunctor(rhs.mHashFunctor), mKeyEquality(rhs.mKeyEquality), mTransparentLookup(rhs.mTransparentLookup)
 	{
+		CopyBuckets(rhs);
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::HashMap(HashMap&& rhs) noexcept :
-		mSize(rhs.mSize), mBuckets(std::move(rhs.mBuckets)), mHashFunctor(rhs.mHashFunctor), mKeyEquality(rhs.mKeyEquality)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(HashMap&& rhs) noexcept :
+		mSize(rhs.mSize), mNodePool(std::move(rhs.mNodePool)), mBuckets(std::move(rhs.mBuckets)), mOldBuckets(std::move(rhs.mOldBuckets)), mMigrationIndex(rhs.mMigrationIndex), mMaxLoadFactor(rhs.mMaxLoadFactor),
+		mHashFunctor(rhs.mHashFunctor), mKeyEquality(rhs.mKeyEquality), mTransparentLookup(rhs.mTransparentLookup)
 	{
 		rhs.mSize = 0;
+		rhs.mMigrationIndex = 0;
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>& HashMap<TKey, TData>::operator=(const HashMap& rhs)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>& HashMap<TKey, TData, THash, TKeyEquality>::operator=(const HashMap& rhs)
 	{
 		if (this != &rhs)
 		{
 			Clear();
-			mSize = rhs.mSize;
-			mBuckets = rhs.mBuckets;
+			if (mNodePool == nullptr)
+			{
+				mNodePool = std::make_unique<typename ChainType::NodePool>();
+			}
+			CopyBuckets(rhs);
+			mMigrationIndex = rhs.mMigrationIndex;
+			mMaxLoadFactor = rhs.mMaxLoadFactor;
 			mHashFunctor = rhs.mHashFunctor;
 			mKeyEquality = rhs.mKeyEquality;
+			mTransparentLookup = rhs.mTransparentLookup;
 		}
 
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>& HashMap<TKey, TData>::operator=(HashMap&& rhs) noexcept
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>& HashMap<TKey, TData, THash, TKeyEquality>::operator=(HashMap&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
 			Clear();
 			mSize = rhs.mSize;
 			mBuckets = std::move(rhs.mBuckets);
+			mOldBuckets = std::move(rhs.mOldBuckets);
+			mNodePool = std::move(rhs.mNodePool);
+			mMigrationIndex = rhs.mMigrationIndex;
+			mMaxLoadFactor = rhs.mMaxLoadFactor;
 			mHashFunctor = rhs.mHashFunctor;
 			mKeyEquality = rhs.mKeyEquality;
+			mTransparentLookup = rhs.mTransparentLookup;
 
 			rhs.mSize = 0;
+			rhs.mMigrationIndex = 0;
 		}
 
 		return *this;
 	}
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>& HashMap<TKey, TData>::operator=(std::initializer_list<PairType> list)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>& HashMap<TKey, TData, THash, TKeyEquality>::operator=(std::initializer_list<PairType> list)
 	{
 		Clear();
 		for (const auto& item : list)
@@ -227,8 +239,8 @@ namespace Library
 #pragma endregion
 
 #pragma region ElementAccess
-  	template<typename TKey, typename TData>
-  	inline TData& HashMap<TKey, TData>::At(const TKey& key)
+  	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+  	inline TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const TKey& key)
   	{
 		auto it = Find(key);
 		if (it == end())
@@ -239,8 +251,8 @@ namespace Library
 		return it->second;
   	}
   
-   	template<typename TKey, typename TData>
-   	inline const TData& HashMap<TKey, TData>::At(const TKey& key) const
+   	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+   	inline const TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const TKey& key) const
    	{
 		auto it = Find(key);
 		if (it == cend())
@@ -251,76 +263,163 @@ namespace Library
 		return it->second;
    	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TKey& key, size_t& index)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename TLookup, typename>
+	inline TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const TLookup& key)
 	{
-		index = mHashFunctor(key) % mBuckets.Size();
-		for (typename ChainType::Iterator it = mBuckets[index].begin(); it != mBuckets[index].end(); ++it)
+		auto it = Find(key);
+		if (it == end())
 		{
-			if (mKeyEquality((*it).first, key))
-			{
-				return Iterator(*this, index, it);
-			}
+			throw std::runtime_error("There is no element at that key");
 		}
 
-		return end();
+		return it->second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename TLookup, typename>
+	inline const TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const TLookup& key) const
+	{
+		auto it = Find(key);
+		if (it == cend())
+		{
+			throw std::runtime_error("There is no element at that key");
+		}
+
+		return it->second;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const TKey& key, size_t& index)
+	{
+		return FindInChains(mHashFunctor(key), index, [this, &key](const PairType& pair) { return mKeyEquality(pair.first, key); });
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const TKey& key)
 	{
 		size_t index;
 		return Find(key, index);
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::Find(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const TKey& key) const
 	{
 		size_t index;
 		return ConstIterator(const_cast<HashMap&>(*this).Find(key, index));
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ContainsKey(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename TLookup, typename>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const TLookup& key)
+	{
+		std::string_view keyView(key);
+		if constexpr (!HasDefaultPolicies)
+		{
+			if (!mTransparentLookup)
+			{
+				return Find(TKey(keyView));
+			}
+		}
+
+		size_t index;
+		return FindInChains(DefaultHash<std::string_view>()(keyView), index, [keyView](const PairType& pair) { return std::string_view(pair.first) == keyView; });
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename TLookup, typename>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const TLookup& key) const
+	{
+		return ConstIterator(const_cast<HashMap&>(*this).Find(key));
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::ContainsKey(const TKey& key) const
 	{
 		return (Find(key) != end());
 	}
 
-	template<typename TKey, typename TData>
-	inline size_t HashMap<TKey, TData>::Size() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename TLookup, typename>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::ContainsKey(const TLookup& key) const
+	{
+		return (Find(key) != end());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline size_t HashMap<TKey, TData, THash, TKeyEquality>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename TKey, typename TData>
-	inline size_t HashMap<TKey, TData>::BucketSize() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline size_t HashMap<TKey, TData, THash, TKeyEquality>::BucketSize() const
 	{
 		return mBuckets.Size();
 	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float HashMap<TKey, TData, THash, TKeyEquality>::LoadFactor() const
+	{
+		return static_cast<float>(mSize) / static_cast<float>(mBuckets.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float HashMap<TKey, TData, THash, TKeyEquality>::MaxLoadFactor() const
+	{
+		return mMaxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		assert(maxLoadFactor > 0.0f);
+		mMaxLoadFactor = maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::IsRehashing() const
+	{
+		return !mOldBuckets.IsEmpty();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline size_t HashMap<TKey, TData, THash, TKeyEquality>::LookupLength(const TKey& key) const
+	{
+		size_t hash = mHashFunctor(key);
+		size_t length = mBuckets[hash % mBuckets.Size()].Size();
+		if (IsRehashing())
+		{
+			length += mOldBuckets[hash % mOldBuckets.Size()].Size();
+		}
+
+		return length;
+	}
 #pragma endregion
 
 #pragma region Modifiers
-	template<typename TKey, typename TData>
-	inline TData& HashMap<TKey, TData>::operator[](const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline TData& HashMap<TKey, TData, THash, TKeyEquality>::operator[](const TKey& key)
 	{
-		auto [ret, inserted] = Insert(PairType(key, TData()));
-		return ret->second;
+		return TryEmplace(key).first->second;
 	}
 
-	template<typename TKey, typename TData>
-	inline const TData& HashMap<TKey, TData>::operator[](const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const TData& HashMap<TKey, TData, THash, TKeyEquality>::operator[](const TKey& key) const
 	{
 		return At(key);
 	}
 
-	template<typename TKey, typename TData>
-	inline std::pair<typename HashMap<TKey, TData>::Iterator, bool> HashMap<TKey, TData>::Insert(const PairType& data)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::Insert(const PairType& data)
 	{
+		MigrateBuckets();
 		size_t index;
 
 		Iterator foundIt = Find(data.first, index);
 		if (foundIt == end())
 		{
+			ReserveForInsert(data.first, index);
 			auto it = mBuckets[index].PushBack(data);
 			mSize++;
 			return std::pair(Iterator(*this, index, it), true);
@@ -329,109 +428,370 @@ namespace Library
 		return std::pair(foundIt, false);
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::Remove(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::Insert(PairType&& data)
 	{
-		return Remove(Find(key));
+		MigrateBuckets();
+		size_t index;
+
+		Iterator foundIt = Find(data.first, index);
+		if (foundIt == end())
+		{
+			ReserveForInsert(data.first, index);
+			auto it = mBuckets[index].PushBack(std::move(data));
+			mSize++;
+			return std::pair(Iterator(*this, index, it), true);
+		}
+
+		return std::pair(foundIt, false);
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::Remove(const Iterator& it)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename... Args>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::TryEmplace(const TKey& key, Args&&... args)
 	{
-		if (it.mOwner == nullptr || it.mIndex >= mBuckets.Size())
+		MigrateBuckets();
+		size_t index;
+
+		Iterator foundIt = Find(key, index);
+		if (foundIt == end())
 		{
-			return false;
+			ReserveForInsert(key, index);
+			auto it = mBuckets[index].EmplaceBack(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			mSize++;
+			return std::pair(Iterator(*this, index, it), true);
 		}
 
-		--mSize;
-		return mBuckets[it.mIndex].Remove(it.mChainIterator);
+		return std::pair(foundIt, false);
 	}
 
-	template<typename TKey, typename TData>
-	inline void HashMap<TKey, TData>::Resize(const size_t bucketSize)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename... Args>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::TryEmplace(TKey&& key, Args&&... args)
 	{
-		assert(bucketSize != 0);
+		MigrateBuckets();
+		size_t index;
+
+		Iterator foundIt = Find(key, index);
+		if (foundIt == end())
+		{
+			ReserveForInsert(key, index);
+			auto it = mBuckets[index].EmplaceBack(std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			mSize++;
+			return std::pair(Iterator(*this, index, it), true);
+		}
+
+		return std::pair(foundIt, false);
+	}
 
-		HashMap map(bucketSize);
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::Remove(const TKey& key)
+	{
+		return Remove(Find(key));
+	}
 
-		for (auto& item : *this)
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::Remove(const Iterator& it)
+	{
+		if (it.mOwner == nullptr || it.mIndex >= ChainCount())
 		{
-			map.Insert(item);
+			return false;
 		}
 
-		*this = std::move(map);
+		bool removed = Chain(it.mIndex).Remove(it.mChainIterator);
+		--mSize;
+
+		MigrateBuckets();
+		ReleaseNodesIfEmpty();
+
+		return removed;
 	}
 
-	template<typename TKey, typename TData>
-	inline void HashMap<TKey, TData>::Clear()
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::Resize(const size_t bucketSize)
+	{
+		assert(bucketSize != 0);
+
+		BeginRehash(bucketSize);
+		MigrateBuckets(mOldBuckets.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::Clear()
 	{
 		for (size_t i = 0; i < mBuckets.Size(); ++i)
 		{
 			mBuckets[i].Clear();
 		}
+		mOldBuckets.Clear();
+		mOldBuckets.ShrinkToFit();
+		mMigrationIndex = 0;
 		mSize = 0;
+		ReleaseNodesIfEmpty();
 	}
 #pragma endregion
 
 #pragma region BeginEnd
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::begin()
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::begin()
 	{
 		size_t index = 0;
 		
-		while (mBuckets[index].IsEmpty())
+		while (Chain(index).IsEmpty())
 		{
 			++index;
 
-			if (index >= mBuckets.Size())
+			if (index >= ChainCount())
 			{
 				return end();
 			}
 		}
 		
-		return Iterator(*this, index, mBuckets[index].begin());
+		return Iterator(*this, index, Chain(index).begin());
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::begin() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::begin() const
 	{
 		return cbegin();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::cbegin() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::cbegin() const
 	{
 		size_t index = 0;
 
-		while (mBuckets[index].IsEmpty())
+		while (Chain(index).IsEmpty())
 		{
 			++index;
 
-			if (index >= mBuckets.Size())
+			if (index >= ChainCount())
 			{
 				return cend();
 			}
 		}
 
-		return ConstIterator(*this, index, mBuckets[index].begin());
+		return ConstIterator(*this, index, Chain(index).begin());
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::end()
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::end()
 	{
-		return Iterator(*this, mBuckets.Size(), ChainType::Iterator());
+		return Iterator(*this, ChainCount(), ChainType::Iterator());
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::end() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::end() const
 	{
 		return cend();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::cend() const
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ConstIterator HashMap<TKey, TData, THash, TKeyEquality>::cend() const
+	{
+		return ConstIterator(*this, ChainCount(), ChainType::ConstIterator());
+	}
+#pragma endregion
+
+#pragma region Helpers
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::ChainType& HashMap<TKey, TData, THash, TKeyEquality>::Chain(size_t index)
+	{
+		return (index < mBuckets.Size() ? mBuckets[index] : mOldBuckets[index - mBuckets.Size()]);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const typename HashMap<TKey, TData, THash, TKeyEquality>::ChainType& HashMap<TKey, TData, THash, TKeyEquality>::Chain(size_t index) const
+	{
+		return (index < mBuckets.Size() ? mBuckets[index] : mOldBuckets[index - mBuckets.Size()]);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline size_t HashMap<TKey, TData, THash, TKeyEquality>::ChainCount() const
+	{
+		return mBuckets.Size() + mOldBuckets.Size();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template<typename Predicate>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Iterator HashMap<TKey, TData, THash, TKeyEquality>::FindInChains(size_t hash, size_t& index, Predicate matches)
 	{
-		return ConstIterator(*this, mBuckets.Size(), ChainType::ConstIterator());
+		index = hash % mBuckets.Size();
+		for (typename ChainType::Iterator it = mBuckets[index].begin(); it != mBuckets[index].end(); ++it)
+		{
+			if (matches(*it))
+			{
+				return Iterator(*this, index, it);
+			}
+		}
+
+		if (IsRehashing())
+		{
+			size_t oldIndex = hash % mOldBuckets.Size();
+			for (typename ChainType::Iterator it = mOldBuckets[oldIndex].begin(); it != mOldBuckets[oldIndex].end(); ++it)
+			{
+				if (matches(*it))
+				{
+					return Iterator(*this, mBuckets.Size() + oldIndex, it);
+				}
+			}
+		}
+
+		return end();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::ReserveForInsert(const TKey& key, size_t& index)
+	{
+		if (static_cast<float>(mSize + 1) > mMaxLoadFactor * static_cast<float>(mBuckets.Size()))
+		{
+			// MigrationBudget drained the old buckets on this insertion's own step at the latest
+			assert(!IsRehashing());
+			BeginRehash(mBuckets.Size() * 2 + 1);
+			index = mHashFunctor(key) % mBuckets.Size();
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::BeginRehash(size_t bucketSize)
+	{
+		// Only Resize can get here before the last migration finished. Growing again would leave pairs behind in two generations of old buckets
+		MigrateBuckets(mOldBuckets.Size());
+
+		mOldBuckets = std::move(mBuckets);
+		mBuckets = BucketType();
+		ResizeBuckets(mBuckets, bucketSize);
+		mMigrationIndex = 0;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::ResizeBuckets(BucketType& buckets, size_t bucketSize)
+	{
+		buckets.Resize(bucketSize);
+		for (ChainType& chain : buckets)
+		{
+			chain.SetNodePool(*mNodePool);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::ReleaseNodesIfEmpty()
+	{
+		if (mSize == 0 && mNodePool != nullptr)
+		{
+			mNodePool->Release();
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::CopyBuckets(const HashMap& rhs)
+	{
+		// Copying the chains directly would leave them drawing from the node pool of rhs
+		mBuckets = BucketType();
+		mOldBuckets = BucketType();
+		ResizeBuckets(mBuckets, rhs.mBuckets.Size());
+		ResizeBuckets(mOldBuckets, rhs.mOldBuckets.Size());
+		for (size_t i = 0; i < rhs.mBuckets.Size(); ++i)
+		{
+			mBuckets[i] = rhs.mBuckets[i];
+		}
+		for (size_t i = 0; i < rhs.mOldBuckets.Size(); ++i)
+		{
+			mOldBuckets[i] = rhs.mOldBuckets[i];
+		}
+		mSize = rhs.mSize;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::MigrateBuckets()
+	{
+		if (IsRehashing())
+		{
+			MigrateBuckets(MigrationBudget());
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline size_t HashMap<TKey, TData, THash, TKeyEquality>::MigrationBudget() const
+	{
+		// An insertion grows the HashMap once Size + 1 exceeds the limit, so the operations at every size up to the limit get a share
+		size_t limit = static_cast<size_t>(mMaxLoadFactor * static_cast<float>(mBuckets.Size()));
+		size_t operations = (limit > mSize ? limit - mSize : 0) + 1;
+		size_t remaining = mOldBuckets.Size() - mMigrationIndex;
+
+		return std::max(MigrationStep, (remaining + operations - 1) / operations);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::MigrateBuckets(size_t bucketCount)
+	{
+		for (; bucketCount > 0 && mMigrationIndex < mOldBuckets.Size(); --bucketCount, ++mMigrationIndex)
+		{
+			ChainType& chain = mOldBuckets[mMigrationIndex];
+			while (!chain.IsEmpty())
+			{
+				chain.TransferFront(mBuckets[mHashFunctor(chain.Front().first) % mBuckets.Size()]);
+			}
+		}
+
+		if (IsRehashing() && mMigrationIndex == mOldBuckets.Size())
+		{
+			mOldBuckets.Clear();
+			mOldBuckets.ShrinkToFit();
+			mMigrationIndex = 0;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::HashFunctor HashMap<TKey, TData, THash, TKeyEquality>::DefaultHashFunctor()
+	{
+		if constexpr (std::is_same_v<THash, std::function<size_t(const TKey&)>>)
+		{
+			return DefaultHash<TKey>();
+		}
+		else
+		{
+			return THash();
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::KeyEqualityFunctor HashMap<TKey, TData, THash, TKeyEquality>::DefaultKeyEquality()
+	{
+		if constexpr (std::is_same_v<TKeyEquality, std::function<bool(const TKey& lhs, const TKey& rhs)>>)
+		{
+			return DefaultEquality<TKey>();
+		}
+		else
+		{
+			return TKeyEquality();
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::SupportsTransparentLookup([[maybe_unused]] const HashFunctor& hashFunctor, [[maybe_unused]] const KeyEqualityFunctor& keyEquality)
+	{
+		using DynamicHash = std::function<size_t(const TKey&)>;
+		using DynamicEquality = std::function<bool(const TKey& lhs, const TKey& rhs)>;
+
+		if constexpr (!std::is_same_v<TKey, std::string>)
+		{
+			return false;
+		}
+		else if constexpr (HasDefaultPolicies)
+		{
+			return true;
+		}
+		else if constexpr (std::is_same_v<THash, DynamicHash> && std::is_same_v<TKeyEquality, DynamicEquality>)
+		{
+			bool defaultHash = hashFunctor.template target<DefaultHash<TKey>>() != nullptr || hashFunctor.template target<DefaultHash<const TKey>>() != nullptr;
+			bool defaultEquality = keyEquality.template target<DefaultEquality<TKey>>() != nullptr || keyEquality.template target<DefaultEquality<const TKey>>() != nullptr;
+			return defaultHash && defaultEquality;
+		}
+		else
+		{
+			return false;
+		}
 	}
 #pragma endregion
 }
\ No newline at end of file
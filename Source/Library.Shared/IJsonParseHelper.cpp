@@ -9,4 +9,14 @@ namespace Library
 	{
 
 	}
+
+	void IJsonParseHelper::GetHandledKeys(Vector<std::string>&) const
+	{
+
+	}
+
+	bool IJsonParseHelper::HandlesValueKind(ValueKind) const
+	{
+		return true;
+	}
 }
\ No newline at end of file
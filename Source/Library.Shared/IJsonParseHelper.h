@@ -10,6 +10,15 @@ namespace Library
 
 	public:
 
+		/// <summary>
+		/// The kinds of values a JsonParseMaster offers to its helpers. Arrays are never offered whole, their elements are
+		/// </summary>
+		enum class ValueKind
+		{
+			Scalar,
+			Object
+		};
+
 		/// <summary>
 		/// Virtual destructor. Used to make sure polymorphic behavior is maintained when destroying child classes
 		/// </summary>
@@ -26,6 +35,21 @@ namespace Library
 		/// <returns>The address of the created helper</returns>
 		virtual IJsonParseHelper* Create() = 0;
 
+		/// <summary>
+		/// Adds the keys this helper handles to the passed in list. A JsonParseMaster only offers a helper that declares keys the members with those keys,
+		/// matched regardless of case. Helpers that declare none, the default, are offered every key.
+		/// Asked once when the helper is added to a parse master, so the keys must not change afterwards
+		/// </summary>
+		/// <param name="keys">The list the handled keys are added to</param>
+		virtual void GetHandledKeys(Vector<std::string>& keys) const;
+		/// <summary>
+		/// Checks whether this helper handles values of the passed in kind. A JsonParseMaster never offers a helper values of the kinds it doesn't handle.
+		/// Handles every kind by default. Asked once when the helper is added to a parse master
+		/// </summary>
+		/// <param name="kind">The kind of value</param>
+		/// <returns>True if values of the kind should be offered to this helper, false otherwise</returns>
+		virtual bool HandlesValueKind(ValueKind kind) const;
+
 		/// <summary>
 		/// Checks to make sure that this helper is able to handle the parsed JSON data and convert it into its desired data
 		/// </summary>
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "JsonParseMaster.h"
 #include "IJsonParseHelper.h"
+#include "JsonStreamReader.h"
+#include "MemoryMappedFile.h"
 
 namespace Library
 {
@@ -73,7 +75,8 @@ namespace Library
 	}
 
 	JsonParseMaster::JsonParseMaster(JsonParseMaster&& rhs) noexcept :
-		mHelpers(std::move(rhs.mHelpers)), mSharedData(rhs.mSharedData), mFile(std::move(rhs.mFile)), mIsClone(false)
+		mHelpers(std::move(rhs.mHelpers)), mSharedData(rhs.mSharedData), mFile(std::move(rhs.mFile)), mIsClone(false), mParseMode(rhs.mParseMode),
+		mKeyedHandlers(std::move(rhs.mKeyedHandlers)), mUnkeyedHandlers(std::move(rhs.mUnkeyedHandlers))
 	{
 		rhs.mSharedData = nullptr;
 	}
@@ -83,6 +86,9 @@ namespace Library
 		mHelpers = std::move(rhs.mHelpers);
 		mSharedData = rhs.mSharedData;
 		mFile = std::move(rhs.mFile);
+		mParseMode = rhs.mParseMode;
+		mKeyedHandlers = std::move(rhs.mKeyedHandlers);
+		mUnkeyedHandlers = std::move(rhs.mUnkeyedHandlers);
 
 		return *this;
 	}
@@ -110,6 +116,7 @@ namespace Library
 			retMaster->AddHelper(*helper->Create());
 		}
 		retMaster->mIsClone = true;
+		retMaster->mParseMode = mParseMode;
 		return retMaster;
 	}
 
@@ -123,6 +130,7 @@ namespace Library
 		if (std::find_if(mHelpers.begin(), mHelpers.end(), [&helper](IJsonParseHelper* mHelper) { return mHelper->TypeIdInstance() == helper.TypeIdInstance(); }) == mHelpers.end())
 		{
 			mHelpers.PushBack(&helper);
+			BuildDispatchTable();
 		}
 		else
 		{
@@ -133,6 +141,7 @@ namespace Library
 	void JsonParseMaster::RemoveHelper(IJsonParseHelper& helper)
 	{
 		mHelpers.Remove(&helper);
+		BuildDispatchTable();
 
 		if (mIsClone)
 		{
@@ -142,22 +151,129 @@ namespace Library
 
 	void JsonParseMaster::Parse(const std::string& rawJson)
 	{
+		if (mParseMode == ParseMode::Stream)
+		{
+			JsonStreamReader reader(rawJson.data(), rawJson.size());
+			ParseStream(reader);
+			return;
+		}
+
 		std::istringstream stream(rawJson);
 		Parse(stream);
 	}
 
 	void JsonParseMaster::ParseFromFile(const std::string& filename)
 	{
-		std::ifstream streamfile(filename);
+		MemoryMappedFile file(filename);
 		mFile = filename;
-		Parse(streamfile);
+
+		if (mParseMode == ParseMode::Stream)
+		{
+			JsonStreamReader reader(file.Data(), file.Size());
+			ParseStream(reader);
+			return;
+		}
+
+		Json::Value root;
+		std::string errors;
+		const std::unique_ptr<Json::CharReader> charReader(Json::CharReaderBuilder().newCharReader());
+		if (!charReader->parse(file.Data(), file.Data() + file.Size(), &root, &errors))
+		{
+			throw std::runtime_error("Unable to parse " + filename + ": " + errors);
+		}
+
+		ParseDocument(root);
 	}
 
 	void JsonParseMaster::Parse(std::istream& stream)
 	{
+		if (mParseMode == ParseMode::Stream)
+		{
+			JsonStreamReader reader(stream);
+			ParseStream(reader);
+			return;
+		}
+
 		Json::Value root;
-		stream >> root;
+		std::string errors;
+		if (!Json::parseFromStream(Json::CharReaderBuilder(), stream, &root, &errors))
+		{
+			throw std::runtime_error("Unable to parse the JSON: " + errors);
+		}
+
+		ParseDocument(root);
+	}
 
+	void JsonParseMaster::BuildDispatchTable()
+	{
+		mKeyedHandlers.Clear();
+		mUnkeyedHandlers = KeyHandlers();
+
+		// Every declared key gets its lists first, so the helpers that declared no keys can be added to all of them in the order the helpers were added
+		Vector<Vector<std::string>> helperKeys;
+		helperKeys.Resize(mHelpers.Size());
+		for (size_t i = 0; i < mHelpers.Size(); ++i)
+		{
+			mHelpers[i]->GetHandledKeys(helperKeys[i]);
+			for (const std::string& key : helperKeys[i])
+			{
+				mKeyedHandlers.TryEmplace(key);
+			}
+		}
+
+		const IJsonParseHelper::ValueKind kinds[] = { IJsonParseHelper::ValueKind::Scalar, IJsonParseHelper::ValueKind::Object };
+		for (size_t i = 0; i < mHelpers.Size(); ++i)
+		{
+			IJsonParseHelper* helper = mHelpers[i];
+			for (IJsonParseHelper::ValueKind kind : kinds)
+			{
+				if (!helper->HandlesValueKind(kind))
+				{
+					continue;
+				}
+
+				auto handlersOfKind = [kind](KeyHandlers& handlers) -> Vector<IJsonParseHelper*>& { return kind == IJsonParseHelper::ValueKind::Object ? handlers.Objects : handlers.Scalars; };
+				if (helperKeys[i].IsEmpty())
+				{
+					handlersOfKind(mUnkeyedHandlers).PushBack(helper);
+					for (auto& pair : mKeyedHandlers)
+					{
+						handlersOfKind(pair.second).PushBack(helper);
+					}
+				}
+				else
+				{
+					for (const std::string& key : helperKeys[i])
+					{
+						// Keys declared twice, or differing only in case, share their lists
+						Vector<IJsonParseHelper*>& handlers = handlersOfKind(mKeyedHandlers.At(key));
+						if (handlers.IsEmpty() || handlers.Back() != helper)
+						{
+							handlers.PushBack(helper);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	const Vector<IJsonParseHelper*>& JsonParseMaster::Handlers(const std::string& key, bool isObject) const
+	{
+		const KeyHandlers* handlers = &mUnkeyedHandlers;
+		if (mKeyedHandlers.Size() > 0)
+		{
+			auto it = mKeyedHandlers.Find(key);
+			if (it != mKeyedHandlers.end())
+			{
+				handlers = &it->second;
+			}
+		}
+
+		return isObject ? handlers->Objects : handlers->Scalars;
+	}
+
+	void JsonParseMaster::ParseDocument(Json::Value& root)
+	{
 		for (auto& helper : mHelpers)
 		{
 			helper->Initialize();
@@ -168,6 +284,42 @@ namespace Library
 		mSharedData->DecrementDepth();
 	}
 
+	void JsonParseMaster::ParseStream(JsonStreamReader& reader)
+	{
+		for (auto& helper : mHelpers)
+		{
+			helper->Initialize();
+		}
+
+		if (reader.Peek() != '{')
+		{
+			throw std::runtime_error("The root of the JSON must be an object");
+		}
+
+		// A syntax error can stop the parse at any depth, the SharedData is left at the depth it started at
+		const size_t depth = mSharedData->Depth();
+		try
+		{
+			reader.Expect('{');
+			mSharedData->IncrementDepth();
+			StreamMembers(reader);
+			mSharedData->DecrementDepth();
+
+			if (!reader.AtEnd())
+			{
+				throw std::runtime_error("Unexpected characters after the root of the JSON, on line " + std::to_string(reader.Line()));
+			}
+		}
+		catch (...)
+		{
+			while (mSharedData->Depth() > depth)
+			{
+				mSharedData->DecrementDepth();
+			}
+			throw;
+		}
+	}
+
 	void JsonParseMaster::ParseMembers(Json::Value& jsonValue, bool isArrayElement, size_t index)
 	{
 		for (const auto& key : jsonValue.getMemberNames())
@@ -181,37 +333,128 @@ namespace Library
 	{
 		assert(mSharedData != nullptr);
 
-		for (IJsonParseHelper* helper : mHelpers)
+		if (value.isArray())
 		{
-			if (value.isArray())
+			if (mHelpers.IsEmpty())
 			{
-				for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+				return;
+			}
+
+			for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+			{
+				if (value[i].isObject())
 				{
-					if (value[i].isObject())
-					{
-						mSharedData->IncrementDepth();
-						ParseMembers(value[i], true, i);
-						mSharedData->DecrementDepth();
-					}
-					else
-					{
-						ParseKeyValuePair(key, value[i], true, i);
-					}
+					mSharedData->IncrementDepth();
+					ParseMembers(value[i], true, i);
+					mSharedData->DecrementDepth();
+				}
+				else
+				{
+					ParseKeyValuePair(key, value[i], true, i);
 				}
-				break;
 			}
-			else if (value.isObject())
+			return;
+		}
+
+		const bool isObject = value.isObject();
+		for (IJsonParseHelper* helper : Handlers(key, isObject))
+		{
+			if (helper->StartHandler(*mSharedData, key, value, isArrayElement, index))
 			{
-				if (helper->StartHandler(*mSharedData, key, value, isArrayElement, index))
+				if (isObject)
 				{
 					mSharedData->IncrementDepth();
 					ParseMembers(value);
 					mSharedData->DecrementDepth();
+				}
+				helper->EndHandler(*mSharedData, key);
+				break;
+			}
+		}
+	}
+
+	void JsonParseMaster::StreamMembers(JsonStreamReader& reader, bool isArrayElement, size_t index)
+	{
+		if (reader.ConsumeIf('}'))
+		{
+			return;
+		}
+
+		// One key per level of nesting is all the parse keeps of the document
+		std::string key;
+		do
+		{
+			reader.ReadString(key);
+			reader.Expect(':');
+			StreamKeyValuePair(reader, key, isArrayElement, index);
+		} while (reader.ConsumeIf(','));
+
+		reader.Expect('}');
+	}
+
+	void JsonParseMaster::StreamKeyValuePair(JsonStreamReader& reader, const std::string& key, bool isArrayElement, size_t index)
+	{
+		assert(mSharedData != nullptr);
+
+		if (mHelpers.IsEmpty())
+		{
+			reader.SkipValue();
+			return;
+		}
+
+		switch (reader.Peek())
+		{
+		case '[':
+		{
+			reader.Expect('[');
+			if (reader.ConsumeIf(']'))
+			{
+				return;
+			}
+
+			size_t i = 0;
+			do
+			{
+				if (reader.ConsumeIf('{'))
+				{
+					mSharedData->IncrementDepth();
+					StreamMembers(reader, true, i);
+					mSharedData->DecrementDepth();
+				}
+				else
+				{
+					StreamKeyValuePair(reader, key, true, i);
+				}
+				++i;
+			} while (reader.ConsumeIf(','));
+
+			reader.Expect(']');
+			break;
+		}
+		case '{':
+		{
+			Json::Value object(Json::objectValue);
+			for (IJsonParseHelper* helper : Handlers(key, true))
+			{
+				if (helper->StartHandler(*mSharedData, key, object, isArrayElement, index))
+				{
+					reader.Expect('{');
+					mSharedData->IncrementDepth();
+					StreamMembers(reader);
+					mSharedData->DecrementDepth();
 					helper->EndHandler(*mSharedData, key);
-					break;
+					return;
 				}
 			}
-			else
+
+			reader.SkipValue();
+			break;
+		}
+		default:
+		{
+			Json::Value value;
+			reader.ReadScalar(value);
+			for (IJsonParseHelper* helper : Handlers(key, false))
 			{
 				if (helper->StartHandler(*mSharedData, key, value, isArrayElement, index))
 				{
@@ -219,9 +462,21 @@ namespace Library
 					break;
 				}
 			}
+			break;
+		}
 		}
 	}
 
+	JsonParseMaster::ParseMode JsonParseMaster::GetParseMode() const
+	{
+		return mParseMode;
+	}
+
+	void JsonParseMaster::SetParseMode(ParseMode mode)
+	{
+		mParseMode = mode;
+	}
+
 	const std::string& JsonParseMaster::GetFileName() const
 	{
 		return mFile;
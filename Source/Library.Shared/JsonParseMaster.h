@@ -3,16 +3,30 @@
 #include <json/json.h>
 #include <gsl/gsl>
 #include "Vector.h"
+#include "HashMap.h"
 #include "RTTI.h"
 
 namespace Library
 {
 	class IJsonParseHelper;
+	class JsonStreamReader;
 
 	class JsonParseMaster final
 	{
 	public:
 
+		/// <summary>
+		/// How a JsonParseMaster reads its JSON.
+		/// Document reads the whole document into a Json::Value first and visits the members of each object in alphabetical order.
+		/// Stream feeds the helpers while it reads, in the order the members appear in the document, keeping only the path to the current value in memory.
+		/// In Stream mode the Json::Value a helper receives for an object is empty, since its members have not been read yet, and arrives as their own calls
+		/// </summary>
+		enum class ParseMode
+		{
+			Document,
+			Stream
+		};
+
 		/// <summary>
 		/// The SharedData used by the ParseMasters helpers to record the information handled.
 		/// </summary>
@@ -140,7 +154,7 @@ namespace Library
 		gsl::owner<JsonParseMaster*> Clone() const;
 
 		/// <summary>
-		/// Adds an IJsonParseHelper to this parser's lists of helpers.
+		/// Adds an IJsonParseHelper to this parser's lists of helpers. The keys and kinds of values it handles are added to the table the members are dispatched through.
 		/// </summary>
 		/// <param name="helper">The IJsonParseHelper being added to the list of helpers</param>
 		void AddHelper(IJsonParseHelper& helper);
@@ -156,16 +170,30 @@ namespace Library
 		/// <param name="rawJson">The JSON string to be converted into a runtime object</param>
 		void Parse(const std::string& rawJson);
 		/// <summary>
-		/// Parses the passed in files JSON data into its correct c++ object if this JsonParseMaster can handle the passed in data
+		/// Parses the passed in files JSON data into its correct c++ object if this JsonParseMaster can handle the passed in data.
+		/// The file is memory mapped and parsed in place rather than read through a stream
 		/// </summary>
 		/// <param name="rawJson">The file name of the file that contains the JSON data to be converted into a runtime object</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the file can't be mapped, if the root of the JSON is not an object or if the JSON is malformed</exception>
 		void ParseFromFile(const std::string& filename);
 		/// <summary>
 		/// Parses the passed in stream of JSON data into its correct c++ object if this JsonParseMaster can handle the passed in data
 		/// </summary>
 		/// <param name="rawJson">The istream of JSON to be converted into a runtime object</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the root of the JSON is not an object or if the JSON is malformed</exception>
 		void Parse(std::istream& stream);
 
+		/// <summary>
+		/// Returns how this parser reads its JSON
+		/// </summary>
+		/// <returns>The ParseMode of this parser</returns>
+		ParseMode GetParseMode() const;
+		/// <summary>
+		/// Sets how this parser reads its JSON. Clones use the mode of the parser they were cloned from
+		/// </summary>
+		/// <param name="mode">The new ParseMode of this parser</param>
+		void SetParseMode(ParseMode mode);
+
 		/// <summary>
 		/// Returns the FileName of the file read by ParseFile. Will return an empty string if ParseFile was not called.
 		/// </summary>
@@ -195,6 +223,38 @@ namespace Library
 		const Vector<IJsonParseHelper*>& Helpers() const;
 
 	private:
+		/// <summary>
+		/// The helpers offered the members with one key, in the order they were added, split by the kind of value
+		/// </summary>
+		struct KeyHandlers
+		{
+			Vector<IJsonParseHelper*> Scalars;
+			Vector<IJsonParseHelper*> Objects;
+		};
+
+		/// <summary>
+		/// Rebuilds the table the members are dispatched through from the keys and kinds of values each helper handles
+		/// </summary>
+		void BuildDispatchTable();
+		/// <summary>
+		/// Returns the helpers offered a member, in the order they were added. Costs a single lookup however many helpers there are
+		/// </summary>
+		/// <param name="key">The key of the member</param>
+		/// <param name="isObject">Whether the value of the member is an object</param>
+		/// <returns>The helpers that may handle the member</returns>
+		const Vector<IJsonParseHelper*>& Handlers(const std::string& key, bool isObject) const;
+
+		/// <summary>
+		/// Initializes the helpers and hands them the members of a parsed document.
+		/// </summary>
+		/// <param name="root">The root object of the document</param>
+		void ParseDocument(Json::Value& root);
+		/// <summary>
+		/// Initializes the helpers and hands them the members of the document being read, as they are read.
+		/// </summary>
+		/// <param name="reader">The reader of the document</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the root of the JSON is not an object or if the JSON is malformed</exception>
+		void ParseStream(JsonStreamReader& reader);
 		/// <summary>
 		/// Given a Json::Value it will individual parse each member contained within the object and create the corresponding
 		/// c++ object within the SharedData object if it was able to handle the passed in data.
@@ -209,6 +269,24 @@ namespace Library
 		/// <param name="isArrayElement">A boolean that tells the parser if it is currently parsing an element of an array</param>
 		void ParseKeyValuePair(const std::string& key, Json::Value& value, bool isArrayElement = false, size_t index = 0);
 
+		/// <summary>
+		/// Reads the members of an object from the stream and hands each of them to the helpers, the way ParseMembers does for a parsed document.
+		/// The opening brace has already been read
+		/// </summary>
+		/// <param name="reader">The reader of the stream</param>
+		/// <param name="isArrayElement">Whether the object is an element of an array</param>
+		/// <param name="index">The index of the object within its array</param>
+		void StreamMembers(JsonStreamReader& reader, bool isArrayElement = false, size_t index = 0);
+		/// <summary>
+		/// Reads the value of a member from the stream and hands it to the helpers, the way ParseKeyValuePair does for a parsed document.
+		/// Objects no helper accepts are skipped without being handled
+		/// </summary>
+		/// <param name="reader">The reader of the stream</param>
+		/// <param name="key">The key of the member</param>
+		/// <param name="isArrayElement">Whether the value is an element of an array</param>
+		/// <param name="index">The index of the value within its array</param>
+		void StreamKeyValuePair(JsonStreamReader& reader, const std::string& key, bool isArrayElement = false, size_t index = 0);
+
 		/// <summary>
 		/// Vector of IJsonParseHelpers used to handle parsed JSON data
 		/// </summary>
@@ -225,6 +303,19 @@ namespace Library
 		/// A flag to represent if this parser is a clone and owns its own memory. If true the destructor must handle freeing up the allocated memory.
 		/// </summary>
 		bool mIsClone = false;
+		/// <summary>
+		/// How this parser reads its JSON
+		/// </summary>
+		ParseMode mParseMode = ParseMode::Document;
+		/// <summary>
+		/// The helpers offered the members with each key some helper declared, keys matched regardless of case.
+		/// Every list also holds the helpers that declared no keys, so a lookup finds all the candidates at once
+		/// </summary>
+		HashMap<std::string, KeyHandlers, CaseInsensitiveHash, CaseInsensitiveEquality> mKeyedHandlers;
+		/// <summary>
+		/// The helpers offered the members whose key no helper declared
+		/// </summary>
+		KeyHandlers mUnkeyedHandlers;
 	};
 }
 
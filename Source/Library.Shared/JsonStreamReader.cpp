@@ -0,0 +1,415 @@
+#include "pch.h"
+#include "JsonStreamReader.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// Finds the first character that ends a run of plain string characters: a quote, a backslash or a newline.
+		/// Tests eight characters at a time, a word with none of them is skipped with a handful of integer operations
+		/// </summary>
+		/// <param name="begin">The first character searched</param>
+		/// <param name="end">One past the last character searched</param>
+		/// <returns>The address of the first special character, end if there is none</returns>
+		const char* FindStringSpecial(const char* begin, const char* end)
+		{
+			constexpr std::uint64_t ones = 0x0101010101010101;
+			constexpr std::uint64_t highs = 0x8080808080808080;
+			auto hasCharacter = [](std::uint64_t word, std::uint64_t character)
+			{
+				const std::uint64_t matches = word ^ (ones * character);
+				return (matches - ones) & ~matches & highs;
+			};
+
+			for (; end - begin >= 8; begin += 8)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, begin, sizeof(word));
+				if ((hasCharacter(word, '"') | hasCharacter(word, '\\') | hasCharacter(word, '\n')) != 0)
+				{
+					break;
+				}
+			}
+
+			while (begin != end && *begin != '"' && *begin != '\\' && *begin != '\n')
+			{
+				++begin;
+			}
+
+			return begin;
+		}
+	}
+
+	JsonStreamReader::JsonStreamReader(std::istream& stream, size_t bufferSize) :
+		mStream(&stream)
+	{
+		assert(bufferSize > 0);
+		mBuffer.Resize(bufferSize);
+		mData = &mBuffer[0];
+	}
+
+	JsonStreamReader::JsonStreamReader(const char* data, size_t length) :
+		mData(data != nullptr ? data : ""), mLength(length)
+	{
+		assert(data != nullptr || length == 0);
+	}
+
+	char JsonStreamReader::Peek()
+	{
+		do
+		{
+			// Whitespace is skipped straight out of the buffer, PeekRaw only runs again once it is used up
+			for (; mPosition < mLength; ++mPosition)
+			{
+				const char character = mData[mPosition];
+				if (character == '\n')
+				{
+					++mLine;
+				}
+				else if (character != ' ' && character != '\t' && character != '\r')
+				{
+					return character;
+				}
+			}
+		} while (PeekRaw() != '\0');
+
+		return '\0';
+	}
+
+	bool JsonStreamReader::ConsumeIf(char character)
+	{
+		if (Peek() != character)
+		{
+			return false;
+		}
+
+		Next();
+		return true;
+	}
+
+	void JsonStreamReader::Expect(char character)
+	{
+		if (!ConsumeIf(character))
+		{
+			char message[] = "Expected ' '";
+			message[10] = character;
+			Fail(message);
+		}
+	}
+
+	void JsonStreamReader::ReadString(std::string& text)
+	{
+		Expect('"');
+		text.clear();
+
+		for (;;)
+		{
+			// Runs of plain characters are copied in one go, only what ends them goes through Next
+			const char* run = mData + mPosition;
+			const char* runEnd = FindStringSpecial(run, mData + mLength);
+			text.append(run, runEnd);
+			mPosition += static_cast<size_t>(runEnd - run);
+
+			char character = Next();
+			switch (character)
+			{
+			case '"':
+				return;
+			case '\0':
+				Fail("Unterminated string");
+			case '\\':
+				break;
+			default:
+				text.push_back(character);
+				continue;
+			}
+
+			character = Next();
+			switch (character)
+			{
+			case '"':
+			case '\\':
+			case '/':
+				text.push_back(character);
+				break;
+			case 'b':
+				text.push_back('\b');
+				break;
+			case 'f':
+				text.push_back('\f');
+				break;
+			case 'n':
+				text.push_back('\n');
+				break;
+			case 'r':
+				text.push_back('\r');
+				break;
+			case 't':
+				text.push_back('\t');
+				break;
+			case 'u':
+			{
+				unsigned int codePoint = ReadHexQuad();
+				if (codePoint >= 0xD800 && codePoint < 0xDC00)
+				{
+					if (Next() != '\\' || Next() != 'u')
+					{
+						Fail("Expected the second half of a surrogate pair");
+					}
+
+					unsigned int low = ReadHexQuad();
+					if (low < 0xDC00 || low >= 0xE000)
+					{
+						Fail("Invalid surrogate pair");
+					}
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				if (codePoint < 0x80)
+				{
+					text.push_back(static_cast<char>(codePoint));
+				}
+				else if (codePoint < 0x800)
+				{
+					text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else if (codePoint < 0x10000)
+				{
+					text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else
+				{
+					text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				break;
+			}
+			default:
+				Fail("Invalid escape sequence");
+			}
+		}
+	}
+
+	void JsonStreamReader::ReadScalar(Json::Value& value)
+	{
+		switch (Peek())
+		{
+		case '"':
+		{
+			std::string text;
+			ReadString(text);
+			value = Json::Value(std::move(text));
+			break;
+		}
+		case 't':
+			ExpectLiteral("true");
+			value = Json::Value(true);
+			break;
+		case 'f':
+			ExpectLiteral("false");
+			value = Json::Value(false);
+			break;
+		case 'n':
+			ExpectLiteral("null");
+			value = Json::Value();
+			break;
+		default:
+			ReadNumber(value);
+			break;
+		}
+	}
+
+	void JsonStreamReader::SkipValue()
+	{
+		// Only the number of open objects and arrays matters while skipping, so a counter stands in for the recursion
+		size_t depth = 0;
+		do
+		{
+			switch (Peek())
+			{
+			case '{':
+			case '[':
+				Next();
+				++depth;
+				continue;
+			case '}':
+			case ']':
+				if (depth == 0)
+				{
+					Fail("Unexpected end of a value");
+				}
+				Next();
+				--depth;
+				break;
+			case '"':
+				ReadString(mToken);
+				if (ConsumeIf(':'))
+				{
+					continue;
+				}
+				break;
+			case ',':
+				Next();
+				continue;
+			case '\0':
+				Fail("Unexpected end of the stream");
+			default:
+			{
+				Json::Value scalar;
+				ReadScalar(scalar);
+				break;
+			}
+			}
+		} while (depth > 0);
+	}
+
+	bool JsonStreamReader::AtEnd()
+	{
+		return Peek() == '\0';
+	}
+
+	size_t JsonStreamReader::Line() const
+	{
+		return mLine;
+	}
+
+	bool JsonStreamReader::Fill()
+	{
+		if (mStream == nullptr)
+		{
+			return false;
+		}
+
+		mPosition = 0;
+		mLength = 0;
+		if (mStream->good())
+		{
+			mStream->read(&mBuffer[0], static_cast<std::streamsize>(mBuffer.Size()));
+			mLength = static_cast<size_t>(mStream->gcount());
+		}
+
+		return mLength > 0;
+	}
+
+	char JsonStreamReader::PeekRaw()
+	{
+		if (mPosition == mLength && !Fill())
+		{
+			return '\0';
+		}
+
+		return mData[mPosition];
+	}
+
+	char JsonStreamReader::Next()
+	{
+		char character = PeekRaw();
+		if (character != '\0')
+		{
+			++mPosition;
+			if (character == '\n')
+			{
+				++mLine;
+			}
+		}
+
+		return character;
+	}
+
+	void JsonStreamReader::ExpectLiteral(const char* literal)
+	{
+		for (; *literal != '\0'; ++literal)
+		{
+			if (Next() != *literal)
+			{
+				Fail("Invalid literal");
+			}
+		}
+	}
+
+	unsigned int JsonStreamReader::ReadHexQuad()
+	{
+		unsigned int value = 0;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			char character = Next();
+			value <<= 4;
+			if (character >= '0' && character <= '9')
+			{
+				value |= static_cast<unsigned int>(character - '0');
+			}
+			else if (character >= 'a' && character <= 'f')
+			{
+				value |= static_cast<unsigned int>(character - 'a' + 10);
+			}
+			else if (character >= 'A' && character <= 'F')
+			{
+				value |= static_cast<unsigned int>(character - 'A' + 10);
+			}
+			else
+			{
+				Fail("Invalid \\u escape");
+			}
+		}
+
+		return value;
+	}
+
+	void JsonStreamReader::ReadNumber(Json::Value& value)
+	{
+		mToken.clear();
+		bool isInteger = true;
+		for (char character = PeekRaw(); (character >= '0' && character <= '9') || character == '-' || character == '+' || character == '.' || character == 'e' || character == 'E'; character = PeekRaw())
+		{
+			isInteger = isInteger && character != '.' && character != 'e' && character != 'E';
+			mToken.push_back(Next());
+		}
+
+		if (mToken.empty() || mToken == "-")
+		{
+			Fail("Expected a value");
+		}
+
+		const char* begin = mToken.c_str();
+		char* end = nullptr;
+		if (isInteger)
+		{
+			errno = 0;
+			long long integer = std::strtoll(begin, &end, 10);
+			if (errno == 0 && *end == '\0')
+			{
+				value = Json::Value(static_cast<Json::LargestInt>(integer));
+				return;
+			}
+
+			errno = 0;
+			unsigned long long unsignedInteger = std::strtoull(begin, &end, 10);
+			if (errno == 0 && *end == '\0' && mToken[0] != '-')
+			{
+				value = Json::Value(static_cast<Json::LargestUInt>(unsignedInteger));
+				return;
+			}
+		}
+
+		double real = std::strtod(begin, &end);
+		if (*end != '\0')
+		{
+			Fail("Invalid number");
+		}
+		value = Json::Value(real);
+	}
+
+	void JsonStreamReader::Fail(const char* message) const
+	{
+		throw std::runtime_error(std::string(message) + " on line " + std::to_string(mLine) + " of the JSON stream");
+	}
+}
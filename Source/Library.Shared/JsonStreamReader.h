@@ -0,0 +1,146 @@
+#pragma once
+
+#include <istream>
+#include <string>
+#include <json/json.h>
+#include "Vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Reads JSON tokens from a stream a buffer at a time, or from characters already in memory, without building a document. Used by JsonParseMaster to feed its helpers
+	/// while it reads, so the memory used by a parse is bounded by the nesting depth of the document and the size of its largest value instead of the size of the file.
+	/// Syntax errors throw a std::runtime_error that names the line they were found on
+	/// </summary>
+	class JsonStreamReader final
+	{
+	public:
+
+		/// <summary>
+		/// The number of characters read from the stream at a time when no other buffer size is given
+		/// </summary>
+		inline static const size_t DefaultBufferSize = 64 * 1024;
+
+		/// <summary>
+		/// Constructor that takes the stream to read and the number of characters read from it at a time.
+		/// </summary>
+		/// <param name="stream">The stream of JSON text</param>
+		/// <param name="bufferSize">The number of characters read from the stream at a time. Must not be 0</param>
+		explicit JsonStreamReader(std::istream& stream, size_t bufferSize = DefaultBufferSize);
+		/// <summary>
+		/// Constructor that reads characters already in memory, such as those of a MemoryMappedFile, in place. They must outlive the reader
+		/// </summary>
+		/// <param name="data">The first character of the JSON text</param>
+		/// <param name="length">The number of characters of JSON text</param>
+		JsonStreamReader(const char* data, size_t length);
+		JsonStreamReader(const JsonStreamReader&) = delete;
+		JsonStreamReader(JsonStreamReader&&) = delete;
+		JsonStreamReader& operator=(const JsonStreamReader&) = delete;
+		JsonStreamReader& operator=(JsonStreamReader&&) = delete;
+		~JsonStreamReader() = default;
+
+		/// <summary>
+		/// Skips whitespace and returns the next character without consuming it.
+		/// </summary>
+		/// <returns>The next character, or '\0' once the stream is exhausted</returns>
+		char Peek();
+		/// <summary>
+		/// Skips whitespace and consumes the next character if it is the passed in one.
+		/// </summary>
+		/// <param name="character">The character expected next</param>
+		/// <returns>True if the character was consumed, false otherwise</returns>
+		bool ConsumeIf(char character);
+		/// <summary>
+		/// Skips whitespace and consumes the next character, which must be the passed in one.
+		/// </summary>
+		/// <param name="character">The character expected next</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the next character is a different one</exception>
+		void Expect(char character);
+
+		/// <summary>
+		/// Reads a quoted string, such as the key of a member, into the passed in string. Escape sequences are decoded, \u escapes into UTF-8.
+		/// </summary>
+		/// <param name="text">The string receiving the characters. Its storage is reused</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the next token is not a well formed string</exception>
+		void ReadString(std::string& text);
+		/// <summary>
+		/// Reads a string, number, true, false or null into the passed in value, typed the way jsoncpp types the values it parses.
+		/// </summary>
+		/// <param name="value">The value receiving the scalar</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the next token is not a scalar</exception>
+		void ReadScalar(Json::Value& value);
+		/// <summary>
+		/// Skips the next value, including every value nested within it. Uses no recursion, so the depth of the skipped value doesn't matter
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws an exception if the skipped value is not well formed</exception>
+		void SkipValue();
+
+		/// <summary>
+		/// Skips whitespace and checks whether the whole stream has been read.
+		/// </summary>
+		/// <returns>True if nothing but whitespace is left, false otherwise</returns>
+		bool AtEnd();
+		/// <summary>
+		/// Returns the line of the stream being read, starting at 1
+		/// </summary>
+		/// <returns>The current line</returns>
+		size_t Line() const;
+
+	private:
+		/// <summary>
+		/// Reads the next buffer of characters from the stream.
+		/// </summary>
+		/// <returns>True if any characters were read, false if the stream is exhausted or the reader reads from memory</returns>
+		bool Fill();
+		/// <summary>
+		/// Returns the next character without skipping whitespace, or '\0' once the stream is exhausted
+		/// </summary>
+		/// <returns>The next character</returns>
+		char PeekRaw();
+		/// <summary>
+		/// Consumes and returns the next character without skipping whitespace
+		/// </summary>
+		/// <returns>The consumed character, or '\0' once the stream is exhausted</returns>
+		char Next();
+		/// <summary>
+		/// Consumes the passed in literal, such as true or null
+		/// </summary>
+		/// <param name="literal">The characters expected next</param>
+		void ExpectLiteral(const char* literal);
+		/// <summary>
+		/// Reads four hexadecimal digits of a \u escape
+		/// </summary>
+		/// <returns>The UTF-16 code unit</returns>
+		unsigned int ReadHexQuad();
+		/// <summary>
+		/// Reads a number into the passed in value, as an integer if it has no fraction or exponent and fits in one
+		/// </summary>
+		/// <param name="value">The value receiving the number</param>
+		void ReadNumber(Json::Value& value);
+		/// <summary>
+		/// Throws a std::runtime_error describing a syntax error on the current line.
+		/// </summary>
+		/// <param name="message">The description of the error</param>
+		[[noreturn]] void Fail(const char* message) const;
+
+		/// <summary>
+		/// The stream read from, nullptr when reading from memory
+		/// </summary>
+		std::istream* mStream = nullptr;
+		/// <summary>
+		/// Holds the characters read from the stream, unused when reading from memory
+		/// </summary>
+		Vector<char> mBuffer;
+		/// <summary>
+		/// The characters being read, those not consumed yet run from mPosition to mLength
+		/// </summary>
+		const char* mData = nullptr;
+		size_t mPosition = 0;
+		size_t mLength = 0;
+		size_t mLine = 1;
+		/// <summary>
+		/// Holds the characters of the number being read, reused between numbers
+		/// </summary>
+		std::string mToken;
+	};
+}
@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "JsonTableLoader.h"
+#include "JsonTableParseHelper.h"
+#include "Factory.h"
+#include <atomic>
+
+namespace Library
+{
+	JsonTableLoader::JsonTableLoader(const JsonParseMaster& parseMaster, size_t threadCount) :
+		mParseMaster(parseMaster), mThreadCount(threadCount)
+	{
+		const JsonParseMaster::SharedData* sharedData = parseMaster.GetSharedData();
+		if (sharedData == nullptr || !sharedData->Is(JsonTableParseHelper::TableSharedData::TypeIdClass()))
+		{
+			throw std::runtime_error("A JsonTableLoader needs a parse master that uses a TableSharedData");
+		}
+
+		if (mThreadCount == 0)
+		{
+			mThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+	}
+
+	void JsonTableLoader::AddFile(const std::string& filename, const std::string& className)
+	{
+		mSources.PushBack(Source{ filename, className, true });
+	}
+
+	void JsonTableLoader::AddFragment(const std::string& rawJson, const std::string& className)
+	{
+		mSources.PushBack(Source{ rawJson, className, false });
+	}
+
+	size_t JsonTableLoader::Size() const
+	{
+		return mSources.Size();
+	}
+
+	void JsonTableLoader::Clear()
+	{
+		mSources.Clear();
+	}
+
+	size_t JsonTableLoader::ThreadCount() const
+	{
+		return mThreadCount;
+	}
+
+	Vector<gsl::owner<Scope*>> JsonTableLoader::Load()
+	{
+		// Each slot is written by the one worker that took its index, so the results keep the order the sources were added in
+		Vector<gsl::owner<Scope*>> roots;
+		Vector<std::exception_ptr> errors;
+		roots.Resize(mSources.Size());
+		errors.Resize(mSources.Size());
+
+		std::atomic<size_t> nextSource = 0;
+		auto worker = [this, &nextSource, &roots, &errors]
+		{
+			for (size_t i = nextSource++; i < mSources.Size(); i = nextSource++)
+			{
+				try
+				{
+					LoadSource(mSources[i], roots[i]);
+				}
+				catch (...)
+				{
+					errors[i] = std::current_exception();
+				}
+			}
+		};
+
+		// The calling thread is one of the workers
+		const size_t workerCount = std::min(mThreadCount, mSources.Size());
+		Vector<std::future<void>> workers;
+		workers.Reserve(workerCount);
+		for (size_t i = 1; i < workerCount; ++i)
+		{
+			workers.EmplaceBack(std::async(std::launch::async, worker));
+		}
+		worker();
+
+		for (std::future<void>& future : workers)
+		{
+			future.wait();
+		}
+
+		for (std::exception_ptr& error : errors)
+		{
+			if (error != nullptr)
+			{
+				for (Scope* root : roots)
+				{
+					delete root;
+				}
+				std::rethrow_exception(error);
+			}
+		}
+
+		return roots;
+	}
+
+	void JsonTableLoader::LoadInto(Scope& parent, const std::string& key)
+	{
+		for (Scope* root : Load())
+		{
+			parent.Adopt(*root, key);
+		}
+	}
+
+	void JsonTableLoader::LoadSource(const Source& source, gsl::owner<Scope*>& root) const
+	{
+		root = source.ClassName.empty() ? new Scope : Factory<Scope>::Create(source.ClassName);
+		if (root == nullptr)
+		{
+			throw std::runtime_error("There is no factory for " + source.ClassName);
+		}
+
+		const std::unique_ptr<JsonParseMaster> parseMaster(mParseMaster.Clone());
+		parseMaster->GetSharedData()->As<JsonTableParseHelper::TableSharedData>()->SetScope(*root);
+		if (source.IsFile)
+		{
+			parseMaster->ParseFromFile(source.Text);
+		}
+		else
+		{
+			parseMaster->Parse(source.Text);
+		}
+	}
+}
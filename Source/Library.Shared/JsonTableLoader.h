@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string>
+#include <gsl/gsl>
+#include "JsonParseMaster.h"
+#include "Scope.h"
+#include "Vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Parses a set of JSON files or fragments concurrently, each into its own detached Scope, and adopts the results in the order they were added.
+	/// Every source gets its own clone of a JsonParseMaster whose SharedData is a JsonTableParseHelper::TableSharedData, so helpers never share state across threads.
+	/// Failed parses and the Scopes they leave behind are cleaned up on the calling thread once every worker has finished
+	/// </summary>
+	class JsonTableLoader final
+	{
+	public:
+
+		/// <summary>
+		/// Constructor that takes the parse master cloned for each source and the number of threads parsing at once.
+		/// </summary>
+		/// <param name="parseMaster">The parse master whose helpers and ParseMode are used for each source. Must use a TableSharedData</param>
+		/// <param name="threadCount">The number of threads parsing at once, 0 for one per hardware thread</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the parse master doesn't use a TableSharedData</exception>
+		explicit JsonTableLoader(const JsonParseMaster& parseMaster, size_t threadCount = 0);
+		JsonTableLoader(const JsonTableLoader&) = delete;
+		JsonTableLoader(JsonTableLoader&&) = delete;
+		JsonTableLoader& operator=(const JsonTableLoader&) = delete;
+		JsonTableLoader& operator=(JsonTableLoader&&) = delete;
+		~JsonTableLoader() = default;
+
+		/// <summary>
+		/// Queues a file to be parsed into a new Scope.
+		/// </summary>
+		/// <param name="filename">The name of the JSON file</param>
+		/// <param name="className">The name of the factory that creates the root of the file, such as Sector. Empty for a plain Scope</param>
+		void AddFile(const std::string& filename, const std::string& className = std::string());
+		/// <summary>
+		/// Queues a fragment of JSON text to be parsed into a new Scope.
+		/// </summary>
+		/// <param name="rawJson">The JSON text</param>
+		/// <param name="className">The name of the factory that creates the root of the fragment, such as Sector. Empty for a plain Scope</param>
+		void AddFragment(const std::string& rawJson, const std::string& className = std::string());
+		/// <summary>
+		/// Returns the number of queued sources.
+		/// </summary>
+		/// <returns>The number of files and fragments queued</returns>
+		size_t Size() const;
+		/// <summary>
+		/// Removes every queued source.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Returns the number of threads parsing at once.
+		/// </summary>
+		/// <returns>The number of threads</returns>
+		size_t ThreadCount() const;
+
+		/// <summary>
+		/// Parses every queued source and returns their roots. The queue is left as is so the same sources can be loaded again.
+		/// </summary>
+		/// <returns>The heap allocated root of each source, in the order they were added. The caller owns them</returns>
+		/// <exception cref="std::runtime_error">Rethrows the error of the first source, in the order they were added, that failed to parse. No roots are kept then</exception>
+		Vector<gsl::owner<Scope*>> Load();
+		/// <summary>
+		/// Parses every queued source and adopts their roots into the passed in Scope, in the order they were added.
+		/// Nothing is adopted if any source fails to parse.
+		/// </summary>
+		/// <param name="parent">The Scope adopting the roots, such as a World</param>
+		/// <param name="key">The attribute the roots are adopted into, such as Sectors</param>
+		/// <exception cref="std::runtime_error">Rethrows the error of the first source, in the order they were added, that failed to parse</exception>
+		void LoadInto(Scope& parent, const std::string& key);
+
+	private:
+		/// <summary>
+		/// A queued file or fragment
+		/// </summary>
+		struct Source
+		{
+			std::string Text;
+			std::string ClassName;
+			bool IsFile;
+		};
+
+		/// <summary>
+		/// Parses a single source into a new root Scope with its own clone of the parse master.
+		/// </summary>
+		/// <param name="source">The source being parsed</param>
+		/// <param name="root">Receives the root as soon as it is created, so it is cleaned up even if the parse fails</param>
+		void LoadSource(const Source& source, gsl::owner<Scope*>& root) const;
+
+		const JsonParseMaster& mParseMaster;
+		Vector<Source> mSources;
+		size_t mThreadCount;
+	};
+}
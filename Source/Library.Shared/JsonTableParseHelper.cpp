@@ -9,7 +9,7 @@ namespace Library
 	RTTI_DEFINITIONS(JsonTableParseHelper);
 	RTTI_DEFINITIONS(JsonTableParseHelper::TableSharedData);
 
-	const HashMap<std::string, Datum::DatumTypes> JsonTableParseHelper::ValueTypes = {
+	const HashMap<std::string_view, Datum::DatumTypes, CaseInsensitiveHash, CaseInsensitiveEquality> JsonTableParseHelper::ValueTypes = {
 		std::pair("integer", Datum::DatumTypes::Integer),
 		std::pair("float", Datum::DatumTypes::Float),
 		std::pair("vector", Datum::DatumTypes::Vector),
@@ -69,36 +69,46 @@ namespace Library
 			return false;
 		}
 
-		std::string lowercaseKey = jsonKey;
-		for (char& c : lowercaseKey)
-		{
-			c = static_cast<char>(std::tolower(c));
-		}
-
-		if (lowercaseKey == "class")
+		auto valueType = ValueTypes.Find(jsonKey);
+		if (CaseInsensitiveEquality()(jsonKey, "class"))
 		{
 			StackFrame& stackFrame = mStack.Peek();
 			Scope* createdScope = Factory<Scope>::Create(object.asString());
 			assert(createdScope != nullptr);
+
+			// A stream is read in document order, so the table of an object may come before its class. The Scope it was parsed into gives way to the class
+			if (stackFrame.untypedTable != nullptr && stackFrame.untypedIndex == index)
+			{
+				Scope* untypedTable = stackFrame.untypedTable;
+				stackFrame.untypedTable = nullptr;
+				MoveAttributes(*untypedTable, *createdScope);
+				untypedTable->Orphan();
+				delete untypedTable;
+			}
+
 			stackFrame.context.Adopt(*createdScope, stackFrame.key);
 		}
-		else if (ValueTypes.ContainsKey(lowercaseKey))
+		else if (valueType != ValueTypes.end())
 		{
 			StackFrame& stackFrame = mStack.Peek();
 			Datum* datum = stackFrame.context.Find(stackFrame.key);
 			assert(datum != nullptr);
 
-			datum->SetType(ValueTypes.At(lowercaseKey));
+			datum->SetType(valueType->second);
 			
 			if (datum->Type() == Datum::DatumTypes::Table)
 			{
 				if (index < datum->Size())
 				{
+					stackFrame.untypedTable = nullptr;
 					mStack.Push({ jsonKey, *datum->GetScope(index) });
 				}
 				else
 				{
-					mStack.Push({ jsonKey, stackFrame.context.AppendScope(stackFrame.key) });
+					Scope& table = stackFrame.context.AppendScope(stackFrame.key);
+					stackFrame.untypedTable = &table;
+					stackFrame.untypedIndex = index;
+					mStack.Push({ jsonKey, table });
 				}
 			}
 			else
@@ -148,6 +158,62 @@ namespace Library
 		return true;
 	}
 
+	void JsonTableParseHelper::MoveAttributes(Scope& source, Scope& target)
+	{
+		for (Scope::PairType* pair : source.GetOrderVector())
+		{
+			const Datum& from = pair->second;
+			Datum& to = target.Append(pair->first);
+			if (from.Type() == Datum::DatumTypes::Unknown)
+			{
+				continue;
+			}
+
+			if (from.Type() == Datum::DatumTypes::Table)
+			{
+				Vector<Scope*> children(from.Size());
+				for (size_t i = 0; i < from.Size(); ++i)
+				{
+					children.PushBack(from.GetScope(i));
+				}
+
+				for (Scope* child : children)
+				{
+					target.Adopt(*child, pair->first);
+				}
+				continue;
+			}
+
+			to.SetType(from.Type());
+			if (!to.IsExternalStorage() && to.Size() < from.Size())
+			{
+				to.Resize(from.Size());
+			}
+
+			for (size_t i = 0; i < from.Size(); ++i)
+			{
+				switch (from.Type())
+				{
+				case Datum::DatumTypes::Integer:
+					to.Set(from.GetInt(i), i);
+					break;
+				case Datum::DatumTypes::Float:
+					to.Set(from.GetFloat(i), i);
+					break;
+				case Datum::DatumTypes::Vector:
+					to.Set(from.GetVector(i), i);
+					break;
+				case Datum::DatumTypes::Matrix:
+					to.Set(from.GetMatrix(i), i);
+					break;
+				case Datum::DatumTypes::String:
+					to.Set(from.GetString(i), i);
+					break;
+				}
+			}
+		}
+	}
+
 	std::string JsonTableParseHelper::ToString() const
 	{
 		return "JsonTableParseHelper";
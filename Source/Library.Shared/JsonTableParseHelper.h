@@ -97,8 +97,9 @@ namespace Library
 
 		/// <summary>
 		/// Static HashMap that pairs strings to DatumTypes. Used to convert a JSON strings that represent DatumTypes into actual DatumTypes.
+		/// Keys are matched regardless of case and looked up without copying them
 		/// </summary>
-		const static HashMap<std::string, Datum::DatumTypes> ValueTypes;
+		const static HashMap<std::string_view, Datum::DatumTypes, CaseInsensitiveHash, CaseInsensitiveEquality> ValueTypes;
 
 		/// <summary>
 		/// Defaulted constructor that default constructs the contained stack.
@@ -141,7 +142,7 @@ namespace Library
 		/// <summary>
 		/// Checks whether or not this helper can handle the passed in JSON data. 
 		/// If it can handle the passed in data it will populate the Scope contained within the passed in SharedData with the correct information based on what is passed to the handler.
-		/// Uses a stack to hold data if the JSON has nested objects.
+		/// Uses a stack to hold data if the JSON has nested objects. The class of an object may come before or after its table, since Stream mode visits members in document order.
 		/// </summary>
 		/// <param name="sharedData">Must be a TableSharedData with a valid pointer to a Scope. Used to populate said Scope with its correct information</param>
 		/// <param name="jsonKey">The JSON key of the current object being analyzed</param>
@@ -186,8 +187,24 @@ namespace Library
 			/// The scope being modified by the current frame. Used to help maintain what scope is being modified when going into nested objects
 			/// </summary>
 			Scope& context;
+			/// <summary>
+			/// The Scope most recently appended under key for a table that came before any class. A class that follows it at the same index replaces it
+			/// </summary>
+			Scope* untypedTable = nullptr;
+			/// <summary>
+			/// The array index untypedTable was appended for
+			/// </summary>
+			size_t untypedIndex = 0;
 		};
 
+		/// <summary>
+		/// Moves every attribute of a Scope parsed before its class was known into the Scope created for that class.
+		/// Values are written element by element so the prescribed attributes of the class keep their external storage, and nested Scopes are adopted
+		/// </summary>
+		/// <param name="source">The Scope the table was parsed into</param>
+		/// <param name="target">The Scope created for the class</param>
+		static void MoveAttributes(Scope& source, Scope& target);
+
 		/// <summary>
 		/// A stack that holds StackFrame information as the JSON descends into deeper levels.
 		/// </summary>
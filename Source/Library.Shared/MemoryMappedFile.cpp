@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "MemoryMappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Library
+{
+	MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+	{
+		// The view keeps the file mapped on its own, so the handles are closed as soon as it exists
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error("Unable to open " + filename);
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Unable to read the size of " + filename);
+		}
+
+		if (size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr)
+		{
+			throw std::runtime_error("Unable to map " + filename);
+		}
+
+		mData = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(mapping);
+		if (mData == nullptr)
+		{
+			throw std::runtime_error("Unable to map " + filename);
+		}
+		mSize = static_cast<size_t>(size.QuadPart);
+#else
+		int file = open(filename.c_str(), O_RDONLY);
+		if (file == -1)
+		{
+			throw std::runtime_error("Unable to open " + filename);
+		}
+
+		struct stat status;
+		if (fstat(file, &status) == -1)
+		{
+			close(file);
+			throw std::runtime_error("Unable to read the size of " + filename);
+		}
+
+		if (status.st_size == 0)
+		{
+			close(file);
+			return;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (data == MAP_FAILED)
+		{
+			throw std::runtime_error("Unable to map " + filename);
+		}
+
+		madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+		mData = static_cast<const char*>(data);
+		mSize = static_cast<size_t>(status.st_size);
+#endif
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept :
+		mData(rhs.mData), mSize(rhs.mSize)
+	{
+		rhs.mData = nullptr;
+		rhs.mSize = 0;
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Unmap();
+			mData = rhs.mData;
+			mSize = rhs.mSize;
+			rhs.mData = nullptr;
+			rhs.mSize = 0;
+		}
+
+		return *this;
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Unmap();
+	}
+
+	const char* MemoryMappedFile::Data() const
+	{
+		return mData;
+	}
+
+	size_t MemoryMappedFile::Size() const
+	{
+		return mSize;
+	}
+
+	void MemoryMappedFile::Unmap() noexcept
+	{
+		if (mData != nullptr)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(mData);
+#else
+			munmap(const_cast<char*>(mData), mSize);
+#endif
+			mData = nullptr;
+			mSize = 0;
+		}
+	}
+}
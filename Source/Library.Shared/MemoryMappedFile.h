@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+
+namespace Library
+{
+	/// <summary>
+	/// Maps a whole file into memory, read only, for as long as it lives. The operating system pages the file in as it is read,
+	/// so it is never copied into a buffer of our own
+	/// </summary>
+	class MemoryMappedFile final
+	{
+	public:
+
+		/// <summary>
+		/// Constructor that maps the passed in file.
+		/// </summary>
+		/// <param name="filename">The name of the file being mapped</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the file can't be opened or mapped</exception>
+		explicit MemoryMappedFile(const std::string& filename);
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		/// <summary>
+		/// Move constructor, the moved from file no longer maps anything.
+		/// </summary>
+		/// <param name="rhs">The MemoryMappedFile being moved into this one</param>
+		MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+		/// <summary>
+		/// Move assignment operator, unmaps the file this one mapped before taking over that of rhs.
+		/// </summary>
+		/// <param name="rhs">The MemoryMappedFile being moved into this one</param>
+		/// <returns>A reference to this MemoryMappedFile after its been mutated</returns>
+		MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+		/// <summary>
+		/// Destructor that unmaps the file.
+		/// </summary>
+		~MemoryMappedFile();
+
+		/// <summary>
+		/// Returns the first character of the file.
+		/// </summary>
+		/// <returns>The address of the mapped file, nullptr if the file is empty</returns>
+		const char* Data() const;
+		/// <summary>
+		/// Returns the size of the file.
+		/// </summary>
+		/// <returns>The number of characters in the file</returns>
+		size_t Size() const;
+
+	private:
+		/// <summary>
+		/// Unmaps the file, if any
+		/// </summary>
+		void Unmap() noexcept;
+
+		const char* mData = nullptr;
+		size_t mSize = 0;
+	};
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <iterator>
+
+namespace Library
+{
+	/// <summary>
+	/// Ranges with fewer elements than this are processed serially, since handing small ranges to the thread pool costs more than it saves
+	/// </summary>
+	inline constexpr std::ptrdiff_t ParallelThreshold = 2048;
+
+	/// <summary>
+	/// Sorts the range [first, last) using the parallel execution policy once the range is large enough to benefit from it
+	/// </summary>
+	/// <param name="first">A random access iterator to the first element of the range</param>
+	/// <param name="last">A random access iterator past the last element of the range</param>
+	/// <param name="compare">A functor that returns true if the lhs should be ordered before the rhs</param>
+	template<typename RandomIt, typename Compare = std::less<>>
+	void ParallelSort(RandomIt first, RandomIt last, Compare compare = Compare())
+	{
+		if (std::distance(first, last) < ParallelThreshold)
+		{
+			std::sort(first, last, compare);
+		}
+		else
+		{
+			std::sort(std::execution::par, first, last, compare);
+		}
+	}
+
+	/// <summary>
+	/// Reorders the range [first, last) so every element that satisfies the predicate comes before every element that does not.
+	/// Uses the parallel execution policy once the range is large enough to benefit from it. The relative order of the elements is not preserved
+	/// </summary>
+	/// <param name="first">A random access iterator to the first element of the range</param>
+	/// <param name="last">A random access iterator past the last element of the range</param>
+	/// <param name="predicate">A functor that returns true for elements that belong in the first group</param>
+	/// <returns>An iterator to the first element of the second group</returns>
+	template<typename RandomIt, typename Predicate>
+	RandomIt ParallelPartition(RandomIt first, RandomIt last, Predicate predicate)
+	{
+		if (std::distance(first, last) < ParallelThreshold)
+		{
+			return std::partition(first, last, predicate);
+		}
+
+		return std::partition(std::execution::par, first, last, predicate);
+	}
+
+	/// <summary>
+	/// Applies the operation to every element of [first, last) and writes the results to the range beginning at destination.
+	/// Uses the parallel execution policy once the range is large enough to benefit from it, so the operation must be safe to call concurrently
+	/// </summary>
+	/// <param name="first">A random access iterator to the first element of the range</param>
+	/// <param name="last">A random access iterator past the last element of the range</param>
+	/// <param name="destination">A random access iterator to the start of the output range. May equal first to transform in place</param>
+	/// <param name="operation">The functor applied to each element</param>
+	/// <returns>An iterator past the last element written</returns>
+	template<typename RandomIt, typename OutputIt, typename Operation>
+	OutputIt ParallelTransform(RandomIt first, RandomIt last, OutputIt destination, Operation operation)
+	{
+		if (std::distance(first, last) < ParallelThreshold)
+		{
+			return std::transform(first, last, destination, operation);
+		}
+
+		return std::transform(std::execution::par, first, last, destination, operation);
+	}
+}
@@ -5,6 +5,59 @@
 
 namespace Library
 {
+	/// <summary>
+	/// The place of an RTTI type in the hierarchy. The type id of a class is the address of its record. Records are built at compile time from the record of the parent,
+	/// so every record holds its depth and the records of all of its ancestors, and checking whether a type derives from another takes one comparison
+	/// </summary>
+	struct TypeRecord final
+	{
+		/// <summary>
+		/// The deepest hierarchy the records can describe. Deriving deeper fails to compile
+		/// </summary>
+		static constexpr std::size_t MaxDepth = 16;
+
+		/// <summary>
+		/// Constructs the record of RTTI itself, the root of every hierarchy
+		/// </summary>
+		/// <param name="name">The name of the type</param>
+		constexpr explicit TypeRecord(const char* name) :
+			Name(name)
+		{
+		}
+
+		/// <summary>
+		/// Constructs the record of a type from the record of its parent
+		/// </summary>
+		/// <param name="parent">The record of the parent type</param>
+		/// <param name="name">The name of the type</param>
+		constexpr TypeRecord(const TypeRecord& parent, const char* name) :
+			Name(name), Depth(parent.Depth + 1)
+		{
+			for (std::size_t i = 0; i < parent.Depth; ++i)
+			{
+				Ancestors[i] = parent.Ancestors[i];
+			}
+			Ancestors[parent.Depth] = &parent;
+		}
+
+		/// <summary>
+		/// Checks whether this type is the passed in type or derives from it
+		/// </summary>
+		/// <param name="other">The record of the other type</param>
+		/// <returns>True if this type is or derives from the other type</returns>
+		constexpr bool Is(const TypeRecord& other) const
+		{
+			return &other == this || (other.Depth < Depth && Ancestors[other.Depth] == &other);
+		}
+
+		const char* Name;
+		std::size_t Depth = 0;
+		/// <summary>
+		/// The records of the ancestors of this type, indexed by their depth
+		/// </summary>
+		const TypeRecord* Ancestors[MaxDepth]{};
+	};
+
 	class RTTI
 	{
 	public:
@@ -15,18 +68,42 @@ namespace Library
 
 		virtual Library::RTTI::IdType TypeIdInstance() const = 0;
 
-		virtual RTTI* QueryInterface(const IdType)
+		RTTI* QueryInterface(const IdType id)
 		{
-			return nullptr;
+			return (Is(id) ? this : nullptr);
 		}
 
-		virtual bool Is(IdType) const
+		/// <summary>
+		/// Checks whether this object is of the type with the passed in id or of a type derived from it. Costs one virtual call to find the type of the object
+		/// </summary>
+		/// <param name="id">The type id being checked for</param>
+		/// <returns>True if this object is of that type</returns>
+		bool Is(IdType id) const
 		{
-			return false;
+			return (id != 0 && Record().Is(*reinterpret_cast<const TypeRecord*>(id)));
 		}
 
-		virtual bool Is(const std::string&) const
+		/// <summary>
+		/// Checks whether this object is of the type with the passed in name or of a type derived from it
+		/// </summary>
+		/// <param name="name">The name of the type being checked for</param>
+		/// <returns>True if this object is of that type</returns>
+		bool Is(const std::string& name) const
 		{
+			const TypeRecord& record = Record();
+			if (name == record.Name)
+			{
+				return true;
+			}
+
+			for (std::size_t i = 1; i < record.Depth; ++i)
+			{
+				if (name == record.Ancestors[i]->Name)
+				{
+					return true;
+				}
+			}
+
 			return false;
 		}
 
@@ -51,27 +128,28 @@ namespace Library
 		{
 			return this == rhs;
 		}
+
+	protected:
+		/// <summary>
+		/// Returns the type record of the type of this object
+		/// </summary>
+		/// <returns>The type record</returns>
+		const TypeRecord& Record() const
+		{
+			return *reinterpret_cast<const TypeRecord*>(TypeIdInstance());
+		}
+
+		inline static constexpr TypeRecord sTypeRecord{ "RTTI" };
 	};
 
 #define RTTI_DECLARATIONS(Type, ParentType)																						\
 		public:																													\
 			static std::string TypeName() { return std::string(#Type); }														\
-			static Library::RTTI::IdType TypeIdClass() { return sRunTimeTypeId; }																\
-			Library::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
-			Library::RTTI* QueryInterface(const RTTI::IdType id) override												\
-            {																													\
-				return (id == sRunTimeTypeId ? reinterpret_cast<Library::RTTI*>(this) : ParentType::QueryInterface(id)); \
-            }																													\
-			bool Is(Library::RTTI::IdType id) const override																			\
-			{																													\
-				return (id == sRunTimeTypeId ? true : ParentType::Is(id));														\
-			}																													\
-			bool Is(const std::string& name) const override																\
-			{																													\
-				return (name == TypeName() ? true : ParentType::Is(name));														\
-			}																													\
-			private:																											\
-				static const Library::RTTI::IdType sRunTimeTypeId;
-
-#define RTTI_DEFINITIONS(Type) const Library::RTTI::IdType Type::sRunTimeTypeId = reinterpret_cast<Library::RTTI::IdType>(&Type::sRunTimeTypeId);
+			static Library::RTTI::IdType TypeIdClass() { return reinterpret_cast<Library::RTTI::IdType>(&sTypeRecord); }		\
+			Library::RTTI::IdType TypeIdInstance() const override;																\
+		protected:																												\
+			inline static constexpr Library::TypeRecord sTypeRecord{ ParentType::sTypeRecord, #Type };					\
+		private:
+
+#define RTTI_DEFINITIONS(Type) Library::RTTI::IdType Type::TypeIdInstance() const { return TypeIdClass(); }
 }
\ No newline at end of file
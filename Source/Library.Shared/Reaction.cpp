@@ -11,7 +11,7 @@ namespace Library
 
 	const Vector<Signature> Reaction::GetSignatures()
 	{
-		return Vector<Signature>();
+		return AttributeReflection::Signatures<Reaction>();
 	}
 
 	void Reaction::Update([[maybe_unused]] WorldState& state)
@@ -9,10 +9,7 @@ namespace Library
 
 	const Vector<Signature> ReactionAttributed::GetSignatures()
 	{
-		return Vector<Signature>
-		{ 
-			{ "Subtype"s, Datum::DatumTypes::String, true, 1, offsetof(ReactionAttributed, mSubtype) }
-		};
+		return AttributeReflection::Signatures<ReactionAttributed>();
 	}
 
 	ReactionAttributed::ReactionAttributed() : 
@@ -44,7 +41,7 @@ namespace Library
 				WorldState& worldState = const_cast<WorldState&>(eventMessage.GetWorld().GetWorldState());
 				Scope argumentsScope;
 
-				const Vector<Scope::PairType*>& messageAttributeVector = eventMessage.GetOrderVector();
+				const Scope::OrderVectorType& messageAttributeVector = eventMessage.GetOrderVector();
 				for (size_t i = 0; i < messageAttributeVector.Size(); ++i)
 				{
 					argumentsScope.Append(messageAttributeVector[i]->first) = messageAttributeVector[i]->second;
@@ -56,6 +53,11 @@ namespace Library
 		}
 	}
 
+	void ReactionAttributed::Retire()
+	{
+		Event<EventMessageAttributed>::Unsubscribe(*this);
+	}
+
 	gsl::owner<Scope*> ReactionAttributed::Clone() const
 	{
 		return new ReactionAttributed(*this);
@@ -15,6 +15,17 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Subtype", ReactionAttributed, mSubtype)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor.
@@ -60,6 +71,11 @@ namespace Library
 		/// <param name="payload">AttributedEvent reference that contains an event message and subtype</param>
 		void Notify(const class EventPublisher& payload) override;
 
+		/// <summary>
+		/// Unsubscribes from AttributedEvents so a ReactionAttributed waiting for deferred destruction no longer runs.
+		/// </summary>
+		void Retire() override;
+
 		/// <summary>
 		/// Creates and returns a clone of this ReactionAttributed.
 		/// </summary>
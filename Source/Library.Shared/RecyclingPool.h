@@ -0,0 +1,88 @@
+#pragma once
+
+#include <mutex>
+#include <gsl/gsl>
+#include "Vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Keeps objects that were done with instead of deleting them, so that the next request for one reuses it instead of constructing a new one.
+	/// Objects are reset with their Reset method when they are released, which must return them to the state of a default constructed one.
+	/// Safe to use from any thread
+	/// </summary>
+	template<typename T>
+	class RecyclingPool final
+	{
+	public:
+
+		/// <summary>
+		/// The number of objects a pool keeps when no other capacity has been set
+		/// </summary>
+		inline static const size_t DefaultCapacity = 64;
+
+		/// <summary>
+		/// Constructor that takes the number of objects the pool keeps. Objects released past it are refused.
+		/// </summary>
+		/// <param name="capacity">The number of objects the pool keeps</param>
+		explicit RecyclingPool(size_t capacity = DefaultCapacity);
+		RecyclingPool(const RecyclingPool&) = delete;
+		RecyclingPool(RecyclingPool&&) = delete;
+		RecyclingPool& operator=(const RecyclingPool&) = delete;
+		RecyclingPool& operator=(RecyclingPool&&) = delete;
+		/// <summary>
+		/// Destructor. Deletes every object kept by the pool
+		/// </summary>
+		~RecyclingPool();
+
+		/// <summary>
+		/// Hands out one of the objects kept by the pool.
+		/// </summary>
+		/// <returns>A reset object the caller now owns, or nullptr if the pool is empty</returns>
+		gsl::owner<T*> Acquire();
+		/// <summary>
+		/// Resets the passed in object and keeps it for a later Acquire, unless the pool is full.
+		/// </summary>
+		/// <param name="object">The heap allocated object the caller is done with</param>
+		/// <returns>True if the pool took ownership of the object. False if it was full, in which case the caller still owns the object</returns>
+		bool Release(gsl::owner<T*> object);
+
+		/// <summary>
+		/// Returns the number of objects kept by the pool
+		/// </summary>
+		/// <returns>The number of objects waiting to be acquired</returns>
+		size_t Size() const;
+		/// <summary>
+		/// Returns the number of objects the pool keeps before it starts refusing released ones
+		/// </summary>
+		/// <returns>The capacity of the pool</returns>
+		size_t Capacity() const;
+		/// <summary>
+		/// Sets the number of objects the pool keeps, deleting the objects it holds past it.
+		/// </summary>
+		/// <param name="capacity">The new capacity of the pool</param>
+		void SetCapacity(size_t capacity);
+
+		/// <summary>
+		/// Deletes every object kept by the pool
+		/// </summary>
+		void Clear();
+
+	private:
+
+		/// <summary>
+		/// Deletes the objects kept past the passed in count. The caller holds the mutex
+		/// </summary>
+		/// <param name="count">The number of objects to keep</param>
+		void Trim(size_t count);
+
+		/// <summary>
+		/// The objects waiting to be acquired. Its storage is reserved up to the capacity so releasing an object never allocates
+		/// </summary>
+		Vector<gsl::owner<T*>> mObjects;
+		size_t mCapacity;
+		mutable std::mutex mMutex;
+	};
+}
+
+#include "RecyclingPool.inl"
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "RecyclingPool.h"
+
+namespace Library
+{
+	template<typename T>
+	inline RecyclingPool<T>::RecyclingPool(size_t capacity) :
+		mObjects(capacity), mCapacity(capacity)
+	{
+	}
+
+	template<typename T>
+	inline RecyclingPool<T>::~RecyclingPool()
+	{
+		Clear();
+	}
+
+	template<typename T>
+	inline gsl::owner<T*> RecyclingPool<T>::Acquire()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mObjects.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		gsl::owner<T*> object = mObjects.Back();
+		mObjects.PopBack();
+		return object;
+	}
+
+	template<typename T>
+	inline bool RecyclingPool<T>::Release(gsl::owner<T*> object)
+	{
+		assert(object != nullptr);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mObjects.Size() >= mCapacity)
+		{
+			return false;
+		}
+
+		// Reset while holding the lock so that the object isn't handed out half reset
+		object->Reset();
+		mObjects.PushBack(object);
+		return true;
+	}
+
+	template<typename T>
+	inline size_t RecyclingPool<T>::Size() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mObjects.Size();
+	}
+
+	template<typename T>
+	inline size_t RecyclingPool<T>::Capacity() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mCapacity;
+	}
+
+	template<typename T>
+	inline void RecyclingPool<T>::SetCapacity(size_t capacity)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mCapacity = capacity;
+		Trim(capacity);
+		mObjects.Reserve(capacity);
+	}
+
+	template<typename T>
+	inline void RecyclingPool<T>::Clear()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		Trim(0);
+	}
+
+	template<typename T>
+	inline void RecyclingPool<T>::Trim(size_t count)
+	{
+		while (mObjects.Size() > count)
+		{
+			delete mObjects.Back();
+			mObjects.PopBack();
+		}
+	}
+}
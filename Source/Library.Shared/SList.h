@@ -2,14 +2,29 @@
 
 #include <functional>
 #include <initializer_list>
+#include <cstddef>
+#include <algorithm>
+#include <new>
+#include <type_traits>
 #include "DefaultEquality.h"
 
 namespace Library
 {
+	/// <summary>
+	/// Node storage policy of an SList that carves its nodes out of blocks owned by the list. Nodes are reused without touching the heap,
+	/// but a node cannot outlive or leave the list that allocated it
+	/// </summary>
+	struct PooledNodes final {};
+	/// <summary>
+	/// Node storage policy of an SList that takes its nodes from a NodePool shared with other lists, such as the bucket chains of a HashMap.
+	/// Nodes are reused without touching the heap and can be transferred between lists drawing from the same pool
+	/// </summary>
+	struct SharedNodes final {};
+
 	/// <summary>
 	/// Represents a generic singly linked list
 	/// </summary>
-	template <typename T>
+	template <typename T, typename TNodeStorage = PooledNodes>
 	class SList
 	{
 	private:
@@ -35,10 +50,112 @@ namespace Library
 			/// <param name="data">The data contained within the node</param>
 			/// <param name="next">Pointer to the next node</param>
 			Node(const T& data, Node* next = nullptr);
+			/// <summary>
+			/// Constructor for a Node that moves the passed in data into the node
+			/// </summary>
+			/// <param name="data">The r-value data to be moved into the node</param>
+			/// <param name="next">Pointer to the next node</param>
+			Node(T&& data, Node* next = nullptr);
+			/// <summary>
+			/// Constructor for a Node that constructs its data in place from the passed in arguments
+			/// </summary>
+			/// <param name="next">Pointer to the next node</param>
+			/// <param name="args">The arguments forwarded to the constructor of T</param>
+			template<typename... Args>
+			Node(Node* next, Args&&... args);
+		};
+
+		/// <summary>
+		/// The storage of a node that is not in use. Links the unused nodes of the list together so they can be handed out again without touching the heap
+		/// </summary>
+		struct FreeNode final
+		{
+			FreeNode* Next;
+		};
+
+		/// <summary>
+		/// Header of a block of node storage. The nodes of the block directly follow the header in memory
+		/// </summary>
+		struct alignas(Node) NodeBlock final
+		{
+			NodeBlock* Next;
 		};
 #pragma endregion Node
 
 	public:
+#pragma region NodePool
+		/// <summary>
+		/// Storage for the nodes of lists. Nodes are carved out of blocks that double in size as the pool grows, up to MaxBlockSize nodes,
+		/// and destroyed nodes are handed out again. A PooledNodes list owns its pool, SharedNodes lists use one that must outlive them
+		/// </summary>
+		class NodePool final
+		{
+			friend SList;
+
+		public:
+			/// <summary>
+			/// Default constructor that initializes the pool to empty
+			/// </summary>
+			NodePool() = default;
+			NodePool(const NodePool&) = delete;
+			/// <summary>
+			/// Move constructor, the moved from pool no longer owns any storage
+			/// </summary>
+			/// <param name="rhs">The pool being moved</param>
+			NodePool(NodePool&& rhs) noexcept;
+			NodePool& operator=(const NodePool&) = delete;
+			/// <summary>
+			/// Move assignment operator, frees the storage of this pool before taking over that of rhs
+			/// </summary>
+			/// <param name="rhs">The pool being moved</param>
+			/// <returns>A reference to this pool after its been mutated</returns>
+			NodePool& operator=(NodePool&& rhs) noexcept;
+			/// <summary>
+			/// Destructor that frees every block. Every node taken from the pool must already be destroyed
+			/// </summary>
+			~NodePool();
+
+			/// <summary>
+			/// Returns the number of nodes the pool holds, in use or not
+			/// </summary>
+			/// <returns>The total number of nodes in every block of the pool</returns>
+			size_t Capacity() const;
+			/// <summary>
+			/// Frees every block of the pool. Every node taken from the pool must already be destroyed
+			/// </summary>
+			void Release();
+
+		private:
+			/// <summary>
+			/// Takes the storage of a node off the free list, allocating a new block of nodes if the free list is empty
+			/// </summary>
+			/// <returns>Storage for a single node</returns>
+			void* Allocate();
+			/// <summary>
+			/// Returns the storage of a destroyed node to the free list
+			/// </summary>
+			/// <param name="storage">The storage of the node</param>
+			void Deallocate(void* storage);
+			/// <summary>
+			/// Allocates a new block of nodes and adds them to the free list
+			/// </summary>
+			void AllocateBlock();
+
+			/// <summary>
+			/// The unused nodes of the pool
+			/// </summary>
+			FreeNode* mFreeNodes = nullptr;
+			/// <summary>
+			/// The blocks of node storage owned by the pool
+			/// </summary>
+			NodeBlock* mBlocks = nullptr;
+			/// <summary>
+			/// The total number of nodes in every block owned by the pool
+			/// </summary>
+			size_t mCapacity = 0;
+		};
+#pragma endregion
+
 #pragma region Iterator
 		class Iterator final
 		{
@@ -301,6 +418,30 @@ namespace Library
 		/// <param name="data">The data being pushed into the list</param>
 		Iterator PushBack(const T& data);
 		/// <summary>
+		/// Moves r-value data of type T into the front of the list
+		/// </summary>
+		/// <param name="data">The data being moved into the list</param>
+		Iterator PushFront(T&& data);
+		/// <summary>
+		/// Moves r-value data of type T into the back of the list
+		/// </summary>
+		/// <param name="data">The data being moved into the list</param>
+		Iterator PushBack(T&& data);
+		/// <summary>
+		/// Constructs data of type T in place at the front of the list
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the newly constructed data</returns>
+		template<typename... Args>
+		Iterator EmplaceFront(Args&&... args);
+		/// <summary>
+		/// Constructs data of type T in place at the back of the list
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the newly constructed data</returns>
+		template<typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+		/// <summary>
 		/// Pops the front node off the list and deletes it. Sets mFront to the next Node in the list
 		/// </summary>
 		void PopFront();
@@ -309,9 +450,26 @@ namespace Library
 		/// </summary>
 		void PopBack();
 		/// <summary>
-		/// Removes all items in the list
+		/// Removes all items in the list. The node storage is kept by the list and reused by later insertions
 		/// </summary>
 		void Clear();
+		/// <summary>
+		/// Returns the node storage of an empty list to the heap. Does nothing if the list is not empty, or if its nodes come from a shared pool
+		/// </summary>
+		void ShrinkToFit();
+		/// <summary>
+		/// Points a list with SharedNodes storage at the pool it takes its nodes from
+		/// </summary>
+		/// <param name="nodePool">The pool of nodes, which must outlive the list</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the list is not empty and uses another pool</exception>
+		void SetNodePool(NodePool& nodePool);
+		/// <summary>
+		/// Unlinks the front node of this list and links it onto the back of destination. The data is neither copied nor moved, so pointers to it stay valid.
+		/// Only available to lists with SharedNodes storage
+		/// </summary>
+		/// <param name="destination">The list that receives the node. Does nothing if this list is empty</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the lists don't share a node pool</exception>
+		void TransferFront(SList& destination);
 
 		/// <summary>
 		/// Creates and returns an iterator that points to the first node in the SList
@@ -380,6 +538,31 @@ namespace Library
 		bool Remove(const Iterator& data);
 
 	private:
+		/// <summary>
+		/// Constructs a node in storage taken from the node pool of the list
+		/// </summary>
+		/// <param name="next">Pointer to the next node</param>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>A pointer to the new node</returns>
+		template<typename... Args>
+		Node* CreateNode(Node* next, Args&&... args);
+		/// <summary>
+		/// Destructs a node and returns its storage to the node pool of the list
+		/// </summary>
+		/// <param name="node">The node to destroy</param>
+		void DestroyNode(Node* node);
+		/// <summary>
+		/// Returns the pool the nodes of the list come from
+		/// </summary>
+		/// <returns>The owned pool of a PooledNodes list, the shared pool of a SharedNodes list</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if a SharedNodes list has no pool</exception>
+		NodePool& Nodes();
+
+		/// <summary>
+		/// The largest number of nodes allocated in a single block
+		/// </summary>
+		static constexpr size_t MaxBlockSize = 64;
+
 		/// <summary>
 		/// Number of nodes that contain data within the list
 		/// </summary>
@@ -392,6 +575,10 @@ namespace Library
 		/// Pointer to the back node within the list
 		/// </summary>
 		Node* mBack = nullptr;
+		/// <summary>
+		/// The pool the nodes of the list come from. Owned by a PooledNodes list, shared by a SharedNodes list
+		/// </summary>
+		std::conditional_t<std::is_same_v<TNodeStorage, SharedNodes>, NodePool*, NodePool> mNodes{};
 	};
 }
 
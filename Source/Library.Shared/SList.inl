@@ -5,20 +5,33 @@ namespace Library
 {
 #pragma region Node
 
-	template<typename T>
-	SList<T>::Node::Node(const T& data, Node* next) :
+	template<typename T, typename TNodeStorage>
+	SList<T, TNodeStorage>::Node::Node(const T& data, Node* next) :
 		Data(data), Next(next)
 	{
 	}
 
+	template<typename T, typename TNodeStorage>
+	SList<T, TNodeStorage>::Node::Node(T&& data, Node* next) :
+		Data(std::move(data)), Next(next)
+	{
+	}
+
+	template<typename T, typename TNodeStorage>
+	template<typename... Args>
+	SList<T, TNodeStorage>::Node::Node(Node* next, Args&&... args) :
+		Data(std::forward<Args>(args)...), Next(next)
+	{
+	}
+
 #pragma endregion
 
 #pragma region Iterator
-	template<typename T>
-	inline SList<T>::Iterator::Iterator(Node* node, const SList* owner) : mNode(node), mOwner(owner) {}
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::Iterator::Iterator(Node* node, const SList* owner) : mNode(node), mOwner(owner) {}
 
-	template<typename T>
-	inline T& SList<T>::Iterator::operator*() const
+	template<typename T, typename TNodeStorage>
+	inline T& SList<T, TNodeStorage>::Iterator::operator*() const
 	{
 		if (mNode == nullptr)
 		{
@@ -28,20 +41,20 @@ namespace Library
 		return mNode->Data;
 	}
 
-	template<typename T>
-	inline bool SList<T>::Iterator::operator==(const Iterator& it) const
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::Iterator::operator==(const Iterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename T>
-	inline bool SList<T>::Iterator::operator!=(const Iterator& it) const
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::Iterator::operator!=(const Iterator& it) const
 	{
 		return (mOwner != it.mOwner || mNode != it.mNode);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator& SList<T, TNodeStorage>::Iterator::operator++()
 	{
 		if (mNode == nullptr)
 		{
@@ -52,8 +65,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::Iterator::operator++(int)
 	{
 		Iterator it = *this;
 		operator++();
@@ -62,14 +75,14 @@ namespace Library
 #pragma endregion
 
 #pragma region ConstIterator
-	template<typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const Node* node, const SList* owner) : mNode(node), mOwner(owner) {}
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::ConstIterator::ConstIterator(const Node* node, const SList* owner) : mNode(node), mOwner(owner) {}
 
-	template<typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const Iterator& it) : mNode(it.mNode), mOwner(it.mOwner) {}
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::ConstIterator::ConstIterator(const Iterator& it) : mNode(it.mNode), mOwner(it.mOwner) {}
 
-	template<typename T>
-	inline const T& SList<T>::ConstIterator::operator*() const
+	template<typename T, typename TNodeStorage>
+	inline const T& SList<T, TNodeStorage>::ConstIterator::operator*() const
 	{
 		if (mNode == nullptr)
 		{
@@ -79,14 +92,14 @@ namespace Library
 		return mNode->Data;
 	}
 
-	template<typename T>
-	inline bool SList<T>::ConstIterator::operator==(const ConstIterator& it) const
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::ConstIterator::operator==(const ConstIterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename T>
-	inline bool SList<T>::ConstIterator::operator!=(const ConstIterator& it) const
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::ConstIterator::operator!=(const ConstIterator& it) const
 	{
 		if (mOwner != it.mOwner || mNode != it.mNode)
 		{
@@ -96,8 +109,8 @@ namespace Library
 		return false;
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++()
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator& SList<T, TNodeStorage>::ConstIterator::operator++()
 	{
 		if (mNode == nullptr)
 		{
@@ -108,8 +121,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::ConstIterator::operator++(int)
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::ConstIterator::operator++(int)
 	{
 		ConstIterator it = *this;
 		operator++();
@@ -119,24 +132,30 @@ namespace Library
 
 #pragma region SList
 
-	template<typename T>
-	SList<T>::SList(SList&& rhs) noexcept :
-		mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack)
+	template<typename T, typename TNodeStorage>
+	SList<T, TNodeStorage>::SList(SList&& rhs) noexcept :
+		mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack), mNodes(std::move(rhs.mNodes))
 	{
 		rhs.mSize = 0;
 		rhs.mFront = nullptr;
 		rhs.mBack = nullptr;
 	}
 
-	template<typename T>
-	inline SList<T>::~SList()
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::~SList()
 	{
 		Clear();
 	}
 
-	template<typename T>
-	SList<T>::SList(const SList& rhs)
+	template<typename T, typename TNodeStorage>
+	SList<T, TNodeStorage>::SList(const SList& rhs)
 	{
+		// A copy draws from the same pool as the list it copies, a PooledNodes list gets a pool of its own
+		if constexpr (std::is_same_v<TNodeStorage, SharedNodes>)
+		{
+			mNodes = rhs.mNodes;
+		}
+
 		Node* listNode = rhs.mFront;
 		while (listNode != nullptr)
 		{
@@ -145,8 +164,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	SList<T>& SList<T>::operator=(const SList& rhs)
+	template<typename T, typename TNodeStorage>
+	SList<T, TNodeStorage>& SList<T, TNodeStorage>::operator=(const SList& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -163,8 +182,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(SList&& rhs) noexcept
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>& SList<T, TNodeStorage>::operator=(SList&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
@@ -173,6 +192,7 @@ namespace Library
 			mSize = rhs.mSize;
 			mFront = rhs.mFront;
 			mBack = rhs.mBack;
+			mNodes = std::move(rhs.mNodes);
 
 			rhs.mSize = 0;
 			rhs.mFront = nullptr;
@@ -182,20 +202,20 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline bool SList<T>::IsEmpty() const
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::IsEmpty() const
 	{
 		return mSize == 0;
 	}
 
-	template<typename T>
-	inline size_t SList<T>::Size() const
+	template<typename T, typename TNodeStorage>
+	inline size_t SList<T, TNodeStorage>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Front()
+	template<typename T, typename TNodeStorage>
+	inline T& SList<T, TNodeStorage>::Front()
 	{
 		if (IsEmpty())
 		{
@@ -205,8 +225,8 @@ namespace Library
 		return mFront->Data;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Front() const
+	template<typename T, typename TNodeStorage>
+	inline const T& SList<T, TNodeStorage>::Front() const
 	{
 		if (IsEmpty())
 		{
@@ -216,8 +236,8 @@ namespace Library
 		return mFront->Data;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Back()
+	template<typename T, typename TNodeStorage>
+	inline T& SList<T, TNodeStorage>::Back()
 	{
 		if (IsEmpty())
 		{
@@ -227,8 +247,8 @@ namespace Library
 		return mBack->Data;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Back() const
+	template<typename T, typename TNodeStorage>
+	inline const T& SList<T, TNodeStorage>::Back() const
 	{
 		if (IsEmpty())
 		{
@@ -238,10 +258,35 @@ namespace Library
 		return mBack->Data;
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::PushFront(const T& data)
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::PushFront(const T& data)
+	{
+		return EmplaceFront(data);
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::PushBack(const T& data)
+	{
+		return EmplaceBack(data);
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::PushFront(T&& data)
 	{
-		mFront = new Node(data, mFront);
+		return EmplaceFront(std::move(data));
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::PushBack(T&& data)
+	{
+		return EmplaceBack(std::move(data));
+	}
+
+	template<typename T, typename TNodeStorage>
+	template<typename... Args>
+	typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::EmplaceFront(Args&&... args)
+	{
+		mFront = CreateNode(mFront, std::forward<Args>(args)...);
 		if (IsEmpty())
 		{
 			mBack = mFront;
@@ -252,10 +297,11 @@ namespace Library
 		return Iterator(mFront, this);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::PushBack(const T& data)
+	template<typename T, typename TNodeStorage>
+	template<typename... Args>
+	typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::EmplaceBack(Args&&... args)
 	{
-		Node* newBack = new Node(data, nullptr);
+		Node* newBack = CreateNode(nullptr, std::forward<Args>(args)...);
 
 		if (IsEmpty())
 		{
@@ -272,13 +318,13 @@ namespace Library
 		return Iterator(mBack, this);
 	}
 
-	template<typename T>
-	void SList<T>::PopFront()
+	template<typename T, typename TNodeStorage>
+	void SList<T, TNodeStorage>::PopFront()
 	{
 		if (!IsEmpty())
 		{
 			Node* node = mFront->Next;
-			delete mFront;
+			DestroyNode(mFront);
 			mFront = node;
 			mSize--;
 
@@ -289,14 +335,14 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	void SList<T>::PopBack()
+	template<typename T, typename TNodeStorage>
+	void SList<T, TNodeStorage>::PopBack()
 	{
 		if (!IsEmpty())
 		{
 			if (mSize == 1)
 			{
-				delete mFront;
+				DestroyNode(mFront);
 				mFront = mBack = nullptr;
 			}
 			else
@@ -307,7 +353,7 @@ namespace Library
 					newBack = curNode;
 				}
 				mBack = newBack;
-				delete newBack->Next;
+				DestroyNode(newBack->Next);
 				mBack->Next = nullptr;
 			}
 
@@ -315,8 +361,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	void SList<T>::Clear()
+	template<typename T, typename TNodeStorage>
+	void SList<T, TNodeStorage>::Clear()
 	{
 		if (!IsEmpty())
 		{
@@ -326,51 +372,51 @@ namespace Library
 			{
 				prevNode = curNode;
 				curNode = curNode->Next;
-				delete prevNode;
+				DestroyNode(prevNode);
 			}
 			mFront = mBack = nullptr;
 			mSize = 0;
 		}
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::begin()
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::begin()
 	{
 		return Iterator(mFront, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::begin() const 
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::begin() const 
 	{
 		return cbegin();
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cbegin() const
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::cbegin() const
 	{
 		return ConstIterator(mFront, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::end() 
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::end() 
 	{
 		return Iterator(nullptr, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::end() const 
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::end() const 
 	{
 		return cend();
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cend() const
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::cend() const
 	{
 		return ConstIterator(nullptr, this);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::InsertAfter(const T& data, const Iterator& it)
+	template<typename T, typename TNodeStorage>
+	typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::InsertAfter(const T& data, const Iterator& it)
 	{
 		if (it.mOwner != this)
 		{
@@ -383,15 +429,15 @@ namespace Library
 			return Iterator(mBack, this);
 		}
 
-		Node* newNode = new Node(data, it.mNode->Next);
+		Node* newNode = CreateNode(it.mNode->Next, data);
 		it.mNode->Next = newNode;
 		mSize++;
 
 		return Iterator(newNode, this);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare)
+	template<typename T, typename TNodeStorage>
+	typename SList<T, TNodeStorage>::Iterator SList<T, TNodeStorage>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare)
 	{
 
 		for (Iterator it = begin(); it != end(); ++it)
@@ -405,8 +451,8 @@ namespace Library
 		return end();
 	}
 
-	template<typename T>
-	typename SList<T>::ConstIterator SList<T>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare) const
+	template<typename T, typename TNodeStorage>
+	typename SList<T, TNodeStorage>::ConstIterator SList<T, TNodeStorage>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare) const
 	{
 		for (ConstIterator it = begin(); it != end(); ++it)
 		{
@@ -419,14 +465,14 @@ namespace Library
 		return cend();
 	}
 
-	template<typename T>
-	inline bool SList<T>::Remove(const T& value)
+	template<typename T, typename TNodeStorage>
+	inline bool SList<T, TNodeStorage>::Remove(const T& value)
 	{
 		return Remove(Find(value));
 	}
 
-	template<typename T>
-	bool SList<T>::Remove(const SList<T>::Iterator& data)
+	template<typename T, typename TNodeStorage>
+	bool SList<T, TNodeStorage>::Remove(const SList<T, TNodeStorage>::Iterator& data)
 	{
 		if (data.mOwner != this)
 		{
@@ -454,7 +500,7 @@ namespace Library
 			data.mNode->Data.~T();
 			new(&data.mNode->Data)T(std::move(next->Data));
 			data.mNode->Next = next->Next;
-			delete next;
+			DestroyNode(next);
 
 			if (data.mNode->Next == nullptr)
 			{
@@ -467,5 +513,202 @@ namespace Library
 		return true;
 	}
 
+	template<typename T, typename TNodeStorage>
+	inline void SList<T, TNodeStorage>::ShrinkToFit()
+	{
+		if constexpr (std::is_same_v<TNodeStorage, PooledNodes>)
+		{
+			if (IsEmpty())
+			{
+				mNodes.Release();
+			}
+		}
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline void SList<T, TNodeStorage>::SetNodePool(NodePool& nodePool)
+	{
+		static_assert(std::is_same_v<TNodeStorage, SharedNodes>, "Only SharedNodes lists take their nodes from another pool");
+
+		if (!IsEmpty() && mNodes != &nodePool)
+		{
+			throw std::runtime_error("A list holding nodes cannot change its node pool");
+		}
+
+		mNodes = &nodePool;
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline void SList<T, TNodeStorage>::TransferFront(SList& destination)
+	{
+		static_assert(std::is_same_v<TNodeStorage, SharedNodes>, "Only SharedNodes lists can hand their nodes to another list");
+
+		if (IsEmpty() || &destination == this)
+		{
+			return;
+		}
+
+		if (destination.mNodes != mNodes)
+		{
+			throw std::runtime_error("Nodes can only be transferred between lists sharing a node pool");
+		}
+
+		Node* node = mFront;
+		mFront = mFront->Next;
+		if (--mSize <= 1)
+		{
+			mBack = mFront;
+		}
+
+		node->Next = nullptr;
+		if (destination.IsEmpty())
+		{
+			destination.mFront = destination.mBack = node;
+		}
+		else
+		{
+			destination.mBack->Next = node;
+			destination.mBack = node;
+		}
+		++destination.mSize;
+	}
+
+	template<typename T, typename TNodeStorage>
+	template<typename... Args>
+	inline typename SList<T, TNodeStorage>::Node* SList<T, TNodeStorage>::CreateNode(Node* next, Args&&... args)
+	{
+		NodePool& nodes = Nodes();
+		void* storage = nodes.Allocate();
+
+		try
+		{
+			return new(storage) Node(next, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			nodes.Deallocate(storage);
+			throw;
+		}
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline void SList<T, TNodeStorage>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		Nodes().Deallocate(node);
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::NodePool& SList<T, TNodeStorage>::Nodes()
+	{
+		if constexpr (std::is_same_v<TNodeStorage, SharedNodes>)
+		{
+			if (mNodes == nullptr)
+			{
+				throw std::runtime_error("This list has no node pool");
+			}
+
+			return *mNodes;
+		}
+		else
+		{
+			return mNodes;
+		}
+	}
+
+#pragma endregion
+
+#pragma region NodePool
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::NodePool::NodePool(NodePool&& rhs) noexcept :
+		mFreeNodes(rhs.mFreeNodes), mBlocks(rhs.mBlocks), mCapacity(rhs.mCapacity)
+	{
+		rhs.mFreeNodes = nullptr;
+		rhs.mBlocks = nullptr;
+		rhs.mCapacity = 0;
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline typename SList<T, TNodeStorage>::NodePool& SList<T, TNodeStorage>::NodePool::operator=(NodePool&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Release();
+
+			mFreeNodes = rhs.mFreeNodes;
+			mBlocks = rhs.mBlocks;
+			mCapacity = rhs.mCapacity;
+
+			rhs.mFreeNodes = nullptr;
+			rhs.mBlocks = nullptr;
+			rhs.mCapacity = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline SList<T, TNodeStorage>::NodePool::~NodePool()
+	{
+		Release();
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline size_t SList<T, TNodeStorage>::NodePool::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline void* SList<T, TNodeStorage>::NodePool::Allocate()
+	{
+		if (mFreeNodes == nullptr)
+		{
+			AllocateBlock();
+		}
+
+		FreeNode* storage = mFreeNodes;
+		mFreeNodes = storage->Next;
+		return storage;
+	}
+
+	template<typename T, typename TNodeStorage>
+	inline void SList<T, TNodeStorage>::NodePool::Deallocate(void* storage)
+	{
+		mFreeNodes = new(storage) FreeNode{ mFreeNodes };
+	}
+
+	template<typename T, typename TNodeStorage>
+	void SList<T, TNodeStorage>::NodePool::AllocateBlock()
+	{
+		static_assert(alignof(Node) <= alignof(std::max_align_t), "SList does not support over-aligned types");
+
+		size_t blockSize = std::min(std::max(mCapacity, size_t(1)), MaxBlockSize);
+		NodeBlock* block = reinterpret_cast<NodeBlock*>(::operator new(sizeof(NodeBlock) + sizeof(Node) * blockSize));
+		block->Next = mBlocks;
+		mBlocks = block;
+		mCapacity += blockSize;
+
+		Node* nodes = reinterpret_cast<Node*>(block + 1);
+		for (size_t i = blockSize; i > 0; --i)
+		{
+			mFreeNodes = new(nodes + i - 1) FreeNode{ mFreeNodes };
+		}
+	}
+
+	template<typename T, typename TNodeStorage>
+	void SList<T, TNodeStorage>::NodePool::Release()
+	{
+		while (mBlocks != nullptr)
+		{
+			NodeBlock* next = mBlocks->Next;
+			::operator delete(mBlocks);
+			mBlocks = next;
+		}
+
+		mFreeNodes = nullptr;
+		mCapacity = 0;
+	}
+
 #pragma endregion
 }
\ No newline at end of file
@@ -7,24 +7,24 @@ namespace Library
 
 #pragma region MemberMethods
 
-	Scope::Scope(size_t bucketSize) : 
-		mOrderVector(bucketSize)
+	Scope::Scope(size_t bucketSize) :
+		mBucketSize(bucketSize)
 	{
 		assert(bucketSize != 0);
-		mMap.Resize(bucketSize);
 	}
 
 	Scope::Scope(Scope* parent) : mParent(parent) {}
 
 	Scope::Scope(const Scope& rhs) :
-		mOrderVector(rhs.NumAttributes()), mMap(rhs.BucketSize())
+		mOrderVector(rhs.NumAttributes()), mBucketSize(rhs.BucketSize())
 	{
 		CopyHelper(rhs);
 	}
 
 	Scope::Scope(Scope&& rhs) noexcept : 
-		mOrderVector(std::move(rhs.mOrderVector)), mMap(std::move(rhs.mMap)), mParent(rhs.mParent)
+		mParent(rhs.mParent), mBucketSize(rhs.mBucketSize)
 	{
+		MoveAttributes(rhs);
 		MoveHelper(&rhs);
 	}
 
@@ -34,7 +34,7 @@ namespace Library
 		{
 			Clear();
 			mOrderVector.Reserve(rhs.NumAttributes());
-			mMap.Resize(rhs.BucketSize());
+			mBucketSize = rhs.BucketSize();
 			CopyHelper(rhs);
 		}
 
@@ -47,8 +47,8 @@ namespace Library
 		{
 			Orphan();
 			Clear();
-			mOrderVector = std::move(rhs.mOrderVector);
-			mMap = std::move(rhs.mMap);
+			mBucketSize = rhs.mBucketSize;
+			MoveAttributes(rhs);
 			mParent = rhs.mParent;
 			MoveHelper(&rhs);
 		}
@@ -72,15 +72,16 @@ namespace Library
 					newScope->mParent = this;
 					newDatum.PushBack(*newScope);
 				}
+				UpdateChildSlots(newDatum);
 			}
 			else
 			{
-				mOrderVector.PushBack(&(*mMap.Insert(*pair).first));
+				EmplaceAttribute(pair->first, pair->second);
 			}
 		}
 	}
 
-	void Scope::MoveHelper(const Scope* rhs) noexcept
+	void Scope::MoveHelper(Scope* rhs) noexcept
 	{
 		for (PairType* pair : mOrderVector)
 		{
@@ -90,6 +91,7 @@ namespace Library
 				{
 					pair->second.GetScope(i)->mParent = this;
 				}
+				UpdateChildSlots(pair->second);
 			}
 		}
 
@@ -99,8 +101,13 @@ namespace Library
 			if (retDatum != nullptr)
 			{
 				retDatum->Set(*this, index);
+				mParentDatum = retDatum;
+				mParentIndex = index;
 			}
 		}
+
+		rhs->mParentDatum = nullptr;
+		rhs->mParentIndex = 0;
 	}
 
 	Scope::~Scope()
@@ -116,6 +123,7 @@ namespace Library
 	{
 		if (this != &rhs)
 		{
+			// The cached hashes are not consulted, they miss writes made through the non-const getters
 			if (mOrderVector.Size() != rhs.mOrderVector.Size())
 			{
 				return false;
@@ -149,6 +157,182 @@ namespace Library
 		return !operator==(rhs);
 	}
 
+	size_t Scope::Hash() const
+	{
+		if (!mIsHashValid)
+		{
+			// Summing the attribute hashes makes the order of the attributes irrelevant, the same as for operator==
+			size_t attributes = 0;
+			mHasPointers = false;
+			for (const PairType* pair : mOrderVector)
+			{
+				if (pair->first != "this")
+				{
+					const Datum& datum = pair->second;
+					attributes += CombineHash(OrderedHash(reinterpret_cast<const uint8_t*>(pair->first.data()), pair->first.size()), datum.Hash());
+					if (datum.Type() == Datum::DatumTypes::Pointer)
+					{
+						mHasPointers |= !datum.IsEmpty();
+					}
+					else if (datum.Type() == Datum::DatumTypes::Table)
+					{
+						for (size_t i = 0; i < datum.Size(); ++i)
+						{
+							mHasPointers |= datum.GetScope(i)->mHasPointers;
+						}
+					}
+				}
+			}
+
+			mHash = CombineHash(mOrderVector.Size(), attributes);
+			mIsHashValid = true;
+		}
+
+		return mHash;
+	}
+
+	void Scope::MarkModified()
+	{
+		const size_t frame = ChangeFrame();
+		mChangeFrame = frame;
+
+		// An ancestor with no cached hash that is already marked for this frame has marked every Scope above it too
+		for (Scope* scope = this; scope != nullptr && (scope->mIsHashValid || scope->mSubtreeChangeFrame != frame); scope = scope->mParent)
+		{
+			scope->mIsHashValid = false;
+			scope->mSubtreeChangeFrame = frame;
+		}
+	}
+
+	void Scope::MarkModified(std::string_view name)
+	{
+		PairType* pair = FindPair(name);
+		if (pair == nullptr)
+		{
+			throw std::runtime_error("This Scope has no attribute with that name");
+		}
+
+		pair->second.MarkModified();
+	}
+
+	size_t Scope::ChangeFrame()
+	{
+		return sChangeFrame.load(std::memory_order_relaxed);
+	}
+
+	size_t Scope::AdvanceChangeFrame()
+	{
+		return sChangeFrame.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	void Scope::ForEachChangedScope(size_t since, const std::function<void(Scope&)>& visitor)
+	{
+		if (mSubtreeChangeFrame < since)
+		{
+			return;
+		}
+
+		if (mChangeFrame >= since)
+		{
+			visitor(*this);
+		}
+
+		for (PairType* pair : mOrderVector)
+		{
+			Datum& datum = pair->second;
+			if (datum.Type() == Datum::DatumTypes::Table && !datum.IsExternalStorage())
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					Scope* child = std::as_const(datum).GetScope(i);
+					if (child->mParent == this)
+					{
+						child->ForEachChangedScope(since, visitor);
+					}
+				}
+			}
+		}
+	}
+
+	void Scope::ForEachChangedAttribute(size_t since, const std::function<void(Scope&, PairType&)>& visitor)
+	{
+		ForEachChangedScope(since, [since, &visitor](Scope& scope)
+		{
+			for (PairType* pair : scope.mOrderVector)
+			{
+				if (pair->second.ChangeFrame() >= since)
+				{
+					visitor(scope, *pair);
+				}
+			}
+		});
+	}
+
+	Vector<std::string> Scope::Diff(const Scope& lhs, const Scope& rhs)
+	{
+		Vector<std::string> differences;
+		if (MayDiffer(lhs, rhs))
+		{
+			DiffHelper(lhs, rhs, std::string(), differences);
+		}
+
+		return differences;
+	}
+
+	bool Scope::MayDiffer(const Scope& lhs, const Scope& rhs)
+	{
+		// Both hashes are computed before their Pointer flags are read
+		return lhs.Hash() != rhs.Hash() || lhs.mHasPointers || rhs.mHasPointers;
+	}
+
+	void Scope::DiffHelper(const Scope& lhs, const Scope& rhs, const std::string& prefix, Vector<std::string>& differences)
+	{
+		for (const PairType* pair : lhs.mOrderVector)
+		{
+			if (pair->first == "this")
+			{
+				continue;
+			}
+
+			const Datum& lhsDatum = pair->second;
+			const Datum* rhsDatum = rhs.Find(pair->first);
+			if (rhsDatum == nullptr)
+			{
+				differences.PushBack(prefix + pair->first);
+			}
+			else if (lhsDatum.Type() == Datum::DatumTypes::Table && rhsDatum->Type() == Datum::DatumTypes::Table)
+			{
+				size_t shared = std::min(lhsDatum.Size(), rhsDatum->Size());
+				for (size_t i = 0; i < shared; ++i)
+				{
+					const Scope& lhsChild = *lhsDatum.GetScope(i);
+					const Scope& rhsChild = *rhsDatum->GetScope(i);
+					if (MayDiffer(lhsChild, rhsChild))
+					{
+						DiffHelper(lhsChild, rhsChild, prefix + pair->first + "[" + std::to_string(i) + "].", differences);
+					}
+				}
+
+				for (size_t i = shared; i < std::max(lhsDatum.Size(), rhsDatum->Size()); ++i)
+				{
+					differences.PushBack(prefix + pair->first + "[" + std::to_string(i) + "]");
+				}
+			}
+			else if (lhsDatum != *rhsDatum)
+			{
+				differences.PushBack(prefix + pair->first);
+			}
+		}
+
+		for (const PairType* pair : rhs.mOrderVector)
+		{
+			if (pair->first != "this" && lhs.Find(pair->first) == nullptr)
+			{
+				differences.PushBack(prefix + pair->first);
+			}
+		}
+	}
+
 #pragma endregion
 
 #pragma region ScopeInformation
@@ -160,7 +344,40 @@ namespace Library
 
 	size_t Scope::BucketSize() const
 	{
-		return mMap.BucketSize();
+		return (mMap != nullptr ? mMap->BucketSize() : mBucketSize);
+	}
+
+	bool Scope::IsHashed() const
+	{
+		return mMap != nullptr;
+	}
+
+	size_t Scope::Footprint() const
+	{
+		size_t bytes = sizeof(Scope) + (mOrderVector.Capacity() > OrderVectorType::InlineCapacity ? mOrderVector.Capacity() * sizeof(PairType*) : 0);
+		if (mMap != nullptr)
+		{
+			bytes += sizeof(HashMap<std::string, Datum>) + mMap->BucketSize() * sizeof(HashMap<std::string, Datum>::ChainType) + (mMap->Size() * sizeof(PairType));
+		}
+
+		for (const PairType* pair : mOrderVector)
+		{
+			const Datum& datum = pair->second;
+			bytes += pair->first.capacity() + 1;
+			if (!datum.IsExternalStorage())
+			{
+				bytes += datum.Capacity() * Datum::DataTypeSizes[static_cast<size_t>(datum.Type())];
+				if (datum.Type() == Datum::DatumTypes::String)
+				{
+					for (size_t i = 0; i < datum.Size(); ++i)
+					{
+						bytes += datum.GetString(i).capacity() + 1;
+					}
+				}
+			}
+		}
+
+		return bytes;
 	}
 
 	size_t Scope::NumAttributes() const
@@ -194,28 +411,23 @@ namespace Library
 
 #pragma region AtributeAccess
 
-	const Vector<Scope::PairType*>& Scope::GetOrderVector() const
+	const Scope::OrderVectorType& Scope::GetOrderVector() const
 	{
 		return mOrderVector;
 	}
 
-	Datum* Scope::Find(const std::string& name)
+	Datum* Scope::Find(std::string_view name)
 	{
-		auto it = mMap.Find(name);
-		if (it == mMap.end())
-		{
-			return nullptr;
-		}
-
-		return &it->second;
+		PairType* pair = FindPair(name);
+		return (pair != nullptr ? &pair->second : nullptr);
 	}
 
-	const Datum* Scope::Find(const std::string& name) const
+	const Datum* Scope::Find(std::string_view name) const
 	{
 		return const_cast<Scope*>(this)->Find(name);
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope** foundScope)
+	Datum* Scope::Search(std::string_view name, Scope** foundScope)
 	{
 		Datum* ret = Find(name);
 
@@ -232,7 +444,7 @@ namespace Library
 		return ret;
 	}
 
-	const Datum* Scope::Search(const std::string& name, Scope** foundScope) const
+	const Datum* Scope::Search(std::string_view name, Scope** foundScope) const
 	{
 		return const_cast<Scope*>(this)->Search(name, foundScope);
 	}
@@ -256,13 +468,23 @@ namespace Library
 
 	std::pair<Datum*, size_t> Scope::FindNestedScope(const Scope* scope)
 	{
+		if (scope != nullptr && scope->mParent == this && scope->mParentDatum != nullptr)
+		{
+			const Datum& datum = *scope->mParentDatum;
+			if (datum.Type() == Datum::DatumTypes::Table && scope->mParentIndex < datum.Size() && datum.GetScope(scope->mParentIndex) == scope)
+			{
+				return std::pair(scope->mParentDatum, scope->mParentIndex);
+			}
+		}
+
 		for (PairType* pair : mOrderVector)
 		{
-			if (pair->second.Type() == Datum::DatumTypes::Table)
+			const Datum& datum = pair->second;
+			if (datum.Type() == Datum::DatumTypes::Table)
 			{
-				for (size_t i = 0; i < pair->second.Size(); ++i)
+				for (size_t i = 0; i < datum.Size(); ++i)
 				{
-					if (pair->second.GetScope(i) == scope)
+					if (datum.GetScope(i) == scope)
 					{
 						return std::pair(&pair->second, i);
 					}
@@ -284,13 +506,62 @@ namespace Library
 			throw std::runtime_error("Can't append with an empty string");
 		}
 
-		auto [ret, inserted] = mMap.Insert(PairType(name, Datum()));
-		if (inserted)
+		return EmplaceAttribute(name).first->second;
+	}
+
+	Datum& Scope::Append(std::string&& name)
+	{
+		if (name.size() == 0)
 		{
-			mOrderVector.PushBack(&(*ret));
+			throw std::runtime_error("Can't append with an empty string");
+		}
+
+		return EmplaceAttribute(std::move(name)).first->second;
+	}
+
+	Datum& Scope::AppendHashed(std::string_view name, size_t hash)
+	{
+		assert(name.size() > 0);
+		return EmplaceHashedAttribute(hash, std::string(name)).first->second;
+	}
+
+	void Scope::TruncateAttributes(size_t count)
+	{
+		if (count >= mOrderVector.Size())
+		{
+			return;
+		}
+
+		MarkModified();
+		while (mOrderVector.Size() > count)
+		{
+			PairType* pair = mOrderVector.Back();
+			Datum& datum = pair->second;
+			if (datum.Type() == Datum::DatumTypes::Table && !datum.IsExternalStorage())
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					Scope* childScope = datum.GetScope(i);
+					if (childScope->mParent == this)
+					{
+						delete childScope;
+					}
+				}
+			}
+
+			// The inline attributes come first in the order vector, so the last attribute is either the last inline one or in the HashMap
+			mOrderVector.PopBack();
+			if (mOrderVector.Size() < mInlineCount)
+			{
+				--mInlineCount;
+				assert(pair == InlinePair(mInlineCount));
+				pair->~PairType();
+			}
+			else
+			{
+				mMap->Remove(pair->first);
+			}
 		}
-		
-		return ret->second;
 	}
 
 	Scope& Scope::AppendScope(const std::string& name, size_t bucketSize)
@@ -300,6 +571,8 @@ namespace Library
 		Scope* scope = new Scope(bucketSize);
 		scope->mParent = this;
 		scopeDatum.PushBack(scope);
+		scope->mParentDatum = &scopeDatum;
+		scope->mParentIndex = scopeDatum.Size() - 1;
 		return *scope;
 	}
 
@@ -320,29 +593,158 @@ namespace Library
 			throw std::runtime_error("Can't append with an empty string");
 		}
 
-		auto [retIt, inserted] = mMap.Insert(PairType(name, Datum()));
-		retIt->second.SetType(Datum::DatumTypes::Table);
-		if (inserted)
-		{
-			mOrderVector.PushBack(&(*retIt));
-		}
+		Datum& datum = EmplaceAttribute(name, Datum::DatumTypes::Table).first->second;
+		datum.SetType(Datum::DatumTypes::Table);
 
 		child.Orphan();
 		child.mParent = this;
-		retIt->second.PushBack(&child);
+		datum.PushBack(&child);
+		child.mParentDatum = &datum;
+		child.mParentIndex = datum.Size() - 1;
 	}
 
-	void Scope::Orphan()
+	void Scope::Orphan(bool preserveOrder)
 	{
 		if (mParent != nullptr)
 		{
 			auto [owningDatum, index] = mParent->FindNestedScope(this);
 			if (owningDatum != nullptr)
 			{
-				owningDatum->RemoveAt(index);
+				if (preserveOrder)
+				{
+					owningDatum->RemoveAt(index);
+					mParent->UpdateChildSlots(*owningDatum, index);
+				}
+				else
+				{
+					Scope* last = owningDatum->GetScope(owningDatum->Size() - 1);
+					owningDatum->GetScope(index) = last;
+					owningDatum->PopBack();
+					if (last != this && last->mParent == mParent)
+					{
+						last->mParentIndex = index;
+					}
+				}
 			}
 			mParent = nullptr;
+			mParentDatum = nullptr;
+			mParentIndex = 0;
+		}
+	}
+
+	void Scope::DeleteScopes(const Vector<Scope*>& scopes)
+	{
+		for (Scope* scope : DetachScopes(scopes))
+		{
+			delete scope;
+		}
+	}
+
+	Vector<gsl::owner<Scope*>> Scope::DetachScopes(const Vector<Scope*>& scopes)
+	{
+		HashMap<const Scope*, bool> marked(scopes.Size() * 2 + 1);
+		for (Scope* scope : scopes)
+		{
+			marked.Insert(std::pair(scope, true));
+		}
+
+		// Descendants of a marked Scope are deleted along with it, so they must not be orphaned or deleted on their own
+		Vector<Scope*> roots;
+		roots.Reserve(marked.Size());
+		for (Scope* scope : scopes)
+		{
+			bool& pending = marked.At(scope);
+			if (!pending)
+			{
+				continue;
+			}
+			pending = false;
+
+			Scope* ancestor = scope->mParent;
+			while (ancestor != nullptr && !marked.ContainsKey(ancestor))
+			{
+				ancestor = ancestor->mParent;
+			}
+
+			if (ancestor == nullptr)
+			{
+				roots.PushBack(scope);
+			}
+		}
+
+		// Clear the slot of every root, then close the gaps of each Datum that lost a child in one pass
+		HashMap<Datum*, Scope*> emptiedDatums;
+		for (Scope* scope : roots)
+		{
+			if (scope->mParent != nullptr)
+			{
+				auto [owningDatum, index] = scope->mParent->FindNestedScope(scope);
+				if (owningDatum != nullptr)
+				{
+					owningDatum->GetScope(index) = nullptr;
+					emptiedDatums.Insert(std::pair(owningDatum, scope->mParent));
+				}
+			}
+		}
+
+		for (auto& [datum, parent] : emptiedDatums)
+		{
+			size_t size = 0;
+			for (size_t i = 0; i < datum->Size(); ++i)
+			{
+				Scope* child = datum->GetScope(i);
+				if (child != nullptr)
+				{
+					datum->GetScope(size++) = child;
+				}
+			}
+
+			while (datum->Size() > size)
+			{
+				datum->PopBack();
+			}
+			parent->UpdateChildSlots(*datum);
+		}
+
+		for (Scope* scope : roots)
+		{
+			scope->mParent = nullptr;
+			scope->mParentDatum = nullptr;
 		}
+
+		return roots;
+	}
+
+	void Scope::ReleaseChildren(Vector<gsl::owner<Scope*>>& children)
+	{
+		for (PairType* pair : mOrderVector)
+		{
+			Datum& datum = pair->second;
+			if (datum.Type() != Datum::DatumTypes::Table || datum.IsExternalStorage())
+			{
+				continue;
+			}
+
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				Scope* childScope = datum.GetScope(i);
+				if (childScope->mParent == this)
+				{
+					childScope->mParent = nullptr;
+					childScope->mParentDatum = nullptr;
+					children.PushBack(childScope);
+				}
+			}
+
+			while (!datum.IsEmpty())
+			{
+				datum.PopBack();
+			}
+		}
+	}
+
+	void Scope::Retire()
+	{
 	}
 
 	Datum& Scope::operator[](const std::string& name)
@@ -350,6 +752,11 @@ namespace Library
 		return Append(name);
 	}
 
+	Datum& Scope::operator[](std::string&& name)
+	{
+		return Append(std::move(name));
+	}
+
 	Datum& Scope::operator[](size_t index)
 	{
 		return mOrderVector[index]->second;
@@ -362,6 +769,7 @@ namespace Library
 
 	void Scope::Clear()
 	{
+		MarkModified();
 		for (PairType* pair : mOrderVector)
 		{
 			if (pair->second.Type() == Datum::DatumTypes::Table)
@@ -377,8 +785,7 @@ namespace Library
 			}
 		}
 
-		mMap.Clear();
-		mOrderVector.Clear();
+		DestroyAttributes();
 	}
 
 	gsl::owner<Scope*> Scope::Clone() const
@@ -388,6 +795,162 @@ namespace Library
 	
 #pragma endregion
 	
+#pragma region AttributeStorage
+
+	Scope::PairType* Scope::InlinePair(size_t index)
+	{
+		return std::launder(reinterpret_cast<PairType*>(mInlinePairs) + index);
+	}
+
+	void* Scope::operator new(size_t size)
+	{
+		std::byte* memory = static_cast<std::byte*>(::operator new(AllocationHeaderSize + size));
+		::new(memory) AllocationHeader{ nullptr };
+		return memory + AllocationHeaderSize;
+	}
+
+	void Scope::operator delete(void* pointer)
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(static_cast<std::byte*>(pointer) - AllocationHeaderSize);
+		BatchBlock* block = header->Block;
+		if (block == nullptr)
+		{
+			::operator delete(header);
+		}
+		else if (block->LiveCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			::operator delete(block);
+		}
+	}
+
+	Scope::PairType* Scope::FindPair(std::string_view name)
+	{
+		return FindPair(name, DefaultHash<std::string_view>()(name));
+	}
+
+	Scope::PairType* Scope::FindPair(std::string_view name, size_t hash)
+	{
+		assert(hash == DefaultHash<std::string_view>()(name));
+
+		for (size_t i = 0; i < mInlineCount; ++i)
+		{
+			if (mInlineHashes[i] == hash && InlinePair(i)->first == name)
+			{
+				return InlinePair(i);
+			}
+		}
+
+		if (mMap != nullptr)
+		{
+			auto it = mMap->Find(name);
+			if (it != mMap->end())
+			{
+				return &*it;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template<typename TName, typename... Args>
+	std::pair<Scope::PairType*, bool> Scope::EmplaceAttribute(TName&& name, Args&&... args)
+	{
+		return EmplaceHashedAttribute(DefaultHash<std::string_view>()(name), std::forward<TName>(name), std::forward<Args>(args)...);
+	}
+
+	template<typename TName, typename... Args>
+	std::pair<Scope::PairType*, bool> Scope::EmplaceHashedAttribute(size_t hash, TName&& name, Args&&... args)
+	{
+		PairType* pair = FindPair(name, hash);
+		if (pair != nullptr)
+		{
+			return std::pair(pair, false);
+		}
+
+		if (mInlineCount < InlineAttributeCapacity)
+		{
+			pair = new(InlinePair(mInlineCount)) PairType(std::piecewise_construct, std::forward_as_tuple(std::forward<TName>(name)), std::forward_as_tuple(std::forward<Args>(args)...));
+			mInlineHashes[mInlineCount++] = hash;
+		}
+		else
+		{
+			if (mMap == nullptr)
+			{
+				mMap = std::make_unique<HashMap<std::string, Datum>>(mBucketSize);
+			}
+
+			pair = &*mMap->TryEmplace(std::forward<TName>(name), std::forward<Args>(args)...).first;
+		}
+
+		pair->second.mOwner = this;
+		pair->second.MarkModified();
+		mOrderVector.PushBack(pair);
+		return std::pair(pair, true);
+	}
+
+	void Scope::MoveAttributes(Scope& rhs) noexcept
+	{
+		assert(mInlineCount == 0 && mMap == nullptr);
+
+		// The pairs in the HashMap live in its nodes and keep their addresses, only the inline pairs are moved
+		mMap = std::move(rhs.mMap);
+		mOrderVector = std::move(rhs.mOrderVector);
+
+		for (size_t i = 0; i < rhs.mInlineCount; ++i)
+		{
+			new(InlinePair(i)) PairType(std::move(*rhs.InlinePair(i)));
+			mInlineHashes[i] = rhs.mInlineHashes[i];
+		}
+		mInlineCount = rhs.mInlineCount;
+
+		for (PairType*& pair : mOrderVector)
+		{
+			for (size_t i = 0; i < mInlineCount; ++i)
+			{
+				if (pair == rhs.InlinePair(i))
+				{
+					pair = InlinePair(i);
+					break;
+				}
+			}
+			pair->second.mOwner = this;
+		}
+
+		rhs.DestroyAttributes();
+	}
+
+	void Scope::UpdateChildSlots(Datum& datum, size_t start)
+	{
+		for (size_t i = start; i < datum.Size(); ++i)
+		{
+			Scope* child = datum.GetScope(i);
+			if (child->mParent == this)
+			{
+				child->mParentDatum = &datum;
+				child->mParentIndex = i;
+			}
+		}
+	}
+
+	void Scope::DestroyAttributes()
+	{
+		for (size_t i = 0; i < mInlineCount; ++i)
+		{
+			InlinePair(i)->~PairType();
+		}
+		mInlineCount = 0;
+
+		mMap.reset();
+		mOrderVector.Clear();
+	}
+
+#pragma endregion
+
 #pragma region RTTIOverloads
 
 	std::string Scope::ToString() const
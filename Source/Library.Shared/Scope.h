@@ -1,11 +1,18 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <memory>
+#include <cstddef>
+#include <functional>
+#include <atomic>
+#include <new>
 #include <gsl/gsl>
 #include "RTTI.h"
 #include "HashMap.h"
 #include "Datum.h"
 #include "Vector.h"
+#include "SmallVector.h"
 
 namespace Library
 {
@@ -16,12 +23,22 @@ namespace Library
 	public:
 		using PairType = std::pair<const std::string, Datum>;
 
+		/// <summary>
+		/// The number of attributes stored inline in the Scope and found by a linear scan. Attributes appended past it go into a HashMap.
+		/// Every Scope pays for the inline attributes whether it uses them or not, so this covers the small Scopes created per frame rather than every Attributed type
+		/// </summary>
+		static constexpr size_t InlineAttributeCapacity = 4;
+		/// <summary>
+		/// The container that keeps the insertion order of the attributes. Holds as many inline as there are inline attributes
+		/// </summary>
+		using OrderVectorType = SmallVector<PairType*, InlineAttributeCapacity>;
+
 #pragma region MemberMethods
 
 		/// <summary>
-		/// Default constructor. Sets the HashMap and Vector to their default sizes unless the user specifies a starting capacity.
+		/// Default constructor. Allocates nothing until the Scope outgrows its inline attributes, at which point the HashMap is created with bucketSize buckets.
 		/// </summary>
-		/// <param name="capacity">User defined capacity for the table</param>
+		/// <param name="bucketSize">User defined bucket size for the HashMap of the attributes that don't fit inline</param>
 		Scope(size_t bucketSize = 11);
 
 		/// <summary>
@@ -62,7 +79,7 @@ namespace Library
 #pragma region Equality
 
 		/// <summary>
-		/// Compares this scope to another scope for logical equivalence
+		/// Compares this scope to another scope for logical equivalence. Returns false right away if their structural hashes differ
 		/// </summary>
 		/// <param name="rhs">The scope to be compared to this one</param>
 		/// <returns>True if the contents of both scope match, false otherwise</returns>
@@ -74,6 +91,60 @@ namespace Library
 		/// <returns>True if the contents don't match, false otherwise</returns>
 		bool operator!=(const Scope& rhs) const;
 
+		/// <summary>
+		/// Returns a hash of the names and contents of the attributes of this Scope and, through its Tables, of all its descendants. Equal Scopes have equal hashes.
+		/// Pointer attributes only contribute their count, so a Scope they point to changing never leaves the hash stale.
+		/// The hash is cached and only recomputed for the Scopes that changed since, along with their ancestors.
+		/// Only writes made through the mutating methods of a Datum, such as Set, Edit, PushBack and assignment, are noticed on their own.
+		/// Writes through a reference from a non-const getter or from AttributeHandle::Get, and writes made directly to a prescribed member, must be reported with MarkModified.
+		/// operator== never relies on the hash, but Diff does
+		/// </summary>
+		/// <returns>The structural hash of this Scope</returns>
+		size_t Hash() const;
+		/// <summary>
+		/// Records that the attributes of this Scope changed in the current change frame. Discards the cached hash of this Scope and its ancestors and marks their subtrees changed.
+		/// Stops at the first ancestor that was already marked, so marking many Scopes in one frame costs little more than marking one
+		/// </summary>
+		void MarkModified();
+		/// <summary>
+		/// Records a write made directly to the member behind a prescribed attribute, by marking the Datum of that attribute modified.
+		/// </summary>
+		/// <param name="name">The name of the attribute that was written to</param>
+		/// <exception cref="std::runtime_error">Throws an exception if this Scope has no attribute with that name</exception>
+		void MarkModified(std::string_view name);
+
+		/// <summary>
+		/// Returns the current change frame. Every write a Datum or Scope tracks, as described for Datum::Version, is stamped with it, so the frame read before some work began tells what that work changed.
+		/// </summary>
+		/// <returns>The current change frame, which is never 0</returns>
+		static size_t ChangeFrame();
+		/// <summary>
+		/// Starts a new change frame. World::Update starts one every update.
+		/// </summary>
+		/// <returns>The new change frame</returns>
+		static size_t AdvanceChangeFrame();
+		/// <summary>
+		/// Calls the visitor on this Scope and each descendant whose own attributes changed in or after the passed in change frame.
+		/// Subtrees that did not change are skipped without being visited, so the cost grows with the number of changes rather than the size of the hierarchy
+		/// </summary>
+		/// <param name="since">The first change frame of interest</param>
+		/// <param name="visitor">Called with every changed Scope, parents before their children</param>
+		void ForEachChangedScope(size_t since, const std::function<void(Scope&)>& visitor);
+		/// <summary>
+		/// Calls the visitor on every attribute of this Scope and its descendants whose Datum changed in or after the passed in change frame.
+		/// </summary>
+		/// <param name="since">The first change frame of interest</param>
+		/// <param name="visitor">Called with the Scope and the changed attribute</param>
+		void ForEachChangedAttribute(size_t since, const std::function<void(Scope&, PairType&)>& visitor);
+		/// <summary>
+		/// Lists the paths of the attributes that differ between two Scopes, such as "Entities[2].Name". Subtrees whose hashes match and that hold no Pointers are skipped,
+		/// so the time taken grows with the number of differences rather than the size of the Scopes. Writes that were not reported, as described for Hash, can therefore be missed
+		/// </summary>
+		/// <param name="lhs">The first Scope being compared</param>
+		/// <param name="rhs">The second Scope being compared</param>
+		/// <returns>The paths of the attributes that differ or that only one of the Scopes has, ordered like the attributes of lhs followed by those only rhs has</returns>
+		static Vector<std::string> Diff(const Scope& lhs, const Scope& rhs);
+
 #pragma endregion
 
 #pragma region ScopeInformation
@@ -86,13 +157,23 @@ namespace Library
 		/// <summary>
 		/// Returns a number representing the number of slots (with chaining) contained within the internal HashMap
 		/// </summary>
-		/// <returns>The number of buckets within the internal HashMap</returns>
+		/// <returns>The number of buckets within the internal HashMap, or the number it will be created with if the Scope has not outgrown its inline attributes</returns>
 		size_t BucketSize() const;
 		/// <summary>
+		/// Checks if the Scope has outgrown its inline attributes and keeps the rest of them in a HashMap
+		/// </summary>
+		/// <returns>True if the Scope holds more than InlineAttributeCapacity attributes, false otherwise</returns>
+		bool IsHashed() const;
+		/// <summary>
 		/// Returns the number of string datum pairs (attributes) contained within this scope
 		/// </summary>
 		/// <returns>The number of attributes contained within this scope</returns>
 		size_t NumAttributes() const;
+		/// <summary>
+		/// Approximates the number of bytes this Scope occupies, including the storage of its attributes but not of its child Scopes
+		/// </summary>
+		/// <returns>The approximate number of bytes owned directly by this Scope</returns>
+		size_t Footprint() const;
 
 		/// <summary>
 		/// Checks whether or not this Scope is an ancestor of the passed in Scope.
@@ -115,15 +196,15 @@ namespace Library
 		/// Gives access to the order vector of attributes contained within this Scope
 		/// </summary>
 		/// <returns>A const reference to the order vector of name datum pairs contained within this Scope</returns>
-		const Vector<PairType*>& GetOrderVector() const;
+		const OrderVectorType& GetOrderVector() const;
 
 		/// <summary>
 		/// Finds and returns a pointer to the Datum associated with the passed in name.
-		/// This function only looks within this Scope's attributes.
+		/// This function only looks within this Scope's attributes. Looking up a string literal does not allocate.
 		/// </summary>
 		/// <param name="name">The string key of the Datum being searched for</param>
 		/// <returns>A pointer to the Datum associated with the name passed in. Will return nullptr if nothing is found.</returns>
-		Datum* Find(const std::string& name);
+		Datum* Find(std::string_view name);
 
 		/// <summary>
 		/// Finds and returns a const Datum pointer associated with the passed in name.
@@ -131,7 +212,7 @@ namespace Library
 		/// </summary>
 		/// <param name="name">The string key of the Datum being searched for</param>
 		/// <returns>A const Datum pointer of the Datum associated with the name passed in. Will return nullptr if nothing is found.</returns>
-		const Datum* Find(const std::string& name) const;
+		const Datum* Find(std::string_view name) const;
 
 		/// <summary>
 		/// Finds and returns a pointer to the Datum associated with the passed in name.
@@ -140,7 +221,7 @@ namespace Library
 		/// <param name="name">The string key of the Datum being searched for</param>
 		/// <param name="foundScope">An output parameter that, if not nullptr, will be set to the address of the Scope in which the returned Datum was found</param>
 		/// <returns>A pointer to the Datum associated with the name passed in. Will return nullptr if nothing is found.</returns>
-		Datum* Search(const std::string& name, Scope** foundScope = nullptr);
+		Datum* Search(std::string_view name, Scope** foundScope = nullptr);
 
 		/// <summary>
 		/// Finds and returns a const Datum pointer associated with the passed in name.
@@ -149,7 +230,7 @@ namespace Library
 		/// <param name="name">The string key of the Datum being searched for</param>
 		/// <param name="foundScope">An output parameter that, if not nullptr, will be set to the address of the Scope in which the returned Datum was found</param>
 		/// <returns>A const Datum pointer of the Datum associated with the name passed in. Will return nullptr if nothing is found.</returns>
-		const Datum* Search(const std::string& name, Scope** foundScope = nullptr) const;
+		const Datum* Search(std::string_view name, Scope** foundScope = nullptr) const;
 
 		/// <summary>
 		/// Searches this Scope as well as up the hierarchy for the Datum associated with the passed in name and has the passed in value.
@@ -162,7 +243,8 @@ namespace Library
 		virtual Datum* SearchForValue(const std::string& name, const Datum& value, Scope** foundScope = nullptr);
 
 		/// <summary>
-		/// Finds the Datum* and index within that Datum of which the passed in Scope* belongs to. 
+		/// Finds the Datum* and index within that Datum of which the passed in Scope* belongs to.
+		/// Constant time for children of this Scope, which remember their slot. Other Scopes are searched for through every Table Datum
 		/// </summary>
 		/// <param name="scope">A pointer to the Scope attempting to be found within this Scope</param>
 		/// <returns>A std::pair that contains the Datum* and index of where the passed in Scope* was found. The Datum* will be nullptr if nothing was found</returns>
@@ -180,6 +262,14 @@ namespace Library
 		/// <returns>The new or existing Datum associated with the passed in name</returns>
 		/// <exception cref="std::runtime_error">Throws an exception if you pass an empty string to this method</exception>
 		Datum& Append(const std::string& name);
+		/// <summary>
+		/// Takes an r-value string and returns a reference to a Datum with the associated name. If one doesn't exist it will
+		/// create one, moving the name into the new entry, otherwise it will return the already existing one.
+		/// </summary>
+		/// <param name="name">The name that the returned Datum should be associated with</param>
+		/// <returns>The new or existing Datum associated with the passed in name</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if you pass an empty string to this method</exception>
+		Datum& Append(std::string&& name);
 
 		/// <summary>
 		/// Takes a constant string and adds a new Scope to either an existing Table Datum associated with that string or
@@ -205,7 +295,68 @@ namespace Library
 		/// Removes the passed in Scope from its current parent and sets its parent to nullptr
 		/// If you call Orphan on a child and don't adopt it into another Scope, you are responsible for deleting its memory
 		/// </summary>
-		void Orphan();
+		/// <param name="preserveOrder">
+		/// If true the siblings after this Scope shift down one index, which costs time proportional to their number.
+		/// If false the last sibling is moved into the slot of this Scope, which takes constant time
+		/// </param>
+		void Orphan(bool preserveOrder = true);
+		/// <summary>
+		/// Orphans and deletes every passed in Scope. A Scope listed more than once, or whose ancestor is also listed, is deleted only once.
+		/// Each parent Table Datum is compacted in a single pass that keeps the order of the remaining children, so the whole batch takes linear time
+		/// </summary>
+		/// <param name="scopes">The heap allocated Scopes to delete</param>
+		static void DeleteScopes(const Vector<Scope*>& scopes);
+		/// <summary>
+		/// Orphans every passed in Scope the same way DeleteScopes does, but hands them back instead of deleting them.
+		/// A Scope whose ancestor is also listed is left attached to that ancestor
+		/// </summary>
+		/// <param name="scopes">The heap allocated Scopes to detach</param>
+		/// <returns>The detached Scopes, which the caller is now responsible for deleting</returns>
+		static Vector<gsl::owner<Scope*>> DetachScopes(const Vector<Scope*>& scopes);
+
+		/// <summary>
+		/// Allocates a Scope behind a header that records the batch it was created in, if any, so that Scopes created together by NewBatch can still be deleted one at a time.
+		/// </summary>
+		/// <param name="size">The size of the Scope</param>
+		/// <returns>The memory for the Scope</returns>
+		static void* operator new(size_t size);
+		/// <summary>
+		/// Frees a Scope allocated on its own, or releases it from its batch and frees the batch once all of its Scopes are deleted.
+		/// </summary>
+		/// <param name="pointer">The memory of the Scope</param>
+		static void operator delete(void* pointer);
+		/// <summary>
+		/// Placement new, which the class specific operator new would otherwise hide. Scopes constructed in place are not deleted with operator delete.
+		/// </summary>
+		/// <param name="size">The size of the Scope</param>
+		/// <param name="place">The memory the Scope is constructed in</param>
+		/// <returns>The passed in memory</returns>
+		static void* operator new(size_t, void* place) noexcept { return place; }
+		/// <summary>
+		/// Matches the placement new. Does nothing
+		/// </summary>
+		static void operator delete(void*, void*) noexcept {}
+		/// <summary>
+		/// Default constructs Scopes of the passed in type in one contiguous allocation. Each of them is deleted like any other Scope,
+		/// and the allocation is freed with the last of them
+		/// </summary>
+		/// <typeparam name="TScope">The type of the Scopes, which must be default constructible</typeparam>
+		/// <typeparam name="TProduct">The type the caller stores them as, a base of TScope</typeparam>
+		/// <param name="count">The number of Scopes to construct</param>
+		/// <param name="products">The Vector the new Scopes are appended to. The caller is responsible for deleting them</param>
+		template<typename TScope, typename TProduct>
+		static void NewBatch(size_t count, Vector<TProduct*>& products);
+		/// <summary>
+		/// Orphans every child Scope of this Scope and appends it to the passed in Vector, leaving the Table Datums of this Scope empty.
+		/// Lets a hierarchy be destroyed a few Scopes at a time instead of all at once by the destructor
+		/// </summary>
+		/// <param name="children">The Vector that receives the children, which the caller is now responsible for deleting</param>
+		void ReleaseChildren(Vector<gsl::owner<Scope*>>& children);
+		/// <summary>
+		/// Called once a detached Scope has been queued for deferred destruction, since it stays alive for a while after leaving its hierarchy.
+		/// Children of Scope that react to the outside world, such as event subscribers, should override this method to stop doing so
+		/// </summary>
+		virtual void Retire();
 
 		/// <summary>
 		/// Thin wrapper to the Append function for syntactic convenience. 
@@ -216,6 +367,14 @@ namespace Library
 		/// <exception cref="std::runtime_error">Throws an exception if you pass an empty string to this method</exception>
 		Datum& operator[](const std::string& name);
 		/// <summary>
+		/// Thin wrapper to the r-value Append function for syntactic convenience.
+		/// Will append a new Datum or return the existing one associated with the passed in name.
+		/// </summary>
+		/// <param name="name">The name that the returned Datum should be associated with</param>
+		/// <returns>The new or existing Datum associated with the passed in name</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if you pass an empty string to this method</exception>
+		Datum& operator[](std::string&& name);
+		/// <summary>
 		/// Takes an unsigned integer and returns a reference to a Datum contained within this Scope at the given index.
 		/// Index values correspond to the order in which items were appended.
 		/// </summary>
@@ -275,12 +434,172 @@ namespace Library
 		void CopyHelper(const Scope& rhs);
 
 		/// <summary>
-		/// A single function for the Move Semantics so that the Move constructor and assignment operator don't duplicate code
+		/// A single function for the Move Semantics so that the Move constructor and assignment operator don't duplicate code.
+		/// Takes over the slot of the right hand side Scope in its parent
+		/// </summary>
+		void MoveHelper(Scope* rhs) noexcept;
+
+		/// <summary>
+		/// Appends an attribute whose name hash is already known, such as a prescribed attribute hashed at compile time.
+		/// If the attribute already exists it will return a reference to the existing Datum
+		/// </summary>
+		/// <param name="name">The name of the attribute. Must not be empty</param>
+		/// <param name="hash">The DefaultHash of the name</param>
+		/// <returns>A reference to the Datum associated with the name</returns>
+		Datum& AppendHashed(std::string_view name, size_t hash);
+		/// <summary>
+		/// Removes every attribute appended after the first count, deleting the child Scopes they own. The remaining attributes keep their addresses
 		/// </summary>
-		void MoveHelper(const Scope* rhs) noexcept;
+		/// <param name="count">The number of attributes to keep</param>
+		void TruncateAttributes(size_t count);
 
 		Scope* mParent = nullptr;
-		HashMap<std::string, Datum> mMap;
-		Vector<PairType*> mOrderVector;
+		/// <summary>
+		/// The attributes appended after the first InlineAttributeCapacity. Only allocated once the Scope outgrows its inline attributes, so the others don't pay for its size
+		/// </summary>
+		std::unique_ptr<HashMap<std::string, Datum>> mMap;
+		OrderVectorType mOrderVector;
+
+	private:
+		/// <summary>
+		/// Returns the inline attribute at the passed in index
+		/// </summary>
+		/// <param name="index">The index of the inline attribute. Must be less than mInlineCount</param>
+		/// <returns>A pointer to the inline attribute</returns>
+		PairType* InlinePair(size_t index);
+		/// <summary>
+		/// Finds the attribute with the passed in name. Inline attributes are scanned comparing their cached hashes before their names
+		/// </summary>
+		/// <param name="name">The name of the attribute</param>
+		/// <returns>A pointer to the attribute, or nullptr if this Scope has no attribute with that name</returns>
+		PairType* FindPair(std::string_view name);
+		/// <summary>
+		/// Finds the attribute with the passed in name, whose hash is already known
+		/// </summary>
+		/// <param name="name">The name of the attribute</param>
+		/// <param name="hash">The DefaultHash of the name</param>
+		/// <returns>A pointer to the attribute, or nullptr if this Scope has no attribute with that name</returns>
+		PairType* FindPair(std::string_view name, size_t hash);
+		/// <summary>
+		/// Constructs an attribute with the passed in name if this Scope doesn't already have one, inline if there is room and in the HashMap otherwise
+		/// </summary>
+		/// <param name="name">The name of the attribute</param>
+		/// <param name="args">The arguments forwarded to the constructor of the Datum</param>
+		/// <returns>A pointer to the new or existing attribute, and true if it was constructed</returns>
+		template<typename TName, typename... Args>
+		std::pair<PairType*, bool> EmplaceAttribute(TName&& name, Args&&... args);
+		/// <summary>
+		/// Constructs an attribute like EmplaceAttribute, with the hash of its name already known
+		/// </summary>
+		/// <param name="hash">The DefaultHash of the name</param>
+		/// <param name="name">The name of the attribute</param>
+		/// <param name="args">The arguments forwarded to the constructor of the Datum</param>
+		/// <returns>A pointer to the new or existing attribute, and true if it was constructed</returns>
+		template<typename TName, typename... Args>
+		std::pair<PairType*, bool> EmplaceHashedAttribute(size_t hash, TName&& name, Args&&... args);
+		/// <summary>
+		/// Moves the attributes of the right hand side Scope into this empty Scope and points the order vector at their new addresses
+		/// </summary>
+		/// <param name="rhs">The Scope whose attributes are moved. It is left empty</param>
+		void MoveAttributes(Scope& rhs) noexcept;
+		/// <summary>
+		/// Destroys every attribute of this Scope without touching the Scopes they contain
+		/// </summary>
+		void DestroyAttributes();
+		/// <summary>
+		/// Records the slot of every child of this Scope held by the passed in Datum, starting at the passed in index
+		/// </summary>
+		/// <param name="datum">A Table Datum of this Scope</param>
+		/// <param name="start">The index of the first child whose slot is recorded</param>
+		void UpdateChildSlots(Datum& datum, size_t start = 0);
+		/// <summary>
+		/// Appends the paths that differ between two Scopes to the passed in Vector, each prefixed with the passed in path.
+		/// </summary>
+		/// <param name="lhs">The first Scope being compared</param>
+		/// <param name="rhs">The second Scope being compared</param>
+		/// <param name="prefix">The path of the Scopes being compared, empty or ending with a period</param>
+		/// <param name="differences">The Vector receiving the paths</param>
+		static void DiffHelper(const Scope& lhs, const Scope& rhs, const std::string& prefix, Vector<std::string>& differences);
+		/// <summary>
+		/// Returns whether two Scopes can differ. Their hashes tell them apart unless one of them holds Pointers, whose targets have to be compared.
+		/// </summary>
+		/// <param name="lhs">The first Scope being compared</param>
+		/// <param name="rhs">The second Scope being compared</param>
+		/// <returns>False if the Scopes are known to be equal, true otherwise</returns>
+		static bool MayDiffer(const Scope& lhs, const Scope& rhs);
+
+		/// <summary>
+		/// Storage for the first InlineAttributeCapacity attributes. They are never moved while the Scope lives, so pointers to them stay valid
+		/// </summary>
+		alignas(PairType) std::byte mInlinePairs[sizeof(PairType) * InlineAttributeCapacity];
+		/// <summary>
+		/// The hash of the name of every inline attribute, compared before the names themselves
+		/// </summary>
+		size_t mInlineHashes[InlineAttributeCapacity];
+		/// <summary>
+		/// The number of constructed inline attributes
+		/// </summary>
+		size_t mInlineCount = 0;
+		/// <summary>
+		/// The bucket size the HashMap is created with
+		/// </summary>
+		size_t mBucketSize = 11;
+		/// <summary>
+		/// The Table Datum of the parent that holds this Scope. Checked against the parent before it is trusted
+		/// </summary>
+		Datum* mParentDatum = nullptr;
+		/// <summary>
+		/// The index of this Scope within mParentDatum
+		/// </summary>
+		size_t mParentIndex = 0;
+		/// <summary>
+		/// The structural hash of this Scope, valid while mIsHashValid is set. A Scope with a valid hash only has descendants with valid hashes
+		/// </summary>
+		mutable size_t mHash = 0;
+		/// <summary>
+		/// Whether mHash is up to date
+		/// </summary>
+		mutable bool mIsHashValid = false;
+		/// <summary>
+		/// Whether this Scope or one of its descendants has a non empty Pointer attribute, whose targets mHash doesn't cover. Valid along with mHash
+		/// </summary>
+		mutable bool mHasPointers = false;
+		/// <summary>
+		/// The change frame in which the attributes of this Scope last changed
+		/// </summary>
+		size_t mChangeFrame = 0;
+		/// <summary>
+		/// The change frame in which this Scope or any of its descendants last changed. Never older than that of a descendant
+		/// </summary>
+		size_t mSubtreeChangeFrame = 0;
+		/// <summary>
+		/// The current change frame
+		/// </summary>
+		inline static std::atomic<size_t> sChangeFrame{ 1 };
+
+		/// <summary>
+		/// The start of an allocation made by NewBatch. Counts the Scopes of the batch that haven't been deleted
+		/// </summary>
+		struct BatchBlock final
+		{
+			std::atomic<size_t> LiveCount;
+		};
+		/// <summary>
+		/// Sits in front of every heap allocated Scope
+		/// </summary>
+		struct AllocationHeader final
+		{
+			/// <summary>
+			/// The batch the Scope belongs to, or nullptr if it was allocated on its own
+			/// </summary>
+			BatchBlock* Block;
+		};
+		/// <summary>
+		/// The space taken by the header in front of a Scope, and by the BatchBlock in front of a batch. Keeps the Scopes aligned
+		/// </summary>
+		static constexpr size_t AllocationHeaderSize = alignof(std::max_align_t);
+		static_assert(sizeof(AllocationHeader) <= AllocationHeaderSize && sizeof(BatchBlock) <= AllocationHeaderSize);
 	};
-}
\ No newline at end of file
+}
+
+#include "Scope.inl"
\ No newline at end of file
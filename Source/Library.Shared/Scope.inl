@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Scope.h"
+
+namespace Library
+{
+	template<typename TScope, typename TProduct>
+	inline void Scope::NewBatch(size_t count, Vector<TProduct*>& products)
+	{
+		static_assert(std::is_base_of_v<Scope, TScope>, "NewBatch can only construct Scopes");
+		static_assert(alignof(TScope) <= AllocationHeaderSize, "The Scope is aligned more strictly than its header");
+
+		if (count == 0)
+		{
+			return;
+		}
+
+		const size_t slotSize = AllocationHeaderSize + (sizeof(TScope) + AllocationHeaderSize - 1) / AllocationHeaderSize * AllocationHeaderSize;
+		std::byte* memory = static_cast<std::byte*>(::operator new(AllocationHeaderSize + slotSize * count));
+		BatchBlock* block = ::new(memory) BatchBlock{ count };
+		products.Reserve(products.Size() + count);
+
+		size_t constructed = 0;
+		try
+		{
+			for (; constructed < count; ++constructed)
+			{
+				std::byte* slot = memory + AllocationHeaderSize + slotSize * constructed;
+				::new(slot) AllocationHeader{ block };
+				products.PushBack(::new(slot + AllocationHeaderSize) TScope());
+			}
+		}
+		catch (...)
+		{
+			for (; constructed > 0; --constructed)
+			{
+				products.Back()->~TProduct();
+				products.PopBack();
+			}
+			::operator delete(memory);
+			throw;
+		}
+	}
+}
@@ -0,0 +1,176 @@
+#include "pch.h"
+#include "ScopeReclaimer.h"
+
+namespace Library
+{
+	ScopeReclaimer::ScopeReclaimer(Microseconds frameBudget) :
+		mFrameBudget(frameBudget)
+	{
+	}
+
+	ScopeReclaimer::ScopeReclaimer(const ScopeReclaimer& rhs) :
+		mFrameBudget(rhs.mFrameBudget)
+	{
+	}
+
+	ScopeReclaimer::ScopeReclaimer(ScopeReclaimer&& rhs) noexcept :
+		mPending(std::move(rhs.mPending)), mUnretired(std::move(rhs.mUnretired)), mPendingBytes(rhs.mPendingBytes), mFrameBudget(rhs.mFrameBudget)
+	{
+		rhs.mPendingBytes = 0;
+	}
+
+	ScopeReclaimer& ScopeReclaimer::operator=(const ScopeReclaimer& rhs)
+	{
+		if (this != &rhs)
+		{
+			ReclaimAll();
+			mFrameBudget = rhs.mFrameBudget;
+		}
+
+		return *this;
+	}
+
+	ScopeReclaimer& ScopeReclaimer::operator=(ScopeReclaimer&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			ReclaimAll();
+			mPending = std::move(rhs.mPending);
+			mUnretired = std::move(rhs.mUnretired);
+			mPendingBytes = rhs.mPendingBytes;
+			mFrameBudget = rhs.mFrameBudget;
+			rhs.mPendingBytes = 0;
+		}
+
+		return *this;
+	}
+
+	ScopeReclaimer::~ScopeReclaimer()
+	{
+		ReclaimAll();
+	}
+
+	void ScopeReclaimer::Enqueue(gsl::owner<Scope*> scope)
+	{
+		assert(scope != nullptr);
+		if (scope->GetParent() != nullptr)
+		{
+			throw std::runtime_error("Cannot reclaim a Scope that still has a parent.");
+		}
+
+		mPending.PushBack(scope);
+		mUnretired.PushBack(scope);
+	}
+
+	void ScopeReclaimer::Enqueue(const Vector<gsl::owner<Scope*>>& scopes)
+	{
+		for (Scope* scope : scopes)
+		{
+			Enqueue(scope);
+		}
+	}
+
+	size_t ScopeReclaimer::Reclaim()
+	{
+		const Clock::time_point deadline = Clock::now() + mFrameBudget;
+
+		size_t reclaimed = 0;
+		bool progressed = false;
+		while (!mPending.IsEmpty() && (!progressed || Clock::now() < deadline))
+		{
+			reclaimed += ReclaimStep();
+			progressed = true;
+		}
+
+		return reclaimed;
+	}
+
+	size_t ScopeReclaimer::ReclaimAll()
+	{
+		size_t reclaimed = 0;
+		while (!mPending.IsEmpty())
+		{
+			reclaimed += ReclaimStep();
+		}
+
+		assert(mPendingBytes == 0);
+		return reclaimed;
+	}
+
+	ScopeReclaimer::Microseconds ScopeReclaimer::FrameBudget() const
+	{
+		return mFrameBudget;
+	}
+
+	void ScopeReclaimer::SetFrameBudget(Microseconds frameBudget)
+	{
+		mFrameBudget = frameBudget;
+	}
+
+	size_t ScopeReclaimer::PendingBytes() const
+	{
+		return mPendingBytes;
+	}
+
+	bool ScopeReclaimer::IsEmpty() const
+	{
+		return mPending.IsEmpty();
+	}
+
+	bool ScopeReclaimer::IsRetired() const
+	{
+		return mUnretired.IsEmpty();
+	}
+
+	bool ScopeReclaimer::ReclaimStep()
+	{
+		if (mUnretired.IsEmpty())
+		{
+			ReclaimOne();
+			return true;
+		}
+
+		RetireOne();
+		return false;
+	}
+
+	void ScopeReclaimer::RetireOne()
+	{
+		Scope* scope = mUnretired.Back();
+		mUnretired.PopBack();
+
+		scope->Retire();
+		mPendingBytes += scope->Footprint();
+
+		for (const Scope::PairType* pair : scope->GetOrderVector())
+		{
+			const Datum& datum = pair->second;
+			if (datum.Type() != Datum::DatumTypes::Table || datum.IsExternalStorage())
+			{
+				continue;
+			}
+
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				Scope* child = datum.GetScope(i);
+				if (child->GetParent() == scope)
+				{
+					mUnretired.PushBack(child);
+				}
+			}
+		}
+	}
+
+	void ScopeReclaimer::ReclaimOne()
+	{
+		Scope* scope = mPending.Back();
+		mPending.PopBack();
+
+		// Retiring counted the same footprint, so a mismatch shows up as the total not returning to 0
+		mPendingBytes -= scope->Footprint();
+
+		// The children go to the back of the queue so a hierarchy is finished before the next one is started
+		scope->ReleaseChildren(mPending);
+		delete scope;
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <chrono>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Destroys detached Scope hierarchies a few Scopes at a time so that deleting a large hierarchy is spread across several frames instead of stalling one.
+	/// Destruction happens on the calling thread, since Scope destructors touch shared state such as the node pools and the event subscriber lists.
+	/// </summary>
+	class ScopeReclaimer final
+	{
+	public:
+
+		using Clock = std::chrono::high_resolution_clock;
+		using Microseconds = std::chrono::microseconds;
+
+		/// <summary>
+		/// The time Reclaim spends destroying Scopes when no other budget has been set.
+		/// </summary>
+		inline static const Microseconds DefaultFrameBudget{ 1000 };
+
+		/// <summary>
+		/// Constructor that takes the time each call to Reclaim may spend destroying Scopes.
+		/// </summary>
+		/// <param name="frameBudget">The time each call to Reclaim may spend destroying Scopes</param>
+		explicit ScopeReclaimer(Microseconds frameBudget = DefaultFrameBudget);
+		/// <summary>
+		/// Copy constructor. Only the frame budget is copied, the pending Scopes still belong to rhs.
+		/// </summary>
+		/// <param name="rhs">The ScopeReclaimer whose frame budget is copied</param>
+		ScopeReclaimer(const ScopeReclaimer& rhs);
+		/// <summary>
+		/// Move constructor. Takes over the pending Scopes of rhs.
+		/// </summary>
+		/// <param name="rhs">The ScopeReclaimer being moved into this one</param>
+		ScopeReclaimer(ScopeReclaimer&& rhs) noexcept;
+		/// <summary>
+		/// Copy assignment operator. Destroys the pending Scopes of this ScopeReclaimer and copies the frame budget of rhs.
+		/// </summary>
+		/// <param name="rhs">The ScopeReclaimer whose frame budget is copied</param>
+		/// <returns>A reference to this ScopeReclaimer after being mutated</returns>
+		ScopeReclaimer& operator=(const ScopeReclaimer& rhs);
+		/// <summary>
+		/// Move assignment operator. Destroys the pending Scopes of this ScopeReclaimer and takes over those of rhs.
+		/// </summary>
+		/// <param name="rhs">The ScopeReclaimer being moved into this one</param>
+		/// <returns>A reference to this ScopeReclaimer after being mutated</returns>
+		ScopeReclaimer& operator=(ScopeReclaimer&& rhs) noexcept;
+		/// <summary>
+		/// Destructor. Destroys every pending Scope regardless of the frame budget.
+		/// </summary>
+		~ScopeReclaimer();
+
+		/// <summary>
+		/// Takes ownership of a detached Scope and its descendants and queues them for destruction.
+		/// Only the Scope itself is queued here, its hierarchy is walked and retired by the following calls to Reclaim so the cost of queuing doesn't grow with its size.
+		/// </summary>
+		/// <param name="scope">The heap allocated Scope to destroy. Must not have a parent</param>
+		/// <exception cref="std::runtime_error">Throws an exception if the Scope still has a parent</exception>
+		void Enqueue(gsl::owner<Scope*> scope);
+		/// <summary>
+		/// Takes ownership of every passed in detached Scope and queues them for destruction.
+		/// </summary>
+		/// <param name="scopes">The heap allocated Scopes to destroy. None of them may have a parent</param>
+		/// <exception cref="std::runtime_error">Throws an exception if one of the Scopes still has a parent</exception>
+		void Enqueue(const Vector<gsl::owner<Scope*>>& scopes);
+
+		/// <summary>
+		/// Retires and then destroys pending Scopes until the frame budget runs out. Every queued hierarchy is retired, so it stops reacting to the world,
+		/// before any more Scopes are destroyed. At least one Scope is retired or destroyed per call so the queue always drains.
+		/// </summary>
+		/// <returns>The number of Scopes destroyed</returns>
+		size_t Reclaim();
+		/// <summary>
+		/// Destroys every pending Scope regardless of the frame budget.
+		/// </summary>
+		/// <returns>The number of Scopes destroyed</returns>
+		size_t ReclaimAll();
+
+		/// <summary>
+		/// Returns the time each call to Reclaim may spend destroying Scopes.
+		/// </summary>
+		/// <returns>The frame budget</returns>
+		Microseconds FrameBudget() const;
+		/// <summary>
+		/// Sets the time each call to Reclaim may spend destroying Scopes.
+		/// </summary>
+		/// <param name="frameBudget">The new frame budget</param>
+		void SetFrameBudget(Microseconds frameBudget);
+
+		/// <summary>
+		/// Returns the approximate number of bytes still waiting to be reclaimed, as measured by Scope::Footprint.
+		/// A Scope is only counted once it has been retired, so the figure grows until every pending Scope is.
+		/// </summary>
+		/// <returns>The approximate number of pending bytes</returns>
+		size_t PendingBytes() const;
+		/// <summary>
+		/// Returns whether every pending Scope has been retired.
+		/// </summary>
+		/// <returns>True if no pending Scope is waiting to be retired, false otherwise</returns>
+		bool IsRetired() const;
+		/// <summary>
+		/// Returns whether there are no Scopes waiting to be destroyed.
+		/// </summary>
+		/// <returns>True if nothing is pending, false otherwise</returns>
+		bool IsEmpty() const;
+
+	private:
+
+		/// <summary>
+		/// Retires the next Scope waiting to be retired, or destroys the most recently queued Scope once all of them have been.
+		/// </summary>
+		/// <returns>True if a Scope was destroyed, false if one was retired</returns>
+		bool ReclaimStep();
+		/// <summary>
+		/// Retires the most recently reached Scope, counts its footprint and queues its children to be retired.
+		/// </summary>
+		void RetireOne();
+		/// <summary>
+		/// Releases the children of the most recently queued Scope into the queue and deletes it.
+		/// </summary>
+		void ReclaimOne();
+
+		/// <summary>
+		/// The Scopes waiting to be destroyed. Children are released onto the back as their parents are destroyed
+		/// </summary>
+		Vector<gsl::owner<Scope*>> mPending;
+
+		/// <summary>
+		/// The Scopes of the pending hierarchies that have not been retired yet. Nothing is destroyed while any remain, so these stay valid
+		/// </summary>
+		Vector<Scope*> mUnretired;
+
+		/// <summary>
+		/// The approximate number of bytes owned by the retired Scopes that are still pending
+		/// </summary>
+		size_t mPendingBytes{ 0 };
+
+		/// <summary>
+		/// The time each call to Reclaim may spend destroying Scopes
+		/// </summary>
+		Microseconds mFrameBudget;
+	};
+}
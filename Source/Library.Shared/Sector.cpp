@@ -7,11 +7,7 @@ namespace Library
 
 	const Vector<Signature> Sector::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{"Name"s, Datum::DatumTypes::String, true, 1, offsetof(Sector, mName)},
-			{ "Entities"s, Datum::DatumTypes::Table, false, 1, 0}
-		};
+		return AttributeReflection::Signatures<Sector>();
 	}
 
 	Sector::Sector() : Attributed(this->TypeIdClass()) {}
@@ -29,7 +25,7 @@ namespace Library
 		{
 			Scope* scopeSector = nullptr;
 			assert(GetWorld() != nullptr);
-			Datum& sectors = GetWorld()->Sectors();
+			const Datum& sectors = std::as_const(*GetWorld()).Sectors();
 
 			for (size_t i = 0; i < sectors.Size(); ++i)
 			{
@@ -60,6 +56,7 @@ namespace Library
 	void Sector::SetName(const std::string& name)
 	{
 		mName = name;
+		MarkModified("Name");
 	}
 
 	Datum& Sector::Entities()
@@ -88,6 +85,26 @@ namespace Library
 		return entity;
 	}
 
+	Vector<Entity*> Sector::CreateEntities(const std::string& className, size_t count)
+	{
+		Vector<gsl::owner<Scope*>> scopes = Factory<Scope>::CreateBatch(className, count);
+		if (scopes.Size() != count)
+		{
+			throw std::runtime_error("Can't create entities for a class that does not exist");
+		}
+
+		Vector<Entity*> entities(count);
+		for (Scope* scope : scopes)
+		{
+			assert(scope->Is(Entity::TypeIdClass()));
+			Entity* entity = static_cast<Entity*>(scope);
+			Adopt(*entity, "Entities");
+			entities.PushBack(entity);
+		}
+
+		return entities;
+	}
+
 	World* Sector::GetWorld() const
 	{
 		if (mParent == nullptr)
@@ -106,10 +123,11 @@ namespace Library
 
 	void Sector::Update(WorldState& state)
 	{
-		for (size_t i = 0; i < Entities().Size(); i++)
+		const Datum& entities = std::as_const(*this).Entities();
+		for (size_t i = 0; i < entities.Size(); i++)
 		{
-			assert(Entities().GetScope(i)->Is(Entity::TypeIdClass()));
-			Entity* entity = static_cast<Entity*>(Entities().GetScope(i));
+			assert(entities.GetScope(i)->Is(Entity::TypeIdClass()));
+			Entity* entity = static_cast<Entity*>(entities.GetScope(i));
 			state.Entity = entity;
 			entity->Update(state);
 			state.Entity = nullptr;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Attributed.h"
+#include "AttributeReflection.h"
 #include "Factory.h"
 #include "World.h"
 #include "WorldState.h"
@@ -23,6 +24,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Name", Sector, mName),
+				PrescribeInternal("Entities", Datum::DatumTypes::Table)
+			};
+		}
 
 		/// <summary>
 		/// Default constructor.
@@ -96,6 +109,14 @@ namespace Library
 		/// <returns>A pointer to the newly crated Entity within this Sector</returns>
 		/// <exception cref="std::runtime_error">Throws an exception if the user passes in a class name that doesn't exist</exception>
 		Entity* CreateEntity(const std::string& className, const std::string& instanceName);
+		/// <summary>
+		/// Creates several unnamed entities of the same class in this Sector, with one factory lookup and one allocation for all of them.
+		/// </summary>
+		/// <param name="className">The string representation of the child class of Entity that should be created</param>
+		/// <param name="count">The number of entities to create</param>
+		/// <returns>Pointers to the newly created Entities within this Sector</returns>
+		/// <exception cref="std::runtime_error">Throws an exception if the user passes in a class name that doesn't exist</exception>
+		Vector<Entity*> CreateEntities(const std::string& className, size_t count);
 
 		/// <summary>
 		/// Returns the address of the World that owns this Sector.
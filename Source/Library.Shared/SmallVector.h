@@ -0,0 +1,609 @@
+#pragma once
+
+#include <cstddef>
+#include "Vector.h"
+
+namespace Library
+{
+	/// <summary>
+	/// A dynamic array of T with the same interface as Vector that stores its first N elements inline.
+	/// The vector only allocates from the heap once it grows past N elements, so containers that are almost always small never allocate.
+	/// </summary>
+	template <typename T, size_t N, typename TReserveStrategy = DefaultReserveStrategy>
+	class SmallVector
+	{
+		static_assert(N > 0, "A SmallVector must have an inline capacity of at least one element");
+
+	public:
+		using ReserveStrategy = TReserveStrategy;
+		using value_type = T;
+
+		/// <summary>
+		/// The number of elements that can be stored without allocating from the heap
+		/// </summary>
+		static constexpr size_t InlineCapacity = N;
+
+#pragma region Iterator
+		class Iterator final
+		{
+			friend SmallVector;
+			friend class ConstIterator;
+
+		private:
+			/// <summary>
+			/// A pointer to the vector that owns this iterator
+			/// </summary>
+			SmallVector* mOwner = nullptr;
+			/// <summary>
+			/// The current index that this iterator points to
+			/// </summary>
+			size_t mIndex = 0;
+
+			/// <summary>
+			/// Constructor with the data index and vector owner
+			/// </summary>
+			/// <param name="index">The index this iterator points to</param>
+			/// <param name="owner">The owner of this iterator</param>
+			Iterator(size_t index, SmallVector& owner);
+
+		public:
+			using size_type = size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = T*;
+			using reference = T&;
+			using iterator_category = std::random_access_iterator_tag;
+
+			Iterator() = default;
+			Iterator(const Iterator&) = default;
+			Iterator(Iterator&&) noexcept = default;
+			Iterator& operator=(const Iterator&) = default;
+			Iterator& operator=(Iterator&&) noexcept = default;
+			~Iterator() = default;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>A reference to the data contained at mIndex</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is >= size </exception>
+			T& operator*() const;
+			/// <summary>
+			/// Compares two iterators for equality
+			/// </summary>
+			/// <param name="it">The iterator that this iterator is being compared to</param>
+			/// <returns>True if the iterators are the same, false otherwise</returns>
+			bool operator==(const Iterator& it) const;
+			/// <summary>
+			/// Compares two iterators for inequality
+			/// </summary>
+			/// <param name="it">The iterator that this iterator is being compared to</param>
+			/// <returns>True if the iterators are not equal, false otherwise</returns>
+			bool operator!=(const Iterator& it) const;
+			/// <summary>
+			/// Prefix increment operator. Moves the iterator to the next index in the vector
+			/// </summary>
+			/// <returns>A reference to the current iterator after it has been mutated to the next index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is greater than or equal to size</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Postfix increment operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix increment operator</param>
+			/// <returns>A copy of the current iterator before it gets mutated to the next index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is greater than or equal to size</exception>
+			Iterator operator++(int);
+			/// <summary>
+			/// Prefix decrement operator. Moves the iterator to the previous index in the vector
+			/// </summary>
+			/// <returns>A reference to the current iterator after it has been mutated to the previous index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
+			Iterator& operator--();
+			/// <summary>
+			/// Postfix decrement operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix decrement operator</param>
+			/// <returns>A copy of the current iterator before it gets mutated to the previous index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
+			Iterator operator--(int);
+			/// <summary>
+			/// Member access operator
+			/// </summary>
+			/// <returns>A pointer to the data contained at mIndex</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is >= size</exception>
+			T* operator->() const;
+			/// <summary>
+			/// Subscript operator. Accesses the element that is offset elements away from this Iterator
+			/// </summary>
+			/// <param name="offset">The distance from mIndex of the element to access</param>
+			/// <returns>A reference to the data contained at mIndex + offset</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is >= size</exception>
+			T& operator[](difference_type offset) const;
+			/// <summary>
+			/// Moves the Iterator offset elements forward. A negative offset moves it backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current Iterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			Iterator& operator+=(difference_type offset);
+			/// <summary>
+			/// Moves the Iterator offset elements backward. A negative offset moves it forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current Iterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			Iterator& operator-=(difference_type offset);
+			/// <summary>
+			/// Returns a copy of this Iterator moved offset elements forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new Iterator pointing at mIndex + offset</returns>
+			Iterator operator+(difference_type offset) const;
+			/// <summary>
+			/// Returns a copy of this Iterator moved offset elements backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new Iterator pointing at mIndex - offset</returns>
+			Iterator operator-(difference_type offset) const;
+			/// <summary>
+			/// Returns the number of elements between two Iterators of the same vector
+			/// </summary>
+			/// <param name="it">The Iterator being subtracted from this one</param>
+			/// <returns>The signed distance from it to this Iterator</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the Iterators belong to different vectors</exception>
+			difference_type operator-(const Iterator& it) const;
+			/// <summary>
+			/// Ordering comparisons. Iterators are ordered by the index they point to
+			/// </summary>
+			/// <param name="it">The Iterator that this Iterator is being compared to</param>
+			/// <returns>The result of comparing the indices of the two Iterators</returns>
+			bool operator<(const Iterator& it) const;
+			bool operator>(const Iterator& it) const;
+			bool operator<=(const Iterator& it) const;
+			bool operator>=(const Iterator& it) const;
+
+			/// <summary>
+			/// Returns a copy of the passed in Iterator moved offset elements forward
+			/// </summary>
+			friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
+		};
+#pragma endregion
+
+#pragma region ConstIterator
+		class ConstIterator final
+		{
+			friend SmallVector;
+
+		private:
+			/// <summary>
+			/// A pointer to the vector that owns this ConstIterator
+			/// </summary>
+			const SmallVector* mOwner = nullptr;
+			/// <summary>
+			/// The current index that this ConstIterator points to
+			/// </summary>
+			size_t mIndex = 0;
+
+			/// <summary>
+			/// Constructor with the data index and vector owner
+			/// </summary>
+			/// <param name="index">The index this iterator points to</param>
+			/// <param name="owner">The owner of this iterator</param>
+			ConstIterator(size_t index, const SmallVector& owner);
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = const T*;
+			using reference = const T&;
+			using iterator_category = std::random_access_iterator_tag;
+
+			ConstIterator() = default;
+			/// <summary>
+			/// Constructor that makes a new ConstIterator of a passed in Iterator
+			/// </summary>
+			/// <param name="it">The Iterator to convert</param>
+			ConstIterator(const Iterator& it);
+			ConstIterator(const ConstIterator&) = default;
+			ConstIterator(ConstIterator&&) noexcept = default;
+			ConstIterator& operator=(const ConstIterator&) = default;
+			ConstIterator& operator=(ConstIterator&&) noexcept = default;
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>A constant reference to the data contained at mIndex</returns>
+			const T& operator*() const;
+			/// <summary>
+			/// Compares two ConstIterators for equality
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>True if the ConstIterators are the same, false otherwise</returns>
+			bool operator==(const ConstIterator& it) const;
+			/// <summary>
+			/// Compares two ConstIterators for inequality
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>True if the ConstIterators are not equal, false otherwise</returns>
+			bool operator!=(const ConstIterator& it) const;
+			/// <summary>
+			/// Prefix increment operator. Moves the ConstIterator to the next index in the vector
+			/// </summary>
+			/// <returns>A reference to the current ConstIterator after it has been mutated to the next index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the ConstIterators current index is >= size</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Postfix increment operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix increment operator</param>
+			/// <returns>A copy of the current ConstIterator before it gets mutated to the next index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators current index is >= size</exception>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Prefix decrement operator. Moves the ConstIterator to the previous index in the vector
+			/// </summary>
+			/// <returns>A reference to the current ConstIterator after it has been mutated to the previous index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
+			ConstIterator& operator--();
+			/// <summary>
+			/// Postfix decrement operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix decrement operator</param>
+			/// <returns>A copy of the current ConstIterator before it gets mutated to the previous index</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
+			ConstIterator operator--(int);
+			/// <summary>
+			/// Member access operator
+			/// </summary>
+			/// <returns>A pointer to the data contained at mIndex</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is >= size</exception>
+			const T* operator->() const;
+			/// <summary>
+			/// Subscript operator. Accesses the element that is offset elements away from this ConstIterator
+			/// </summary>
+			/// <param name="offset">The distance from mIndex of the element to access</param>
+			/// <returns>A constant reference to the data contained at mIndex + offset</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is >= size</exception>
+			const T& operator[](difference_type offset) const;
+			/// <summary>
+			/// Moves the ConstIterator offset elements forward. A negative offset moves it backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current ConstIterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			ConstIterator& operator+=(difference_type offset);
+			/// <summary>
+			/// Moves the ConstIterator offset elements backward. A negative offset moves it forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current ConstIterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			ConstIterator& operator-=(difference_type offset);
+			/// <summary>
+			/// Returns a copy of this ConstIterator moved offset elements forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new ConstIterator pointing at mIndex + offset</returns>
+			ConstIterator operator+(difference_type offset) const;
+			/// <summary>
+			/// Returns a copy of this ConstIterator moved offset elements backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new ConstIterator pointing at mIndex - offset</returns>
+			ConstIterator operator-(difference_type offset) const;
+			/// <summary>
+			/// Returns the number of elements between two ConstIterators of the same vector
+			/// </summary>
+			/// <param name="it">The ConstIterator being subtracted from this one</param>
+			/// <returns>The signed distance from it to this ConstIterator</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the ConstIterators belong to different vectors</exception>
+			difference_type operator-(const ConstIterator& it) const;
+			/// <summary>
+			/// Ordering comparisons. ConstIterators are ordered by the index they point to
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>The result of comparing the indices of the two ConstIterators</returns>
+			bool operator<(const ConstIterator& it) const;
+			bool operator>(const ConstIterator& it) const;
+			bool operator<=(const ConstIterator& it) const;
+			bool operator>=(const ConstIterator& it) const;
+
+			/// <summary>
+			/// Returns a copy of the passed in ConstIterator moved offset elements forward
+			/// </summary>
+			friend ConstIterator operator+(difference_type offset, const ConstIterator& it) { return it + offset; }
+		};
+#pragma endregion
+
+#pragma region SmallVector
+
+#pragma region MemberMethods
+		/// <summary>
+		/// Default constructor that initializes the vector to empty. Only allocates if the requested capacity is larger than the inline capacity
+		/// </summary>
+		explicit SmallVector(size_t capacity = 0, ReserveStrategy reserveStrategy = ReserveStrategy());
+		/// <summary>
+		/// Constructor using an initializer list to set the starting values of the vector
+		/// </summary>
+		/// <param name="list">List of data of type T to be used in the initialization of the vector</param>
+		SmallVector(std::initializer_list<T> list);
+		/// <summary>
+		/// Copy constructor that deep copies the vector passed in
+		/// </summary>
+		/// <param name="rhs">The vector to be deep copied</param>
+		SmallVector(const SmallVector& rhs);
+		/// <summary>
+		/// Move constructor. Steals the heap block of the rhs, or moves its elements one by one if they are stored inline
+		/// </summary>
+		/// <param name="rhs">The r value vector to have its data moved</param>
+		SmallVector(SmallVector&& rhs) noexcept;
+		/// <summary>
+		/// Destructor that clears the vector and frees any allocated memory
+		/// </summary>
+		~SmallVector();
+
+		/// <summary>
+		/// Copy assignment operator that copies the entire right hand side vector into this vector
+		/// </summary>
+		/// <param name="rhs">The vector being copied</param>
+		/// <returns>A reference to this vector</returns>
+		SmallVector& operator=(const SmallVector& rhs);
+		/// <summary>
+		/// Move assignment operator
+		/// </summary>
+		/// <param name="rhs">The vector on the rhs of the assignment operator that is being moved</param>
+		/// <returns>A reference to this vector</returns>
+		SmallVector& operator=(SmallVector&& rhs) noexcept;
+#pragma endregion
+
+#pragma region ElementAccess
+		/// <summary>
+		/// Bracket operator that allows constant time access to any value in the data array
+		/// </summary>
+		/// <param name="index">The index of the value which should be returned</param>
+		/// <returns>A reference to the T element contained in the vector at the specified index</returns>
+		/// <exception cref="std::runtime_error">Thows a runtime error if the passed in index is out of the vectors range</exception>
+		T& operator[](size_t index);
+		/// <summary>
+		/// Const bracket operator that allows constant time access to any value in the data array
+		/// </summary>
+		/// <param name="index">The index of the value which should be returned</param>
+		/// <returns>A constant reference to the T element contained in the vector at the specified index</returns>
+		/// <exception cref="std::runtime_error">Thows a runtime error if the passed in index is out of the vectors range</exception>
+		const T& operator[](size_t index) const;
+
+		/// <summary>
+		/// Allows constant time access to any value in the data array
+		/// </summary>
+		/// <param name="index">The index of the value which should be returned</param>
+		/// <returns>A reference to the T element contained in the vector at the specified index</returns>
+		/// <exception cref="std::runtime_error">Thows a runtime error if the passed in index is out of the vectors range</exception>
+		T& At(size_t index);
+		/// <summary>
+		/// Allows constant time access to any value in the data array but does not allow mutation
+		/// </summary>
+		/// <param name="index">The index of the value which should be returned</param>
+		/// <returns>A constant reference to the T element contained in the vector at the specified index</returns>
+		/// <exception cref="std::runtime_error">Thows a runtime error if the passed in index is out of the vectors range</exception>
+		const T& At(size_t index) const;
+
+		/// <summary>
+		/// Gets a reference to the data contained at the first index of the vector
+		/// </summary>
+		/// <returns>Reference to data of type T</returns>
+		/// <exception cref="runtime_error">Throws a runtime error if the vector is empty</exception>
+		T& Front();
+		/// <summary>
+		/// Gets a reference to the data contained at the first index of the vector
+		/// </summary>
+		/// <returns>Const reference to data of type T</returns>
+		/// <exception cref="runtime_error">Throws a runtime error if the vector is empty</exception>
+		const T& Front() const;
+
+		/// <summary>
+		/// Gets a reference to the data contained at the last index of the vector
+		/// </summary>
+		/// <returns>Reference to data of type T</returns>
+		/// <exception cref="runtime_error">Throws a runtime error if the vector is empty</exception>
+		T& Back();
+		/// <summary>
+		/// Gets a reference to the data contained at the last index of the vector
+		/// </summary>
+		/// <returns>Const reference to data of type T</returns>
+		/// <exception cref="runtime_error">Throws a runtime error if the vector is empty</exception>
+		const T& Back() const;
+
+		/// <summary>
+		/// Finds the first index within the vector that contains the specified data and returns an Iterator pointing to it
+		/// </summary>
+		/// <param name="value">The value of the data you are looking for</param>
+		/// <param name="EqualityCompare">An equality compare functor that returns a boolean value that represents equality between two variables of type T</param>
+		/// <returns>Iterator pointing to the index that contains the specified data. Returns end() if the vector did not contain the data at all</returns>
+		Iterator Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare = DefaultEquality<T>{});
+		/// <summary>
+		/// Finds the first index within the vector that contains the specified data and returns a ConstIterator pointing to it
+		/// </summary>
+		/// <param name="value">The value of the data you are looking for</param>
+		/// <param name="EqualityCompare">An equality compare functor that returns a boolean value that represents equality between two variables of type T</param>
+		/// <returns>ConstIterator pointing to the index that contains the specified data. Returns end() if the vector did not contain the data at all</returns>
+		ConstIterator Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare = DefaultEquality<T>{}) const;
+#pragma endregion
+
+#pragma region Capacity
+		/// <summary>
+		/// Checks whether or not the vector contains any data
+		/// </summary>
+		/// <returns>True if size is equal to zero, false otherwise</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Checks whether the elements of the vector are stored in the inline buffer
+		/// </summary>
+		/// <returns>True if the vector has not spilled to the heap, false otherwise</returns>
+		bool IsInline() const;
+		/// <summary>
+		/// Allocates space for a user specified amount of data and moves over any existing data. Does not shrink the vector if the passed in capacity is smaller than the current capacity
+		/// </summary>
+		/// <param name="capacity">The new capacity the vector should have</param>
+		/// <exception cref="std::runtime_error">Throws this exception if the method is unable to allocate new memory for the vector</exception>
+		void Reserve(size_t capacity);
+		/// <summary>
+		/// Increases or decreases the size of the vector. If the size is increased it will initialize default constructed versions of T data in those spaces
+		/// </summary>
+		/// <param name="newSize">The new size that the vector should become</param>
+		/// <exception cref="std::runtime_error">Throws this exception if the method is unable to allocate new memory for the vector</exception>
+		void Resize(size_t newSize);
+		/// <summary>
+		/// Resizes the capacity of the array to be equal to the size. Moves the elements back into the inline buffer if they fit
+		/// </summary>
+		void ShrinkToFit();
+		/// <summary>
+		/// Returns a count of how many elements are in the vector
+		/// </summary>
+		/// <returns>The size of the vector</returns>
+		size_t Size() const;
+		/// <summary>
+		/// Returns the capacity of how many elements can be contained within the vector. Never less than the inline capacity
+		/// </summary>
+		/// <returns>The capacity of the vector</returns>
+		size_t Capacity() const;
+#pragma endregion
+
+#pragma region Modifiers
+		/// <summary>
+		/// Destructs the last element within the vector. Does nothing if the vector is empty
+		/// </summary>
+		void PopBack();
+		/// <summary>
+		/// Pushes the user passed data into the vector at the back of the vector. Spills to the heap once the inline capacity is exceeded
+		/// </summary>
+		/// <param name="value">The value to be added to the vector</param>
+		/// <returns>An iterator pointing to the index of the new value added to the vector</returns>
+		Iterator PushBack(const T& value);
+		/// <summary>
+		/// Pushes the R-value user passed data into the vector at the back of the vector. Spills to the heap once the inline capacity is exceeded
+		/// </summary>
+		/// <param name="value">The value to be added to the vector</param>
+		/// <returns>An iterator pointing to the index of the new value added to the vector</returns>
+		Iterator PushBack(T&& value);
+		/// <summary>
+		/// Constructs a new element in place at the back of the vector from the passed in arguments
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the index of the new value added to the vector</returns>
+		template<typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// Removes any element from the vector. Does not harm the vector if the passed in value is not contained within the vector
+		/// </summary>
+		/// <param name="value">The value of the element to be removed from the vector</param>
+		/// <returns>True if the element was removed, false otherwise</returns>
+		bool Remove(const T& value);
+		/// <summary>
+		/// Removes any element from the vector by being passed an iterator pointing to that elements index
+		/// </summary>
+		/// <param name="value">The iterator pointing at the index of the element to be removed</param>
+		/// <returns>True if the element was removed, false otherwise</returns>
+		bool Remove(const Iterator& value);
+		/// <summary>
+		/// Removes a range of elements from the start Iterator to the end Iterator
+		/// </summary>
+		/// <param name="start">An iterator pointing to the start of the range of elements to be deleted (Inclusive)</param>
+		/// <param name="end">An iterator pointing to the end of the range of elements to be deleted (Exclusive)</param>
+		/// <returns>True if the range was successfully removed, false otherwise</returns>
+		bool Remove(const Iterator& start, const Iterator& end);
+
+		/// <summary>
+		/// Destructs every element within the vector. Does not effect the capacity of the vector
+		/// </summary>
+		void Clear();
+#pragma endregion
+
+#pragma region IteratorMethods
+		/// <summary>
+		/// Creates and returns an iterator that points to the index of the first element within the vector
+		/// </summary>
+		/// <returns>Iterator that points to the first index in the vector</returns>
+		Iterator begin();
+		/// <summary>
+		/// Constant version of the begin method. Calls cbegin()
+		/// </summary>
+		/// <returns>ConstIterator that points to the first index in the vector</returns>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Creates and returns a ConstIterator that points to the first index in the vector
+		/// </summary>
+		/// <returns>ConstIterator that points to the first index in the vector</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Creates and returns an iterator whose index is the size of the vector
+		/// </summary>
+		/// <returns>Iterator that points past the last index of the vector, equal to mSize</returns>
+		Iterator end();
+		/// <summary>
+		/// Constant version of the end method. Calls cend()
+		/// </summary>
+		/// <returns>ConstIterator that points past the last index of the vector, equal to mSize</returns>
+		ConstIterator end() const;
+		/// <summary>
+		/// Creates and returns a ConstIterator whose index is the size of the vector
+		/// </summary>
+		/// <returns>ConstIterator that points past the last index of the vector, equal to mSize</returns>
+		ConstIterator cend() const;
+#pragma endregion
+
+	private:
+		/// <summary>
+		/// Returns the address of the inline buffer
+		/// </summary>
+		T* InlineData();
+		/// <summary>
+		/// Moves the elements of the vector into a block of the passed in capacity. Capacities that fit in the inline buffer
+		/// move the elements back into it, anything larger is allocated from the heap
+		/// </summary>
+		/// <param name="capacity">The capacity of the new block. Must be at least the size of the vector</param>
+		/// <exception cref="std::runtime_error">Throws this exception if the method is unable to allocate the new block</exception>
+		void Reallocate(size_t capacity);
+		/// <summary>
+		/// Increases the capacity of a full vector using the reserve strategy
+		/// </summary>
+		void Grow();
+		/// <summary>
+		/// Closes the gap left by destructed elements in the range [start, start + count) by shifting the tail of the vector down
+		/// </summary>
+		/// <param name="start">The index of the first destructed element</param>
+		/// <param name="count">The number of destructed elements</param>
+		void CloseGap(size_t start, size_t count);
+		/// <summary>
+		/// Move constructs count elements from source into uninitialized destination and destructs the sources
+		/// </summary>
+		static void Relocate(T* destination, T* source, size_t count);
+
+		/// <summary>
+		/// Storage for the first N elements of the vector
+		/// </summary>
+		alignas(T) std::byte mBuffer[sizeof(T) * N];
+		/// <summary>
+		/// The starting address of the elements. Points at mBuffer until the vector spills to the heap
+		/// </summary>
+		T* mData = InlineData();
+		/// <summary>
+		/// The number of elements in the vector
+		/// </summary>
+		size_t mSize = 0;
+		/// <summary>
+		/// The number of elements able to be contained within the vector
+		/// </summary>
+		size_t mCapacity = N;
+
+		/// <summary>
+		/// The policy used to compute the new capacity when the vector is full
+		/// </summary>
+		ReserveStrategy mReserveStrategy;
+#pragma endregion
+	};
+}
+
+#include "SmallVector.inl"
@@ -0,0 +1,835 @@
+#include "SmallVector.h"
+
+namespace Library
+{
+#pragma region Iterator
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::Iterator::Iterator(size_t index, SmallVector& owner) : mOwner(&owner), mIndex(index) {}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::Iterator::operator*() const
+	{
+		if (mOwner == nullptr || mOwner->Size() == 0)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		return (*mOwner)[mIndex];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator==(const Iterator& it) const
+	{
+		return !(*this != it);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator!=(const Iterator& it) const
+	{
+		return (mOwner != it.mOwner || mIndex != it.mIndex);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator& SmallVector<T, N, TReserveStrategy>::Iterator::operator++()
+	{
+		if (mOwner == nullptr || mIndex >= mOwner->Size())
+		{
+			throw std::runtime_error("You cannot increment the end iterator");
+		}
+
+		++mIndex;
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::Iterator::operator++(int)
+	{
+		Iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator& SmallVector<T, N, TReserveStrategy>::Iterator::operator--()
+	{
+		if (mOwner == nullptr || mIndex == 0)
+		{
+			throw std::runtime_error("You cannot decrement the begin iterator");
+		}
+
+		--mIndex;
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::Iterator::operator--(int)
+	{
+		Iterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T* SmallVector<T, N, TReserveStrategy>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::Iterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator& SmallVector<T, N, TReserveStrategy>::Iterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		difference_type index = static_cast<difference_type>(mIndex) + offset;
+		if (index < 0 || static_cast<size_t>(index) > mOwner->Size())
+		{
+			throw std::runtime_error("You cannot move an iterator outside of its vector");
+		}
+
+		mIndex = static_cast<size_t>(index);
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator& SmallVector<T, N, TReserveStrategy>::Iterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::Iterator::operator+(difference_type offset) const
+	{
+		Iterator it = *this;
+		return it += offset;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::Iterator::operator-(difference_type offset) const
+	{
+		Iterator it = *this;
+		return it -= offset;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator::difference_type SmallVector<T, N, TReserveStrategy>::Iterator::operator-(const Iterator& it) const
+	{
+		if (mOwner != it.mOwner)
+		{
+			throw std::runtime_error("These iterators belong to different vectors");
+		}
+
+		return static_cast<difference_type>(mIndex) - static_cast<difference_type>(it.mIndex);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator<(const Iterator& it) const
+	{
+		return mIndex < it.mIndex;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator>(const Iterator& it) const
+	{
+		return it < *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator<=(const Iterator& it) const
+	{
+		return !(it < *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Iterator::operator>=(const Iterator& it) const
+	{
+		return !(*this < it);
+	}
+#pragma endregion
+
+#pragma region ConstIterator
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::ConstIterator::ConstIterator(size_t index, const SmallVector& owner) : mOwner(&owner), mIndex(index) {}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::ConstIterator::ConstIterator(const Iterator& it) : mOwner(it.mOwner), mIndex(it.mIndex) {}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator*() const
+	{
+		if (mOwner == nullptr || mOwner->mSize == 0)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		return (*mOwner)[mIndex];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator==(const ConstIterator& it) const
+	{
+		return !(*this != it);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator!=(const ConstIterator& it) const
+	{
+		return (mOwner != it.mOwner || mIndex != it.mIndex);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator++()
+	{
+		if (mOwner == nullptr || mIndex >= mOwner->Size())
+		{
+			throw std::runtime_error("You cannot increment the end iterator");
+		}
+
+		++mIndex;
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::ConstIterator::operator++(int)
+	{
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator--()
+	{
+		if (mOwner == nullptr || mIndex == 0)
+		{
+			throw std::runtime_error("You cannot decrement the begin iterator");
+		}
+
+		--mIndex;
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::ConstIterator::operator--(int)
+	{
+		ConstIterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T* SmallVector<T, N, TReserveStrategy>::ConstIterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		difference_type index = static_cast<difference_type>(mIndex) + offset;
+		if (index < 0 || static_cast<size_t>(index) > mOwner->Size())
+		{
+			throw std::runtime_error("You cannot move an iterator outside of its vector");
+		}
+
+		mIndex = static_cast<size_t>(index);
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator& SmallVector<T, N, TReserveStrategy>::ConstIterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::ConstIterator::operator+(difference_type offset) const
+	{
+		ConstIterator it = *this;
+		return it += offset;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::ConstIterator::operator-(difference_type offset) const
+	{
+		ConstIterator it = *this;
+		return it -= offset;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator::difference_type SmallVector<T, N, TReserveStrategy>::ConstIterator::operator-(const ConstIterator& it) const
+	{
+		if (mOwner != it.mOwner)
+		{
+			throw std::runtime_error("These iterators belong to different vectors");
+		}
+
+		return static_cast<difference_type>(mIndex) - static_cast<difference_type>(it.mIndex);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator<(const ConstIterator& it) const
+	{
+		return mIndex < it.mIndex;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator>(const ConstIterator& it) const
+	{
+		return it < *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator<=(const ConstIterator& it) const
+	{
+		return !(it < *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::ConstIterator::operator>=(const ConstIterator& it) const
+	{
+		return !(*this < it);
+	}
+#pragma endregion
+
+#pragma region SmallVector
+
+#pragma region MemberMethods
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::SmallVector(size_t capacity, ReserveStrategy reserveStrategy) : mReserveStrategy(reserveStrategy)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::SmallVector(std::initializer_list<T> list)
+	{
+		Reserve(list.size());
+
+		for (const T& value : list)
+		{
+			PushBack(value);
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::SmallVector(const SmallVector& rhs) :
+		mReserveStrategy(rhs.mReserveStrategy)
+	{
+		Reserve(rhs.mSize);
+
+		for (size_t i = 0; i < rhs.mSize; ++i)
+		{
+			PushBack(rhs[i]);
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::SmallVector(SmallVector&& rhs) noexcept :
+		mReserveStrategy(std::move(rhs.mReserveStrategy))
+	{
+		operator=(std::move(rhs));
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>::~SmallVector()
+	{
+		Clear();
+
+		if (!IsInline())
+		{
+			free(mData);
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>& SmallVector<T, N, TReserveStrategy>::operator=(const SmallVector& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			mReserveStrategy = rhs.mReserveStrategy;
+			Reserve(rhs.mSize);
+			for (size_t i = 0; i < rhs.mSize; ++i)
+			{
+				PushBack(rhs[i]);
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline SmallVector<T, N, TReserveStrategy>& SmallVector<T, N, TReserveStrategy>::operator=(SmallVector&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			mReserveStrategy = std::move(rhs.mReserveStrategy);
+
+			if (rhs.IsInline())
+			{
+				if (!IsInline())
+				{
+					free(mData);
+					mData = InlineData();
+					mCapacity = N;
+				}
+
+				Relocate(mData, rhs.mData, rhs.mSize);
+				mSize = rhs.mSize;
+			}
+			else
+			{
+				if (!IsInline())
+				{
+					free(mData);
+				}
+
+				mData = rhs.mData;
+				mSize = rhs.mSize;
+				mCapacity = rhs.mCapacity;
+
+				rhs.mData = rhs.InlineData();
+				rhs.mCapacity = N;
+			}
+
+			rhs.mSize = 0;
+		}
+
+		return *this;
+	}
+#pragma endregion
+
+#pragma region ElementAccess
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::operator[](size_t index)
+	{
+		if (index >= mSize)
+		{
+			throw std::runtime_error("Index is outside range of vector");
+		}
+
+		return mData[index];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::operator[](size_t index) const
+	{
+		if (index >= mSize)
+		{
+			throw std::runtime_error("Index is outside range of vector");
+		}
+
+		return mData[index];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::At(size_t index)
+	{
+		return operator[](index);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::At(size_t index) const
+	{
+		return operator[](index);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::Front()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("Vector is empty");
+		}
+
+		return mData[0];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::Front() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("Vector is empty");
+		}
+
+		return mData[0];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T& SmallVector<T, N, TReserveStrategy>::Back()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("Vector is empty");
+		}
+
+		return mData[mSize - 1];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline const T& SmallVector<T, N, TReserveStrategy>::Back() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("Vector is empty");
+		}
+
+		return mData[mSize - 1];
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare)
+	{
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			if (EqualityCompare(mData[i], value))
+			{
+				return Iterator(i, *this);
+			}
+		}
+
+		return end();
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare) const
+	{
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			if (EqualityCompare(mData[i], value))
+			{
+				return ConstIterator(i, *this);
+			}
+		}
+
+		return cend();
+	}
+#pragma endregion
+
+#pragma region Capacity
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::IsInline() const
+	{
+		return mData == reinterpret_cast<const T*>(mBuffer);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline size_t SmallVector<T, N, TReserveStrategy>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline size_t SmallVector<T, N, TReserveStrategy>::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::Reserve(size_t capacity)
+	{
+		if (capacity > mCapacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	void SmallVector<T, N, TReserveStrategy>::Resize(size_t newSize)
+	{
+		if (mSize > newSize)
+		{
+			for (size_t i = newSize; i < mSize; ++i)
+			{
+				mData[i].~T();
+			}
+		}
+
+		Reserve(newSize);
+
+		for (size_t i = mSize; i < newSize; ++i)
+		{
+			new(mData + i) T();
+		}
+
+		mSize = newSize;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::ShrinkToFit()
+	{
+		if (mCapacity > mSize && !IsInline())
+		{
+			Reallocate(mSize);
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline T* SmallVector<T, N, TReserveStrategy>::InlineData()
+	{
+		return reinterpret_cast<T*>(mBuffer);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	void SmallVector<T, N, TReserveStrategy>::Reallocate(size_t capacity)
+	{
+		assert(capacity >= mSize);
+
+		if (capacity <= N)
+		{
+			if (!IsInline())
+			{
+				T* oldData = mData;
+				Relocate(InlineData(), oldData, mSize);
+				free(oldData);
+				mData = InlineData();
+			}
+
+			mCapacity = N;
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (!IsInline())
+			{
+				T* newData = reinterpret_cast<T*>(realloc(mData, capacity * sizeof(T)));
+				if (newData == nullptr)
+				{
+					throw std::runtime_error("Reserve memory allocation failed");
+				}
+
+				mData = newData;
+				mCapacity = capacity;
+				return;
+			}
+		}
+
+		T* newData = reinterpret_cast<T*>(malloc(capacity * sizeof(T)));
+		if (newData == nullptr)
+		{
+			throw std::runtime_error("Reserve memory allocation failed");
+		}
+
+		Relocate(newData, mData, mSize);
+
+		if (!IsInline())
+		{
+			free(mData);
+		}
+
+		mData = newData;
+		mCapacity = capacity;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::Grow()
+	{
+		Reserve(std::max(mCapacity + 1, static_cast<size_t>(mReserveStrategy(mSize, mCapacity))));
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::CloseGap(size_t start, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memmove(mData + start, mData + start + count, sizeof(T) * (mSize - start - count));
+		}
+		else
+		{
+			for (size_t i = start; i + count < mSize; ++i)
+			{
+				new(mData + i) T(std::move(mData[i + count]));
+				mData[i + count].~T();
+			}
+		}
+
+		mSize -= count;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::Relocate(T* destination, T* source, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (count > 0)
+			{
+				std::memcpy(destination, source, sizeof(T) * count);
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				new(destination + i) T(std::move_if_noexcept(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region Modifiers
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::PopBack()
+	{
+		if (!IsEmpty())
+		{
+			mData[--mSize].~T();
+		}
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::PushBack(const T& value)
+	{
+		return EmplaceBack(value);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::PushBack(T&& value)
+	{
+		return EmplaceBack(std::move(value));
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	template<typename... Args>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::EmplaceBack(Args&&... args)
+	{
+		if (mSize >= mCapacity)
+		{
+			Grow();
+		}
+
+		new(mData + mSize) T(std::forward<Args>(args)...);
+
+		return Iterator(mSize++, *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Remove(const T& value)
+	{
+		return Remove(Find(value));
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Remove(const Iterator& value)
+	{
+		if (value.mOwner != this)
+		{
+			throw std::runtime_error("This vector does not own the passed iterator");
+		}
+
+		if (value.mIndex >= mSize)
+		{
+			return false;
+		}
+
+		mData[value.mIndex].~T();
+		CloseGap(value.mIndex, 1);
+		return true;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline bool SmallVector<T, N, TReserveStrategy>::Remove(const Iterator& startIt, const Iterator& endIt)
+	{
+		if (startIt.mOwner != this || endIt.mOwner != this)
+		{
+			throw std::runtime_error("This vector does not own the passed iterator");
+		}
+
+		if (startIt.mIndex >= mSize)
+		{
+			return false;
+		}
+
+		for (size_t i = startIt.mIndex; i < endIt.mIndex; ++i)
+		{
+			mData[i].~T();
+		}
+
+		if (endIt.mIndex > startIt.mIndex)
+		{
+			CloseGap(startIt.mIndex, endIt.mIndex - startIt.mIndex);
+		}
+
+		return true;
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline void SmallVector<T, N, TReserveStrategy>::Clear()
+	{
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			mData[i].~T();
+		}
+		mSize = 0;
+	}
+#pragma endregion
+
+#pragma region IteratorMethods
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::begin()
+	{
+		return Iterator(0, *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::begin() const
+	{
+		return cbegin();
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::cbegin() const
+	{
+		return ConstIterator(0, *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::Iterator SmallVector<T, N, TReserveStrategy>::end()
+	{
+		return Iterator(mSize, *this);
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::end() const
+	{
+		return cend();
+	}
+
+	template<typename T, size_t N, typename TReserveStrategy>
+	inline typename SmallVector<T, N, TReserveStrategy>::ConstIterator SmallVector<T, N, TReserveStrategy>::cend() const
+	{
+		return ConstIterator(mSize, *this);
+	}
+#pragma endregion
+
+#pragma endregion
+}
@@ -64,6 +64,13 @@ namespace Library
 		/// <param name="data">The data being pushed onto the stack</param>
 		void Push(T&& data);
 
+		/// <summary>
+		/// Constructs data in place on the top of the stack.
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		template<typename... Args>
+		void Emplace(Args&&... args);
+
 		/// <summary>
 		/// Pops off the data on the top of the stack, reducing the size of the stack by 1
 		/// </summary>
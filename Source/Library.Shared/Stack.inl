@@ -49,6 +49,13 @@ namespace Library
 		mVector.PushBack(std::move(data));
 	}
 
+	template<typename T>
+	template<typename... Args>
+	inline void Stack<T>::Emplace(Args&&... args)
+	{
+		mVector.EmplaceBack(std::forward<Args>(args)...);
+	}
+
 	template<typename T>
 	inline T& Stack<T>::Pop()
 	{
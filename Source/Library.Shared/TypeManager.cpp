@@ -1,12 +1,11 @@
 #include "pch.h"
 #include "TypeManager.h"
-#include "SList.h"
 
 namespace Library
 {
-	void TypeManager::RegisterType(RTTI::IdType typeId, RTTI::IdType parentId, const Vector<Signature>& prescibedAttributes)
+	void TypeManager::RegisterType(RTTI::IdType typeId, RTTI::IdType parentId, const Vector<Signature>& prescibedAttributes, PopulateFunction populate)
 	{
-		mTypeAttributes.Insert(std::pair(typeId, TypeInfo(parentId, prescibedAttributes)));
+		mTypeAttributes.TryEmplace(typeId, parentId, prescibedAttributes, populate);
 	}
 
 	void TypeManager::UnregisterType(RTTI::IdType typeId)
@@ -14,43 +13,54 @@ namespace Library
 		mTypeAttributes.Remove(typeId);
 	}
 
-	const Vector<Signature> TypeManager::GetPrescribedSignatures(RTTI::IdType typeId)
+	const TypeManager::SignatureList TypeManager::GetPrescribedSignatures(RTTI::IdType typeId)
 	{
 		 size_t id = typeId;
 		 size_t size = 0;
-		 SList<size_t> typeIdQueue;
+		 SmallVector<size_t, 8> typeIdStack;
 
 		 do 
 		 {
-			 auto it = mTypeAttributes.Find(id);
-			 assert(it != mTypeAttributes.end());
+			 typeIdStack.PushBack(id);
 
-			 size += it->second.PrescribedAttributes.Size();
-			 typeIdQueue.PushFront(id);
-			 id = it->second.ParentId;
+			 bool found = mTypeAttributes.Visit(id, [&size, &id](const TypeInfo& info)
+			 {
+				 size += info.PrescribedAttributes.Size();
+				 id = info.ParentId;
+			 });
+
+			 if (!found)
+			 {
+				 throw std::runtime_error("The type is not registered with the TypeManager");
+			 }
 		 } while (id != Attributed::TypeIdClass());
 
-		 if (typeIdQueue.Size() == 1)
-		 {
-			 return mTypeAttributes.Find(typeId)->second.PrescribedAttributes;
-		 }
-		 else
+		 SignatureList retSignatures(size);
+		 for (size_t i = typeIdStack.Size(); i > 0; --i)
 		 {
-			 Vector<Signature> retSignatures(size);
-			 for (size_t type : typeIdQueue)
+			 mTypeAttributes.Visit(typeIdStack[i - 1], [&retSignatures](const TypeInfo& info)
 			 {
-				 Vector<Signature>& signatures = mTypeAttributes.Find(type)->second.PrescribedAttributes;
-				 
-				 assert(CheckForDuplicates(retSignatures, signatures) == false);
-				 
-				 for (Signature& signature : signatures)
+				 assert(CheckForDuplicates(retSignatures, info.PrescribedAttributes) == false);
+
+				 for (const Signature& signature : info.PrescribedAttributes)
 				 {
 					 retSignatures.PushBack(signature);
 				 }
-			 }
-
-			 return retSignatures;
+			 });
 		 }
+
+		 return retSignatures;
+	}
+
+	TypeManager::PopulateFunction TypeManager::GetPopulateFunction(RTTI::IdType typeId)
+	{
+		PopulateFunction populate = nullptr;
+		mTypeAttributes.Visit(typeId, [&populate](const TypeInfo& info)
+		{
+			populate = info.Populate;
+		});
+
+		return populate;
 	}
 
 	void TypeManager::Clear()
@@ -58,13 +68,13 @@ namespace Library
 		mTypeAttributes.Clear();
 	}
 
-	bool TypeManager::CheckForDuplicates(const Vector<Signature>& checkFor, const Vector<Signature>& checkWith)
+	bool TypeManager::CheckForDuplicates(const SignatureList& checkFor, const SignatureList& checkWith)
 	{
 		bool ret = false;
 
-		for (Signature signature : checkWith)
+		for (const Signature& signature : checkWith)
 		{
-			for (Signature otherSig : checkFor)
+			for (const Signature& otherSig : checkFor)
 			{
 				ret |= signature.Name == otherSig.Name;
 			}
@@ -73,8 +83,14 @@ namespace Library
 		return ret;
 	}
 
-	TypeManager::TypeInfo::TypeInfo(RTTI::IdType parentId, const Vector<Signature>& prescribedAttributes) :
-		ParentId(parentId), PrescribedAttributes(prescribedAttributes) {}
+	TypeManager::TypeInfo::TypeInfo(RTTI::IdType parentId, const Vector<Signature>& prescribedAttributes, PopulateFunction populate) :
+		ParentId(parentId), PrescribedAttributes(prescribedAttributes.Size()), Populate(populate)
+	{
+		for (const Signature& signature : prescribedAttributes)
+		{
+			PrescribedAttributes.PushBack(signature);
+		}
+	}
 
 	Signature::Signature(const std::string& name, Datum::DatumTypes type, bool isExternal, size_t size, size_t offset) : 
 		Name(name), Type(type), IsExternal(isExternal), Size(size), Offset(offset) {}
@@ -1,11 +1,14 @@
 #pragma once
 
-#include "HashMap.h"
+#include "ConcurrentHashMap.h"
 #include "Vector.h"
+#include "SmallVector.h"
 #include "Attributed.h"
 
 namespace Library
 {
+	class Attributed;
+
 	/// <summary>
 	/// Contains the information necessary to build an attribute for a scope. Used to designate prescribed attributes for a type.
 	/// </summary>
@@ -28,16 +31,26 @@ namespace Library
 	class TypeManager
 	{
 	public:
+		/// <summary>
+		/// The container used for the signatures of a type. Most types prescribe only a handful of attributes, so these are stored inline
+		/// </summary>
+		using SignatureList = SmallVector<Signature, 8>;
+
+		/// <summary>
+		/// A function that appends the prescribed attributes of a type and its parents to an instance under construction, in place of walking the signatures
+		/// </summary>
+		using PopulateFunction = void(*)(Attributed&);
 
 		/// <summary>
 		/// Contains the parent ID and vector of prescribed attributes associated with a type ID
 		/// </summary>
 		struct TypeInfo
 		{
-			TypeInfo(RTTI::IdType parentId, const Vector<Signature>& prescribedAttributes);
+			TypeInfo(RTTI::IdType parentId, const Vector<Signature>& prescribedAttributes, PopulateFunction populate);
 
 			size_t ParentId;
-			Vector<Signature> PrescribedAttributes;
+			SignatureList PrescribedAttributes;
+			PopulateFunction Populate;
 		};
 
 		TypeManager() = delete;
@@ -52,7 +65,8 @@ namespace Library
 		/// </summary>
 		/// <param name="typeId">The RTTI TypeIdClass used to associate a class type with its prescribed attributes</param>
 		/// <param name="prescibedAttributes">The Vector of Attribute signatures to be associated with the passed in typeId</param>
-		static void RegisterType(RTTI::IdType typeId, RTTI::IdType parentId, const Vector<Signature>& prescibedAttributes);
+		/// <param name="populate">The function that populates instances of the type, or nullptr to populate them from the signatures. AttributeReflection generates one</param>
+		static void RegisterType(RTTI::IdType typeId, RTTI::IdType parentId, const Vector<Signature>& prescibedAttributes, PopulateFunction populate = nullptr);
 
 		/// <summary>
 		/// Unregisters a class Type with the manager by removing the Vector of prescribed attribute signatures associated with the class from the manager
@@ -64,9 +78,16 @@ namespace Library
 		/// Returns the Vector of Attribute signatures associated with the given typeId
 		/// </summary>
 		/// <param name="typeId">The typeId whose corresponding list of </param>
-		/// <returns>A const reference to the Vector of Attribute signatures associated with the typeId</returns>
+		/// <returns>The list of Attribute signatures associated with the typeId and all of its parent types</returns>
 		/// <exception cref="std::runtime_error">Throws an exception if there is no attributes registered with that type or the type has a duplicate signature as one of its parent types</exception>
-		static const Vector<Signature> GetPrescribedSignatures(RTTI::IdType typeId);
+		static const SignatureList GetPrescribedSignatures(RTTI::IdType typeId);
+
+		/// <summary>
+		/// Returns the function registered to populate instances of the type
+		/// </summary>
+		/// <param name="typeId">The typeId of the type</param>
+		/// <returns>The populate function of the type, or nullptr if it has none or is not registered</returns>
+		static PopulateFunction GetPopulateFunction(RTTI::IdType typeId);
 
 		/// <summary>
 		/// Clears all stored type data contained within the manager
@@ -81,12 +102,13 @@ namespace Library
 		/// <param name="checkFor">The Vector of signatures being checked for duplicates</param>
 		/// <param name="checkWith">The Vector of signatures being checked for duplicates against the checkFor Vector</param>
 		/// <returns>True if there were duplicate signatures between the Vectors, false otherwise</returns>
-		static bool CheckForDuplicates(const Vector<Signature>& checkFor, const Vector<Signature>& checkWith);
+		static bool CheckForDuplicates(const SignatureList& checkFor, const SignatureList& checkWith);
 
 		/// <summary>
-		/// Static HashMap that maps class typeId's to Vectors that contain signatures of that types prescribed attributes
+		/// Static map that maps class typeId's to Vectors that contain signatures of that types prescribed attributes.
+		/// Attributed objects can be constructed on worker threads, so the map is sharded and locked per shard
 		/// </summary>
-		inline static HashMap<RTTI::IdType, TypeInfo> mTypeAttributes;
+		inline static ConcurrentHashMap<RTTI::IdType, TypeInfo> mTypeAttributes;
 	};
 }
 
@@ -0,0 +1,425 @@
+#pragma once
+
+#include <functional>
+#include <cstddef>
+#include <iterator>
+#include "DefaultEquality.h"
+
+namespace Library
+{
+	/// <summary>
+	/// A singly linked list that packs up to ElementsPerNode elements into each node. Walking the list touches one cache line per
+	/// node instead of one per element, and insertions only allocate when a node fills up.
+	/// Unlike SList, inserting or removing an element may move the other elements of its node, so references and iterators into the list
+	/// are invalidated by any insertion or removal.
+	/// </summary>
+	template <typename T, size_t ElementsPerNode = 8>
+	class UnrolledSList
+	{
+		static_assert(ElementsPerNode > 0, "An UnrolledSList must store at least one element per node");
+
+	private:
+#pragma region Node
+		/// <summary>
+		/// A node of the list. Stores up to ElementsPerNode elements contiguously
+		/// </summary>
+		struct Node final
+		{
+			/// <summary>
+			/// Pointer to the next Node in the list
+			/// </summary>
+			Node* Next = nullptr;
+			/// <summary>
+			/// Number of elements constructed in the node
+			/// </summary>
+			size_t Count = 0;
+			/// <summary>
+			/// Storage for the elements of the node
+			/// </summary>
+			alignas(T) std::byte Storage[sizeof(T) * ElementsPerNode];
+
+			/// <summary>
+			/// Returns the address of the first element of the node
+			/// </summary>
+			T* Data();
+			/// <summary>
+			/// Returns the address of the first element of the node
+			/// </summary>
+			const T* Data() const;
+			/// <summary>
+			/// Checks whether the node has room for another element
+			/// </summary>
+			bool IsFull() const;
+		};
+#pragma endregion Node
+
+	public:
+#pragma region Iterator
+		class Iterator final
+		{
+			friend UnrolledSList;
+			friend class ConstIterator;
+
+		private:
+			/// <summary>
+			/// A pointer to the list that owns this iterator
+			/// </summary>
+			const UnrolledSList* mOwner = nullptr;
+			/// <summary>
+			/// The current node that this iterator points to
+			/// </summary>
+			Node* mNode = nullptr;
+			/// <summary>
+			/// The index of the element within mNode that this iterator points to
+			/// </summary>
+			size_t mIndex = 0;
+
+			/// <summary>
+			/// Constructor with the node, element index and list owner
+			/// </summary>
+			Iterator(Node* node, size_t index, const UnrolledSList* owner);
+
+		public:
+			using size_type = size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = T*;
+			using reference = T&;
+			using iterator_category = std::forward_iterator_tag;
+
+			Iterator() = default;
+			Iterator(const Iterator&) = default;
+			Iterator(Iterator&&) noexcept = default;
+			Iterator& operator=(const Iterator&) = default;
+			Iterator& operator=(Iterator&&) noexcept = default;
+			~Iterator() = default;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>A reference to the element this iterator points to</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			T& operator*() const;
+			/// <summary>
+			/// Compares two iterators for equality
+			/// </summary>
+			/// <param name="it">The iterator that this iterator is being compared to</param>
+			/// <returns>True if the iterators are the same, false otherwise</returns>
+			bool operator==(const Iterator& it) const;
+			/// <summary>
+			/// Compares two iterators for inequality
+			/// </summary>
+			/// <param name="it">The iterator that this iterator is being compared to</param>
+			/// <returns>True if the iterators are not equal, false otherwise</returns>
+			bool operator!=(const Iterator& it) const;
+			/// <summary>
+			/// Prefix increment operator. Moves the iterator to the next element in the list
+			/// </summary>
+			/// <returns>A reference to the current iterator after it has been mutated to the next element</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Postfix increment operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix increment operator</param>
+			/// <returns>A copy of the current iterator before it gets mutated to the next element</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			Iterator operator++(int);
+		};
+#pragma endregion
+
+#pragma region ConstIterator
+		class ConstIterator final
+		{
+			friend UnrolledSList;
+
+		private:
+			/// <summary>
+			/// A pointer to the list that owns this ConstIterator
+			/// </summary>
+			const UnrolledSList* mOwner = nullptr;
+			/// <summary>
+			/// The current node that this ConstIterator points to
+			/// </summary>
+			const Node* mNode = nullptr;
+			/// <summary>
+			/// The index of the element within mNode that this ConstIterator points to
+			/// </summary>
+			size_t mIndex = 0;
+
+			/// <summary>
+			/// Constructor with the node, element index and list owner
+			/// </summary>
+			ConstIterator(const Node* node, size_t index, const UnrolledSList* owner);
+
+		public:
+			using size_type = size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = const T*;
+			using reference = const T&;
+			using iterator_category = std::forward_iterator_tag;
+
+			ConstIterator() = default;
+			/// <summary>
+			/// Constructor that makes a new ConstIterator of a passed in Iterator
+			/// </summary>
+			/// <param name="it">The Iterator to convert</param>
+			ConstIterator(const Iterator& it);
+			ConstIterator(const ConstIterator&) = default;
+			ConstIterator(ConstIterator&&) noexcept = default;
+			ConstIterator& operator=(const ConstIterator&) = default;
+			ConstIterator& operator=(ConstIterator&&) noexcept = default;
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>A constant reference to the element this iterator points to</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			const T& operator*() const;
+			/// <summary>
+			/// Compares two ConstIterators for equality
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>True if the ConstIterators are the same, false otherwise</returns>
+			bool operator==(const ConstIterator& it) const;
+			/// <summary>
+			/// Compares two ConstIterators for inequality
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>True if the ConstIterators are not equal, false otherwise</returns>
+			bool operator!=(const ConstIterator& it) const;
+			/// <summary>
+			/// Prefix increment operator. Moves the ConstIterator to the next element in the list
+			/// </summary>
+			/// <returns>A reference to the current ConstIterator after it has been mutated to the next element</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Postfix increment operator
+			/// </summary>
+			/// <param>int used to differentiate this operator from the prefix increment operator</param>
+			/// <returns>A copy of the current ConstIterator before it gets mutated to the next element</returns>
+			/// <exception cref="std::runtime_error">Throws exception if this is the end iterator</exception>
+			ConstIterator operator++(int);
+		};
+#pragma endregion
+
+		/// <summary>
+		/// Default constructor that creates an empty list
+		/// </summary>
+		UnrolledSList() = default;
+		/// <summary>
+		/// Copy constructor that deep copies the passed in list
+		/// </summary>
+		/// <param name="rhs">The list to be copied</param>
+		UnrolledSList(const UnrolledSList& rhs);
+		/// <summary>
+		/// Move constructor
+		/// </summary>
+		/// <param name="rhs">The list being moved</param>
+		UnrolledSList(UnrolledSList&& rhs) noexcept;
+		/// <summary>
+		/// Destructor that destructs every element and frees every node
+		/// </summary>
+		~UnrolledSList();
+
+		/// <summary>
+		/// Copy assignment operator that deep copies the passed in list
+		/// </summary>
+		/// <param name="rhs">The list to be copied</param>
+		/// <returns>A reference to this list</returns>
+		UnrolledSList& operator=(const UnrolledSList& rhs);
+		/// <summary>
+		/// Move assignment operator
+		/// </summary>
+		/// <param name="rhs">The list being moved</param>
+		/// <returns>A reference to this list</returns>
+		UnrolledSList& operator=(UnrolledSList&& rhs) noexcept;
+
+		/// <summary>
+		/// Checks whether or not the list contains any elements
+		/// </summary>
+		/// <returns>True if the list is empty, false otherwise</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Returns the number of elements in the list
+		/// </summary>
+		/// <returns>The number of elements in the list</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Returns the first element of the list
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws exception if the list is empty</exception>
+		T& Front();
+		/// <summary>
+		/// Returns the first element of the list
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws exception if the list is empty</exception>
+		const T& Front() const;
+		/// <summary>
+		/// Returns the last element of the list
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws exception if the list is empty</exception>
+		T& Back();
+		/// <summary>
+		/// Returns the last element of the list
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws exception if the list is empty</exception>
+		const T& Back() const;
+
+		/// <summary>
+		/// Adds an element to the front of the list. Only allocates a node if the front node is full
+		/// </summary>
+		/// <param name="data">The element to add</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		Iterator PushFront(const T& data);
+		/// <summary>
+		/// Moves an element to the front of the list. Only allocates a node if the front node is full
+		/// </summary>
+		/// <param name="data">The element to add</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		Iterator PushFront(T&& data);
+		/// <summary>
+		/// Adds an element to the back of the list. Only allocates a node if the back node is full
+		/// </summary>
+		/// <param name="data">The element to add</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		Iterator PushBack(const T& data);
+		/// <summary>
+		/// Moves an element to the back of the list. Only allocates a node if the back node is full
+		/// </summary>
+		/// <param name="data">The element to add</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		Iterator PushBack(T&& data);
+		/// <summary>
+		/// Constructs an element at the front of the list from the passed in arguments
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		template<typename... Args>
+		Iterator EmplaceFront(Args&&... args);
+		/// <summary>
+		/// Constructs an element at the back of the list from the passed in arguments
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the new element</returns>
+		template<typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+		/// <summary>
+		/// Removes the first element of the list. Does nothing if the list is empty
+		/// </summary>
+		void PopFront();
+		/// <summary>
+		/// Removes the last element of the list. Does nothing if the list is empty
+		/// </summary>
+		void PopBack();
+		/// <summary>
+		/// Removes every element of the list and frees every node
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Creates and returns an iterator that points to the first element of the list
+		/// </summary>
+		Iterator begin();
+		/// <summary>
+		/// Constant version of the begin method. Calls cbegin()
+		/// </summary>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Creates and returns a ConstIterator that points to the first element of the list
+		/// </summary>
+		ConstIterator cbegin() const;
+		/// <summary>
+		/// Creates and returns an iterator that points past the last element of the list
+		/// </summary>
+		Iterator end();
+		/// <summary>
+		/// Constant version of the end method. Calls cend()
+		/// </summary>
+		ConstIterator end() const;
+		/// <summary>
+		/// Creates and returns a ConstIterator that points past the last element of the list
+		/// </summary>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Inserts a new element after the element pointed at by the passed in Iterator. Splits the node in two if it is full
+		/// </summary>
+		/// <param name="data">The element to insert</param>
+		/// <param name="it">Iterator to have the new element inserted after. The end iterator appends to the list</param>
+		/// <returns>Iterator pointing to the new element</returns>
+		/// <exception cref="std::runtime_error">Throws exception if the iterator does not belong to this list</exception>
+		Iterator InsertAfter(const T& data, const Iterator& it);
+		/// <summary>
+		/// Finds the first element of the list equal to the passed in value
+		/// </summary>
+		/// <param name="value">The value being searched for</param>
+		/// <param name="EqualityCompare">An equality compare functor that returns a boolean value that represents equality between two variables of type T</param>
+		/// <returns>Iterator pointing to the found element. Returns end() if the list did not contain the value</returns>
+		Iterator Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare = DefaultEquality<T>{});
+		/// <summary>
+		/// Finds the first element of the list equal to the passed in value
+		/// </summary>
+		/// <param name="value">The value being searched for</param>
+		/// <param name="EqualityCompare">An equality compare functor that returns a boolean value that represents equality between two variables of type T</param>
+		/// <returns>ConstIterator pointing to the found element. Returns cend() if the list did not contain the value</returns>
+		ConstIterator Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare = DefaultEquality<T>{}) const;
+		/// <summary>
+		/// Removes the first element of the list equal to the passed in value
+		/// </summary>
+		/// <param name="value">The value to remove</param>
+		/// <returns>True if an element was removed, false otherwise</returns>
+		bool Remove(const T& value);
+		/// <summary>
+		/// Removes the element pointed at by the passed in iterator. Frees its node if the node becomes empty
+		/// </summary>
+		/// <param name="it">Iterator pointing to the element to remove</param>
+		/// <returns>True if the element was removed, false otherwise</returns>
+		/// <exception cref="std::runtime_error">Throws exception if the iterator does not belong to this list</exception>
+		bool Remove(const Iterator& it);
+
+	private:
+		/// <summary>
+		/// Allocates an empty node and links it into the list after the passed in node, or at the front if previous is nullptr
+		/// </summary>
+		/// <param name="previous">The node the new node follows</param>
+		/// <returns>A pointer to the new node</returns>
+		Node* InsertNode(Node* previous);
+		/// <summary>
+		/// Unlinks an empty node from the list and frees it
+		/// </summary>
+		/// <param name="node">The empty node to remove</param>
+		void RemoveNode(Node* node);
+		/// <summary>
+		/// Moves the elements of a node at and after index one slot towards the back, leaving index unconstructed
+		/// </summary>
+		static void ShiftBack(Node* node, size_t index);
+		/// <summary>
+		/// Moves the elements of a node after index one slot towards the front. The element at index must already be destructed
+		/// </summary>
+		static void ShiftFront(Node* node, size_t index);
+		/// <summary>
+		/// Constructs value at index of a node with room for it, moving the following elements back
+		/// </summary>
+		static void InsertInto(Node* node, size_t index, T&& value);
+
+		/// <summary>
+		/// Number of elements within the list
+		/// </summary>
+		size_t mSize = 0;
+		/// <summary>
+		/// Pointer to the front node of the list
+		/// </summary>
+		Node* mFront = nullptr;
+		/// <summary>
+		/// Pointer to the back node of the list
+		/// </summary>
+		Node* mBack = nullptr;
+	};
+}
+
+#include "UnrolledSList.inl"
@@ -0,0 +1,564 @@
+#include <stdexcept>
+#include "UnrolledSList.h"
+
+namespace Library
+{
+#pragma region Node
+	template<typename T, size_t ElementsPerNode>
+	inline T* UnrolledSList<T, ElementsPerNode>::Node::Data()
+	{
+		return reinterpret_cast<T*>(Storage);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline const T* UnrolledSList<T, ElementsPerNode>::Node::Data() const
+	{
+		return reinterpret_cast<const T*>(Storage);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::Node::IsFull() const
+	{
+		return Count == ElementsPerNode;
+	}
+#pragma endregion
+
+#pragma region Iterator
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>::Iterator::Iterator(Node* node, size_t index, const UnrolledSList* owner) : mOwner(owner), mNode(node), mIndex(index) {}
+
+	template<typename T, size_t ElementsPerNode>
+	inline T& UnrolledSList<T, ElementsPerNode>::Iterator::operator*() const
+	{
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("This iterators node is the end node");
+		}
+
+		return mNode->Data()[mIndex];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::Iterator::operator==(const Iterator& it) const
+	{
+		return !(*this != it);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::Iterator::operator!=(const Iterator& it) const
+	{
+		return (mOwner != it.mOwner || mNode != it.mNode || mIndex != it.mIndex);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator& UnrolledSList<T, ElementsPerNode>::Iterator::operator++()
+	{
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("You cannot increment the end iterator");
+		}
+
+		if (++mIndex == mNode->Count)
+		{
+			mNode = mNode->Next;
+			mIndex = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::Iterator::operator++(int)
+	{
+		Iterator it = *this;
+		operator++();
+		return it;
+	}
+#pragma endregion
+
+#pragma region ConstIterator
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>::ConstIterator::ConstIterator(const Node* node, size_t index, const UnrolledSList* owner) : mOwner(owner), mNode(node), mIndex(index) {}
+
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>::ConstIterator::ConstIterator(const Iterator& it) : mOwner(it.mOwner), mNode(it.mNode), mIndex(it.mIndex) {}
+
+	template<typename T, size_t ElementsPerNode>
+	inline const T& UnrolledSList<T, ElementsPerNode>::ConstIterator::operator*() const
+	{
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("This iterators node is the end node");
+		}
+
+		return mNode->Data()[mIndex];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::ConstIterator::operator==(const ConstIterator& it) const
+	{
+		return !(*this != it);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::ConstIterator::operator!=(const ConstIterator& it) const
+	{
+		return (mOwner != it.mOwner || mNode != it.mNode || mIndex != it.mIndex);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator& UnrolledSList<T, ElementsPerNode>::ConstIterator::operator++()
+	{
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("You cannot increment the end iterator");
+		}
+
+		if (++mIndex == mNode->Count)
+		{
+			mNode = mNode->Next;
+			mIndex = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::ConstIterator::operator++(int)
+	{
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+#pragma endregion
+
+#pragma region UnrolledSList
+	template<typename T, size_t ElementsPerNode>
+	UnrolledSList<T, ElementsPerNode>::UnrolledSList(const UnrolledSList& rhs)
+	{
+		for (const T& value : rhs)
+		{
+			PushBack(value);
+		}
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>::UnrolledSList(UnrolledSList&& rhs) noexcept :
+		mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack)
+	{
+		rhs.mSize = 0;
+		rhs.mFront = nullptr;
+		rhs.mBack = nullptr;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>::~UnrolledSList()
+	{
+		Clear();
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	UnrolledSList<T, ElementsPerNode>& UnrolledSList<T, ElementsPerNode>::operator=(const UnrolledSList& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			for (const T& value : rhs)
+			{
+				PushBack(value);
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline UnrolledSList<T, ElementsPerNode>& UnrolledSList<T, ElementsPerNode>::operator=(UnrolledSList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			mSize = rhs.mSize;
+			mFront = rhs.mFront;
+			mBack = rhs.mBack;
+
+			rhs.mSize = 0;
+			rhs.mFront = nullptr;
+			rhs.mBack = nullptr;
+		}
+
+		return *this;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline size_t UnrolledSList<T, ElementsPerNode>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline T& UnrolledSList<T, ElementsPerNode>::Front()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		return mFront->Data()[0];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline const T& UnrolledSList<T, ElementsPerNode>::Front() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		return mFront->Data()[0];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline T& UnrolledSList<T, ElementsPerNode>::Back()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		return mBack->Data()[mBack->Count - 1];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline const T& UnrolledSList<T, ElementsPerNode>::Back() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		return mBack->Data()[mBack->Count - 1];
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::PushFront(const T& data)
+	{
+		return EmplaceFront(data);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::PushFront(T&& data)
+	{
+		return EmplaceFront(std::move(data));
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::PushBack(const T& data)
+	{
+		return EmplaceBack(data);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::PushBack(T&& data)
+	{
+		return EmplaceBack(std::move(data));
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	template<typename... Args>
+	typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::EmplaceFront(Args&&... args)
+	{
+		T value(std::forward<Args>(args)...);
+
+		if (mFront == nullptr || mFront->IsFull())
+		{
+			InsertNode(nullptr);
+		}
+
+		InsertInto(mFront, 0, std::move(value));
+		++mSize;
+
+		return Iterator(mFront, 0, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	template<typename... Args>
+	typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::EmplaceBack(Args&&... args)
+	{
+		T value(std::forward<Args>(args)...);
+
+		if (mBack == nullptr || mBack->IsFull())
+		{
+			InsertNode(mBack);
+		}
+
+		new(mBack->Data() + mBack->Count) T(std::move(value));
+		++mSize;
+
+		return Iterator(mBack, mBack->Count++, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	void UnrolledSList<T, ElementsPerNode>::PopFront()
+	{
+		if (!IsEmpty())
+		{
+			Remove(begin());
+		}
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	void UnrolledSList<T, ElementsPerNode>::PopBack()
+	{
+		if (!IsEmpty())
+		{
+			Remove(Iterator(mBack, mBack->Count - 1, this));
+		}
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	void UnrolledSList<T, ElementsPerNode>::Clear()
+	{
+		Node* node = mFront;
+		while (node != nullptr)
+		{
+			for (size_t i = 0; i < node->Count; ++i)
+			{
+				node->Data()[i].~T();
+			}
+
+			Node* next = node->Next;
+			delete node;
+			node = next;
+		}
+
+		mFront = mBack = nullptr;
+		mSize = 0;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::begin()
+	{
+		return Iterator(mFront, 0, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::begin() const
+	{
+		return cbegin();
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::cbegin() const
+	{
+		return ConstIterator(mFront, 0, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::end()
+	{
+		return Iterator(nullptr, 0, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::end() const
+	{
+		return cend();
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::cend() const
+	{
+		return ConstIterator(nullptr, 0, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::InsertAfter(const T& data, const Iterator& it)
+	{
+		if (it.mOwner != this)
+		{
+			throw std::runtime_error("This list does not own the passed iterator");
+		}
+
+		if (it.mNode == nullptr || (it.mNode == mBack && it.mIndex == mBack->Count - 1))
+		{
+			return PushBack(data);
+		}
+
+		T value(data);
+		Node* node = it.mNode;
+		size_t index = it.mIndex + 1;
+
+		if (node->IsFull())
+		{
+			const size_t split = (ElementsPerNode + 1) / 2;
+			Node* newNode = InsertNode(node);
+
+			for (size_t i = split; i < node->Count; ++i)
+			{
+				new(newNode->Data() + newNode->Count++) T(std::move(node->Data()[i]));
+				node->Data()[i].~T();
+			}
+			node->Count = split;
+
+			if (index > split || node->IsFull())
+			{
+				node = newNode;
+				index -= split;
+			}
+		}
+
+		InsertInto(node, index, std::move(value));
+		++mSize;
+
+		return Iterator(node, index, this);
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	typename UnrolledSList<T, ElementsPerNode>::Iterator UnrolledSList<T, ElementsPerNode>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare)
+	{
+		for (Node* node = mFront; node != nullptr; node = node->Next)
+		{
+			for (size_t i = 0; i < node->Count; ++i)
+			{
+				if (EqualityCompare(node->Data()[i], value))
+				{
+					return Iterator(node, i, this);
+				}
+			}
+		}
+
+		return end();
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	typename UnrolledSList<T, ElementsPerNode>::ConstIterator UnrolledSList<T, ElementsPerNode>::Find(const T& value, std::function<bool(const T& lhs, const T& rhs)> EqualityCompare) const
+	{
+		return ConstIterator(const_cast<UnrolledSList*>(this)->Find(value, EqualityCompare));
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline bool UnrolledSList<T, ElementsPerNode>::Remove(const T& value)
+	{
+		return Remove(Find(value));
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	bool UnrolledSList<T, ElementsPerNode>::Remove(const Iterator& it)
+	{
+		if (it.mOwner != this)
+		{
+			throw std::runtime_error("This list does not own the passed iterator");
+		}
+
+		if (it.mNode == nullptr)
+		{
+			return false;
+		}
+
+		Node* node = it.mNode;
+		node->Data()[it.mIndex].~T();
+		ShiftFront(node, it.mIndex);
+		--mSize;
+
+		if (node->Count == 0)
+		{
+			RemoveNode(node);
+		}
+
+		return true;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	typename UnrolledSList<T, ElementsPerNode>::Node* UnrolledSList<T, ElementsPerNode>::InsertNode(Node* previous)
+	{
+		Node* node = new Node();
+
+		if (previous == nullptr)
+		{
+			node->Next = mFront;
+			mFront = node;
+		}
+		else
+		{
+			node->Next = previous->Next;
+			previous->Next = node;
+		}
+
+		if (node->Next == nullptr)
+		{
+			mBack = node;
+		}
+
+		return node;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	void UnrolledSList<T, ElementsPerNode>::RemoveNode(Node* node)
+	{
+		Node* previous = nullptr;
+		if (node != mFront)
+		{
+			previous = mFront;
+			while (previous->Next != node)
+			{
+				previous = previous->Next;
+			}
+		}
+
+		if (previous == nullptr)
+		{
+			mFront = node->Next;
+		}
+		else
+		{
+			previous->Next = node->Next;
+		}
+
+		if (node == mBack)
+		{
+			mBack = previous;
+		}
+
+		delete node;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline void UnrolledSList<T, ElementsPerNode>::ShiftBack(Node* node, size_t index)
+	{
+		for (size_t i = node->Count; i > index; --i)
+		{
+			new(node->Data() + i) T(std::move(node->Data()[i - 1]));
+			node->Data()[i - 1].~T();
+		}
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline void UnrolledSList<T, ElementsPerNode>::ShiftFront(Node* node, size_t index)
+	{
+		for (size_t i = index + 1; i < node->Count; ++i)
+		{
+			new(node->Data() + i - 1) T(std::move(node->Data()[i]));
+			node->Data()[i].~T();
+		}
+
+		--node->Count;
+	}
+
+	template<typename T, size_t ElementsPerNode>
+	inline void UnrolledSList<T, ElementsPerNode>::InsertInto(Node* node, size_t index, T&& value)
+	{
+		ShiftBack(node, index);
+		new(node->Data() + index) T(std::move(value));
+		++node->Count;
+	}
+#pragma endregion
+}
@@ -5,15 +5,48 @@
 #include <algorithm>
 #include <iterator>
 #include <cassert>
+#include <type_traits>
 #include "DefaultEquality.h"
 
 namespace Library
 {
+	/// <summary>
+	/// Trait that marks whether a type can be relocated to a new address with a raw memory copy (realloc or memcpy)
+	/// instead of a move construction followed by a destruction. Defaults to trivially copyable types.
+	/// Specialize this for types whose moved bytes stay valid, such as types that hold only owning pointers.
+	/// </summary>
 	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	template <typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+
+	/// <summary>
+	/// The default reserve strategy for a Vector. Increases the capacity by a factor of 1.5
+	/// </summary>
+	struct DefaultReserveStrategy final
+	{
+		/// <summary>
+		/// Returns a new capacity that is increased by a factor of 1.5
+		/// </summary>
+		/// <param>Empty param not used for the default reserve strategy</param>
+		/// <param name="capacity">The current capacity of the vector</param>
+		/// <returns>A size_t of the capacity multiplied by a factor of 1.5</returns>
+		size_t operator()(const size_t, const size_t capacity) const
+		{
+			return static_cast<size_t>(capacity * 1.5);
+		}
+	};
+
+	/// <summary>
+	/// A dynamic array of T. The growth policy is a template parameter so it is inlined into PushBack.
+	/// Any functor callable as size_t(size_t size, size_t capacity) may be used as the policy.
+	/// </summary>
+	template <typename T, typename TReserveStrategy = DefaultReserveStrategy>
 	class Vector
 	{
 	public:
-		using ReserveStrategy = typename std::function<size_t(const size_t, const size_t)>;
+		using ReserveStrategy = TReserveStrategy;
 		using value_type = T;
 
 #pragma region Iterator
@@ -44,7 +77,7 @@ namespace Library
 			using difference_type = std::ptrdiff_t;
 			using value_type = T;
 			using pointer = T*;
-			using reference = T;
+			using reference = T&;
 			using iterator_category = std::random_access_iterator_tag;
 
 			/// <summary>
@@ -123,6 +156,66 @@ namespace Library
 			/// <returns>A copy of the current iterator before it gets mutated to the previous index</returns>
 			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
 			Iterator operator--(int);
+			/// <summary>
+			/// Member access operator
+			/// </summary>
+			/// <returns>A pointer to the data contained at mIndex</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is >= size</exception>
+			T* operator->() const;
+			/// <summary>
+			/// Subscript operator. Accesses the element that is offset elements away from this Iterator
+			/// </summary>
+			/// <param name="offset">The distance from mIndex of the element to access</param>
+			/// <returns>A reference to the data contained at mIndex + offset</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is >= size</exception>
+			T& operator[](difference_type offset) const;
+			/// <summary>
+			/// Moves the Iterator offset elements forward. A negative offset moves it backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current Iterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			Iterator& operator+=(difference_type offset);
+			/// <summary>
+			/// Moves the Iterator offset elements backward. A negative offset moves it forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current Iterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			Iterator& operator-=(difference_type offset);
+			/// <summary>
+			/// Returns a copy of this Iterator moved offset elements forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new Iterator pointing at mIndex + offset</returns>
+			Iterator operator+(difference_type offset) const;
+			/// <summary>
+			/// Returns a copy of this Iterator moved offset elements backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new Iterator pointing at mIndex - offset</returns>
+			Iterator operator-(difference_type offset) const;
+			/// <summary>
+			/// Returns the number of elements between two Iterators of the same vector
+			/// </summary>
+			/// <param name="it">The Iterator being subtracted from this one</param>
+			/// <returns>The signed distance from it to this Iterator</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the Iterators belong to different vectors</exception>
+			difference_type operator-(const Iterator& it) const;
+			/// <summary>
+			/// Ordering comparisons. Iterators are ordered by the index they point to
+			/// </summary>
+			/// <param name="it">The Iterator that this Iterator is being compared to</param>
+			/// <returns>The result of comparing the indices of the two Iterators</returns>
+			bool operator<(const Iterator& it) const;
+			bool operator>(const Iterator& it) const;
+			bool operator<=(const Iterator& it) const;
+			bool operator>=(const Iterator& it) const;
+
+			/// <summary>
+			/// Returns a copy of the passed in Iterator moved offset elements forward
+			/// </summary>
+			friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
 		};
 #pragma endregion
 
@@ -152,8 +245,8 @@ namespace Library
 			using size_type = std::size_t;
 			using difference_type = std::ptrdiff_t;
 			using value_type = T;
-			using pointer = T*;
-			using reference = T;
+			using pointer = const T*;
+			using reference = const T&;
 			using iterator_category = std::random_access_iterator_tag;
 
 			/// <summary>
@@ -235,6 +328,66 @@ namespace Library
 			/// <returns>A copy of the current ConstIterator before it gets mutated to the previous index</returns>
 			/// <exception cref="std::runtime_error">Throws exception if iterators index is equal to zero</exception>
 			ConstIterator operator--(int);
+			/// <summary>
+			/// Member access operator
+			/// </summary>
+			/// <returns>A pointer to the data contained at mIndex</returns>
+			/// <exception cref="std::runtime_error">Throws exception if iterators index is >= size</exception>
+			const T* operator->() const;
+			/// <summary>
+			/// Subscript operator. Accesses the element that is offset elements away from this ConstIterator
+			/// </summary>
+			/// <param name="offset">The distance from mIndex of the element to access</param>
+			/// <returns>A constant reference to the data contained at mIndex + offset</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is >= size</exception>
+			const T& operator[](difference_type offset) const;
+			/// <summary>
+			/// Moves the ConstIterator offset elements forward. A negative offset moves it backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current ConstIterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			ConstIterator& operator+=(difference_type offset);
+			/// <summary>
+			/// Moves the ConstIterator offset elements backward. A negative offset moves it forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A reference to the current ConstIterator after it has been moved</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the resulting index is outside of the range [0, size]</exception>
+			ConstIterator& operator-=(difference_type offset);
+			/// <summary>
+			/// Returns a copy of this ConstIterator moved offset elements forward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new ConstIterator pointing at mIndex + offset</returns>
+			ConstIterator operator+(difference_type offset) const;
+			/// <summary>
+			/// Returns a copy of this ConstIterator moved offset elements backward
+			/// </summary>
+			/// <param name="offset">The number of elements to move by</param>
+			/// <returns>A new ConstIterator pointing at mIndex - offset</returns>
+			ConstIterator operator-(difference_type offset) const;
+			/// <summary>
+			/// Returns the number of elements between two ConstIterators of the same vector
+			/// </summary>
+			/// <param name="it">The ConstIterator being subtracted from this one</param>
+			/// <returns>The signed distance from it to this ConstIterator</returns>
+			/// <exception cref="std::runtime_error">Throws exception if the ConstIterators belong to different vectors</exception>
+			difference_type operator-(const ConstIterator& it) const;
+			/// <summary>
+			/// Ordering comparisons. ConstIterators are ordered by the index they point to
+			/// </summary>
+			/// <param name="it">The ConstIterator that this ConstIterator is being compared to</param>
+			/// <returns>The result of comparing the indices of the two ConstIterators</returns>
+			bool operator<(const ConstIterator& it) const;
+			bool operator>(const ConstIterator& it) const;
+			bool operator<=(const ConstIterator& it) const;
+			bool operator>=(const ConstIterator& it) const;
+
+			/// <summary>
+			/// Returns a copy of the passed in ConstIterator moved offset elements forward
+			/// </summary>
+			friend ConstIterator operator+(difference_type offset, const ConstIterator& it) { return it + offset; }
 		};
 #pragma endregion
 
@@ -244,7 +397,7 @@ namespace Library
 		/// <summary>
 		/// Default constructor that initializes the list to empty
 		/// </summary>
-		explicit Vector(size_t capacity = 0, ReserveStrategy reserveStrategy = DefaultRerserveStrategy());
+		explicit Vector(size_t capacity = 0, ReserveStrategy reserveStrategy = ReserveStrategy());
 		/// <summary>
 		/// Constructor using an initializer list to set the starting values of the vector
 		/// </summary>
@@ -403,6 +556,13 @@ namespace Library
 		/// <param name="value">The value to be added to the vector</param>
 		/// <returns>An iterator pointing to the index of the new value added to the vector</returns>
 		Iterator PushBack(T&& value);
+		/// <summary>
+		/// Constructs a new element in place at the back of the vector from the passed in arguments. Will increase the capacity of the vector if it is already filled
+		/// </summary>
+		/// <param name="args">The arguments forwarded to the constructor of T</param>
+		/// <returns>An iterator pointing to the index of the new value added to the vector</returns>
+		template<typename... Args>
+		Iterator EmplaceBack(Args&&... args);
 
 		/// <summary>
 		/// Removes any element from the vector. Does not harm the vector if the passed in value is not contained within the vector
@@ -466,21 +626,22 @@ namespace Library
 
 	private:
 		/// <summary>
-		/// A default reserve strategy functor that increases the capacity by a factor of 1.5
+		/// Moves the elements of the vector into a block of exactly the passed in capacity. Trivially relocatable types are
+		/// moved with realloc, every other type is move constructed into a new block and destructed in the old one
 		/// </summary>
-		struct DefaultRerserveStrategy
-		{
-			/// <summary>
-			/// Returns a new capacity that is increased by a factor of 1.5
-			/// </summary>
-			/// <param>Empty param not used for the default reserve strategy</param>
-			/// <param name="capacity">The current capacity of the vector</param>
-			/// <returns>A size_t of the capacity multiplied by a factor of 1.5</returns>
-			const size_t operator()(const size_t, const size_t capacity) const
-			{
-				return static_cast<size_t>(capacity * 1.5);
-			}
-		};
+		/// <param name="capacity">The capacity of the new block. Must be at least the size of the vector</param>
+		/// <exception cref="std::runtime_error">Throws this exception if the method is unable to allocate the new block</exception>
+		void Reallocate(size_t capacity);
+		/// <summary>
+		/// Increases the capacity of a full vector using the reserve strategy
+		/// </summary>
+		void Grow();
+		/// <summary>
+		/// Closes the gap left by destructed elements in the range [start, start + count) by shifting the tail of the vector down
+		/// </summary>
+		/// <param name="start">The index of the first destructed element</param>
+		/// <param name="count">The number of destructed elements</param>
+		void CloseGap(size_t start, size_t count);
 
 		/// <summary>
 		/// The starting address of the array of data contained within the vector
@@ -495,7 +656,10 @@ namespace Library
 		/// </summary>
 		size_t mCapacity = 0;
 
-		ReserveStrategy mReserveStrategy = DefaultRerserveStrategy();
+		/// <summary>
+		/// The policy used to compute the new capacity when the vector is full
+		/// </summary>
+		ReserveStrategy mReserveStrategy;
 #pragma endregion
 	};
 }
@@ -3,11 +3,11 @@
 namespace Library
 {
 #pragma region Iterator
-	template<typename T>
-	inline Vector<T>::Iterator::Iterator(size_t index, Vector& owner) : mIndex(index), mOwner(&owner) {}
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::Iterator::Iterator(size_t index, Vector& owner) : mIndex(index), mOwner(&owner) {}
 
-	template<typename T>
-	inline T& Vector<T>::Iterator::operator*() const
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr || mOwner->Size() == 0)
 		{
@@ -17,20 +17,20 @@ namespace Library
 		return (*mOwner)[mIndex];
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator==(const Iterator& it) const
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator==(const Iterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator!=(const Iterator& it) const
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator!=(const Iterator& it) const
 	{
 		return (mOwner != it.mOwner || mIndex != it.mIndex);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator& Vector<T, TReserveStrategy>::Iterator::operator++()
 	{
 		if (mOwner == nullptr || mIndex >= mOwner->Size())
 		{
@@ -41,16 +41,16 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T> 
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::Iterator::operator++(int)
 	{
 		Iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator--()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator& Vector<T, TReserveStrategy>::Iterator::operator--()
 	{
 		if (mOwner == nullptr || mIndex == 0)  
 		{
@@ -61,24 +61,109 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator--(int)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::Iterator::operator--(int)
 	{
 		Iterator it = *this;
 		operator--();
 		return it;
 	}
+
+	template<typename T, typename TReserveStrategy>
+	inline T* Vector<T, TReserveStrategy>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::Iterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator& Vector<T, TReserveStrategy>::Iterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		difference_type index = static_cast<difference_type>(mIndex) + offset;
+		if (index < 0 || static_cast<size_t>(index) > mOwner->Size())
+		{
+			throw std::runtime_error("You cannot move an iterator outside of its vector");
+		}
+
+		mIndex = static_cast<size_t>(index);
+		return *this;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator& Vector<T, TReserveStrategy>::Iterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::Iterator::operator+(difference_type offset) const
+	{
+		Iterator it = *this;
+		return it += offset;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::Iterator::operator-(difference_type offset) const
+	{
+		Iterator it = *this;
+		return it -= offset;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator::difference_type Vector<T, TReserveStrategy>::Iterator::operator-(const Iterator& it) const
+	{
+		if (mOwner != it.mOwner)
+		{
+			throw std::runtime_error("These iterators belong to different vectors");
+		}
+
+		return static_cast<difference_type>(mIndex) - static_cast<difference_type>(it.mIndex);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator<(const Iterator& it) const
+	{
+		return mIndex < it.mIndex;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator>(const Iterator& it) const
+	{
+		return it < *this;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator<=(const Iterator& it) const
+	{
+		return !(it < *this);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Iterator::operator>=(const Iterator& it) const
+	{
+		return !(*this < it);
+	}
 #pragma endregion
 
 #pragma region ConstIterator
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(size_t index, const Vector& owner) : mIndex(index), mOwner(&owner) {}
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::ConstIterator::ConstIterator(size_t index, const Vector& owner) : mIndex(index), mOwner(&owner) {}
 
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Iterator& it) : mIndex(it.mIndex), mOwner(it.mOwner) {}
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::ConstIterator::ConstIterator(const Iterator& it) : mIndex(it.mIndex), mOwner(it.mOwner) {}
 
-	template<typename T>
-	inline const T& Vector<T>::ConstIterator::operator*() const
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::ConstIterator::operator*() const
 	{
 		if (mOwner == nullptr || mOwner->mSize == 0)
 		{
@@ -88,20 +173,20 @@ namespace Library
 		return (*mOwner)[mIndex];
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator==(const ConstIterator& it) const
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator==(const ConstIterator& it) const
 	{
 		return !(*this != it);
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator!=(const ConstIterator& it) const
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator!=(const ConstIterator& it) const
 	{
 		return (mOwner != it.mOwner || mIndex != it.mIndex);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator& Vector<T, TReserveStrategy>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr || mIndex >= mOwner->Size())
 		{
@@ -112,16 +197,16 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::ConstIterator::operator++(int)
 	{
 		ConstIterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator--()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator& Vector<T, TReserveStrategy>::ConstIterator::operator--()
 	{
 		if (mOwner == nullptr || mIndex == 0)
 		{
@@ -132,26 +217,111 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator--(int)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::ConstIterator::operator--(int)
 	{
 		ConstIterator it = *this;
 		operator--();
 		return it;
 	}
+
+	template<typename T, typename TReserveStrategy>
+	inline const T* Vector<T, TReserveStrategy>::ConstIterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::ConstIterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator& Vector<T, TReserveStrategy>::ConstIterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("This iterator does not belong to a vector");
+		}
+
+		difference_type index = static_cast<difference_type>(mIndex) + offset;
+		if (index < 0 || static_cast<size_t>(index) > mOwner->Size())
+		{
+			throw std::runtime_error("You cannot move an iterator outside of its vector");
+		}
+
+		mIndex = static_cast<size_t>(index);
+		return *this;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator& Vector<T, TReserveStrategy>::ConstIterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::ConstIterator::operator+(difference_type offset) const
+	{
+		ConstIterator it = *this;
+		return it += offset;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::ConstIterator::operator-(difference_type offset) const
+	{
+		ConstIterator it = *this;
+		return it -= offset;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator::difference_type Vector<T, TReserveStrategy>::ConstIterator::operator-(const ConstIterator& it) const
+	{
+		if (mOwner != it.mOwner)
+		{
+			throw std::runtime_error("These iterators belong to different vectors");
+		}
+
+		return static_cast<difference_type>(mIndex) - static_cast<difference_type>(it.mIndex);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator<(const ConstIterator& it) const
+	{
+		return mIndex < it.mIndex;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator>(const ConstIterator& it) const
+	{
+		return it < *this;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator<=(const ConstIterator& it) const
+	{
+		return !(it < *this);
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::ConstIterator::operator>=(const ConstIterator& it) const
+	{
+		return !(*this < it);
+	}
 #pragma endregion
 
 #pragma region Vector
 
 #pragma region MemberMethods
-	template<typename T>
-	inline Vector<T>::Vector(size_t capacity, ReserveStrategy reserveStrategy) : mData(nullptr), mSize(0), mReserveStrategy(reserveStrategy)
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::Vector(size_t capacity, ReserveStrategy reserveStrategy) : mData(nullptr), mSize(0), mReserveStrategy(reserveStrategy)
 	{
 		Reserve(capacity);
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(std::initializer_list<T> list)
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::Vector(std::initializer_list<T> list)
 	{
 		Reserve(list.size());
 
@@ -161,8 +331,9 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(const Vector& rhs)
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::Vector(const Vector& rhs) :
+		mReserveStrategy(rhs.mReserveStrategy)
 	{
 		Reserve(rhs.mCapacity);
 
@@ -172,16 +343,16 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector&& rhs) noexcept : mSize(rhs.mSize), mCapacity(rhs.mCapacity), mData(rhs.mData)
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::Vector(Vector&& rhs) noexcept : mSize(rhs.mSize), mCapacity(rhs.mCapacity), mData(rhs.mData), mReserveStrategy(std::move(rhs.mReserveStrategy))
 	{
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
 		rhs.mData = nullptr;
 	}
 
-	template<typename T>
-	inline Vector<T>::~Vector()
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>::~Vector()
 	{
 		if (mData != nullptr)
 		{
@@ -190,12 +361,13 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(const Vector& rhs)
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>& Vector<T, TReserveStrategy>::operator=(const Vector& rhs)
 	{
 		if (this != &rhs)
 		{
 			Clear();
+			mReserveStrategy = rhs.mReserveStrategy;
 			Reserve(rhs.mCapacity);
 			for (size_t i = 0; i < rhs.mSize; ++i)
 			{
@@ -206,8 +378,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(Vector&& rhs) noexcept
+	template<typename T, typename TReserveStrategy>
+	inline Vector<T, TReserveStrategy>& Vector<T, TReserveStrategy>::operator=(Vector&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
@@ -216,6 +388,7 @@ namespace Library
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
 			mData = rhs.mData;
+			mReserveStrategy = std::move(rhs.mReserveStrategy);
 
 			rhs.mSize = 0;
 			rhs.mCapacity = 0;
@@ -227,8 +400,8 @@ namespace Library
 #pragma endregion
 
 #pragma region ElementAccess
-	template<typename T>
-	inline T& Vector<T>::operator[](size_t index)
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::operator[](size_t index)
 	{
 		if (mData == nullptr || index >= mSize)
 		{
@@ -238,8 +411,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::operator[](size_t index) const
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::operator[](size_t index) const
 	{
 		if (mData == nullptr || index >= mSize)
 		{
@@ -249,8 +422,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::At(size_t index)
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::At(size_t index)
 	{
 		if (mData == nullptr || index >= mSize)
 		{
@@ -260,8 +433,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::At(size_t index) const
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::At(size_t index) const
 	{
 		if (mData == nullptr || index >= mSize)
 		{
@@ -271,8 +444,8 @@ namespace Library
 		return mData[index];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Front()
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::Front()
 	{
 		if (IsEmpty())
 		{
@@ -282,8 +455,8 @@ namespace Library
 		return mData[0];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Front() const
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::Front() const
 	{
 		if (IsEmpty())
 		{
@@ -293,8 +466,8 @@ namespace Library
 		return mData[0];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Back()
+	template<typename T, typename TReserveStrategy>
+	inline T& Vector<T, TReserveStrategy>::Back()
 	{
 		if (IsEmpty())
 		{
@@ -304,8 +477,8 @@ namespace Library
 		return mData[mSize - 1];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Back() const
+	template<typename T, typename TReserveStrategy>
+	inline const T& Vector<T, TReserveStrategy>::Back() const
 	{
 		if (IsEmpty())
 		{
@@ -315,8 +488,8 @@ namespace Library
 		return mData[mSize - 1];
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare)
 	{
 		for (size_t i = 0; i < mSize; ++i)
 		{
@@ -329,8 +502,8 @@ namespace Library
 		return end();
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare) const
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::Find(const T& value, std::function<bool(const T & lhs, const T & rhs)> EqualityCompare) const
 	{
 		for (size_t i = 0; i < mSize; ++i)
 		{
@@ -345,43 +518,35 @@ namespace Library
 #pragma endregion
 	
 #pragma region Capacity
-	template<typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::IsEmpty() const
 	{
 		return mSize == 0;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Size() const
+	template<typename T, typename TReserveStrategy>
+	inline size_t Vector<T, TReserveStrategy>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Capacity() const
+	template<typename T, typename TReserveStrategy>
+	inline size_t Vector<T, TReserveStrategy>::Capacity() const
 	{
 		return mCapacity;
 	}
 
-	template<typename T>
-	void Vector<T>::Reserve(size_t capacity)
+	template<typename T, typename TReserveStrategy>
+	void Vector<T, TReserveStrategy>::Reserve(size_t capacity)
 	{
 		if (capacity > mCapacity)
 		{
-			mCapacity = capacity;
-			T* newData = reinterpret_cast<T*>(realloc(mData, capacity * sizeof(T)));
-
-			if (newData == nullptr)
-			{
-				throw std::runtime_error("Reserve memory allocation failed");
-			}
-
-			mData = newData;
+			Reallocate(capacity);
 		}
 	}
 
-	template<typename T>
-	void Vector<T>::Resize(size_t newSize)
+	template<typename T, typename TReserveStrategy>
+	void Vector<T, TReserveStrategy>::Resize(size_t newSize)
 	{
 		if (mSize > newSize)
 		{
@@ -393,13 +558,7 @@ namespace Library
 
 		if (newSize > mCapacity)
 		{
-			mCapacity = newSize;
-			T* newData = reinterpret_cast<T*>(realloc(mData, newSize * sizeof(T)));
-			if (newData == nullptr)
-			{
-				throw std::runtime_error("Reserve memory allocation failed");
-			}
-			mData = newData;
+			Reallocate(newSize);
 		}
 
 		if (mSize < newSize)
@@ -413,8 +572,8 @@ namespace Library
 		mSize = newSize;
 	}
 
-	template<typename T>
-	inline void Vector<T>::ShrinkToFit()
+	template<typename T, typename TReserveStrategy>
+	inline void Vector<T, TReserveStrategy>::ShrinkToFit()
 	{
 		if (mCapacity > mSize)
 		{
@@ -422,21 +581,81 @@ namespace Library
 			{
 				free(mData);
 				mData = nullptr;
+				mCapacity = 0;
 			}
 			else
 			{
-				Resize(mSize);
+				Reallocate(mSize);
+			}
+		}
+	}
+
+	template<typename T, typename TReserveStrategy>
+	void Vector<T, TReserveStrategy>::Reallocate(size_t capacity)
+	{
+		assert(capacity >= mSize);
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			T* newData = reinterpret_cast<T*>(realloc(mData, capacity * sizeof(T)));
+			if (newData == nullptr)
+			{
+				throw std::runtime_error("Reserve memory allocation failed");
+			}
+
+			mData = newData;
+		}
+		else
+		{
+			T* newData = reinterpret_cast<T*>(malloc(capacity * sizeof(T)));
+			if (newData == nullptr)
+			{
+				throw std::runtime_error("Reserve memory allocation failed");
 			}
 
-			mCapacity = mSize;
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				new(newData + i) T(std::move_if_noexcept(mData[i]));
+				mData[i].~T();
+			}
+
+			free(mData);
+			mData = newData;
+		}
+
+		mCapacity = capacity;
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline void Vector<T, TReserveStrategy>::Grow()
+	{
+		Reserve(std::max(mCapacity + 1, static_cast<size_t>(mReserveStrategy(mSize, mCapacity))));
+	}
+
+	template<typename T, typename TReserveStrategy>
+	inline void Vector<T, TReserveStrategy>::CloseGap(size_t start, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memmove(mData + start, mData + start + count, sizeof(T) * (mSize - start - count));
+		}
+		else
+		{
+			for (size_t i = start; i + count < mSize; ++i)
+			{
+				new(mData + i) T(std::move(mData[i + count]));
+				mData[i + count].~T();
+			}
 		}
+
+		mSize -= count;
 	}
 
 #pragma endregion
 
 #pragma region Modifiers
-	template<typename T>
-	inline void Vector<T>::PopBack()
+	template<typename T, typename TReserveStrategy>
+	inline void Vector<T, TReserveStrategy>::PopBack()
 	{
 		if (!IsEmpty())
 		{
@@ -444,40 +663,40 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::PushBack(const T& value)
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::PushBack(const T& value)
 	{
-		if (mSize >= mCapacity)
-		{
-			Reserve(std::max(mCapacity + 1, mReserveStrategy(mSize, mCapacity)));
-		}
-
-		new(mData + mSize) T(value);
+		return EmplaceBack(value);
+	}
 
-		return Iterator(mSize++, *this);
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::PushBack(T&& value)
+	{
+		return EmplaceBack(std::move(value));
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::PushBack(T&& value)
+	template<typename T, typename TReserveStrategy>
+	template<typename... Args>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::EmplaceBack(Args&&... args)
 	{
 		if (mSize >= mCapacity)
 		{
-			Reserve(std::max(mCapacity + 1, mReserveStrategy(mSize, mCapacity)));
+			Grow();
 		}
 
-		new(mData + mSize) T(std::move(value));
+		new(mData + mSize) T(std::forward<Args>(args)...);
 
 		return Iterator(mSize++, *this);
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const T& value)
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Remove(const T& value)
 	{
 		return Remove(Find(value));
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const Iterator& value)
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Remove(const Iterator& value)
 	{
 		if (value.mOwner != this)
 		{
@@ -490,12 +709,12 @@ namespace Library
 		}
 
 		mData[value.mIndex].~T();
-		std::memmove(mData + value.mIndex, mData + value.mIndex + 1, sizeof(T) * (--mSize - value.mIndex));
+		CloseGap(value.mIndex, 1);
 		return true;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const Iterator& startIt, const Iterator& endIt)
+	template<typename T, typename TReserveStrategy>
+	inline bool Vector<T, TReserveStrategy>::Remove(const Iterator& startIt, const Iterator& endIt)
 	{
 		if (startIt.mOwner != this || endIt.mOwner != this)
 		{
@@ -507,24 +726,21 @@ namespace Library
 			return false;
 		}
 
-		size_t numElements = mSize;
-
 		for (size_t i = startIt.mIndex; i < endIt.mIndex; ++i)
 		{
 			mData[i].~T();
-			--mSize;
 		}
 
-		if (endIt.mIndex < numElements)
+		if (endIt.mIndex > startIt.mIndex)
 		{
-			std::memmove(mData + startIt.mIndex, mData + endIt.mIndex, sizeof(T) * (numElements - endIt.mIndex));
+			CloseGap(startIt.mIndex, endIt.mIndex - startIt.mIndex);
 		}
 		
 		return true;
 	}
 
-	template<typename T>
-	inline void Vector<T>::Clear()
+	template<typename T, typename TReserveStrategy>
+	inline void Vector<T, TReserveStrategy>::Clear()
 	{
 		for (size_t i = 0; i < mSize; i++)
 		{
@@ -535,38 +751,38 @@ namespace Library
 #pragma endregion
 	
 #pragma region IteratorMethods
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::begin()
 	{
 		return Iterator(0, *this);
 	}
 
-	template<typename T>
-	inline typename Vector<T>:: ConstIterator Vector<T>::begin() const
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>:: ConstIterator Vector<T, TReserveStrategy>::begin() const
 	{
 		return cbegin();
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin() const
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::cbegin() const
 	{
 		return ConstIterator(0, *this);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::Iterator Vector<T, TReserveStrategy>::end()
 	{
 		return Iterator(mSize, *this);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::end() const
 	{
 		return cend();
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend() const
+	template<typename T, typename TReserveStrategy>
+	inline typename Vector<T, TReserveStrategy>::ConstIterator Vector<T, TReserveStrategy>::cend() const
 	{
 		return ConstIterator(mSize, *this);
 	}
@@ -1,8 +1,8 @@
 #include "pch.h"
 #include "World.h"
-#include "Vector.h"
+#include "SmallVector.h"
 #include "Sector.h"
-#include <sstream>
+#include "Factory.h"
 
 namespace Library
 {
@@ -10,22 +10,24 @@ namespace Library
 
 	const Vector<Signature> World::GetSignatures()
 	{
-		return Vector<Signature>
-		{
-			{"Name"s, Datum::DatumTypes::String, true, 1, offsetof(World, mName)},
-			{ "Sectors"s, Datum::DatumTypes::Table, false, 1, 0}
-		};
+		return AttributeReflection::Signatures<World>();
 	}
 
 	Datum* World::FindRelativeDatum(Scope& baseScope, const std::string& path, Scope** foundScope)
 	{
-		Vector<std::string> splitPath;
-		std::stringstream ss(path);
-		
-		std::string token;
-		while (std::getline(ss, token, '.'))
+		SmallVector<std::string, 8> splitPath;
+
+		size_t start = 0;
+		while (start < path.size())
 		{
-			splitPath.PushBack(token);
+			size_t end = path.find('.', start);
+			if (end == std::string::npos)
+			{
+				end = path.size();
+			}
+
+			splitPath.EmplaceBack(path, start, end - start);
+			start = end + 1;
 		}
 
 		Scope* context = &baseScope;
@@ -64,6 +66,7 @@ namespace Library
 	void World::SetName(const std::string& name)
 	{
 		mName = name;
+		MarkModified("Name");
 	}
 
 	Datum& World::Sectors()
@@ -96,6 +99,16 @@ namespace Library
 		return mWorldState;
 	}
 
+	ScopeReclaimer& World::GetReclaimer()
+	{
+		return mReclaimer;
+	}
+
+	const ScopeReclaimer& World::GetReclaimer() const
+	{
+		return mReclaimer;
+	}
+
 	Sector* World::CreateSector(const std::string& sectorName)
 	{
 		Sector* sector = new Sector;
@@ -113,13 +126,15 @@ namespace Library
 
 	void World::Update()
 	{
+		AdvanceChangeFrame();
 		mGameClock.UpdateGameTime(mWorldState.GetGameTime());
 		mEventQueue.Update(mWorldState.GetGameTime());
 
-		for (size_t i = 0; i < Sectors().Size(); i++)
+		const Datum& sectors = std::as_const(*this).Sectors();
+		for (size_t i = 0; i < sectors.Size(); i++)
 		{
-			assert(Sectors().GetScope(i)->Is(Sector::TypeIdClass()));
-			Sector* sector = static_cast<Sector*>(Sectors().GetScope(i));
+			assert(sectors.GetScope(i)->Is(Sector::TypeIdClass()));
+			Sector* sector = static_cast<Sector*>(sectors.GetScope(i));
 			mWorldState.Sector = sector;
 			sector->Update(mWorldState);
 			mWorldState.Sector = nullptr;
@@ -127,14 +142,21 @@ namespace Library
 
 		if (mPendingDelete.Size() > 0)
 		{
-			for (size_t i = 0; i < mPendingDelete.Size(); ++i)
+			// Transient actions go back to the pools of their factories, everything else is destroyed by the reclaimer
+			for (Scope* scope : DetachScopes(mPendingDelete))
 			{
-				mPendingDelete[i]->Orphan();
-				delete mPendingDelete[i];
+				if (!Factory<Scope>::Recycle(scope))
+				{
+					mReclaimer.Enqueue(scope);
+				}
 			}
-
 			mPendingDelete.Clear();
 		}
+
+		if (!mReclaimer.IsEmpty())
+		{
+			mReclaimer.Reclaim();
+		}
 	}
 
 	gsl::owner<Scope*> World::Clone() const
@@ -1,8 +1,10 @@
 #pragma once
 #include "Attributed.h"
+#include "AttributeReflection.h"
 #include "WorldState.h"
 #include "Vector.h"
 #include "EventQueue.h"
+#include "ScopeReclaimer.h"
 
 namespace Library
 {
@@ -22,6 +24,18 @@ namespace Library
 		/// </summary>
 		/// <returns>Vector of signatures of the prescribed attributes</returns>
 		static const Vector<Signature> GetSignatures();
+		/// <summary>
+		/// Declares the prescribed attributes of this class. Its signatures and the code that populates it are generated from this list
+		/// </summary>
+		/// <returns>The compile time descriptions of the prescribed attributes</returns>
+		static constexpr auto PrescribedAttributes()
+		{
+			return std::array
+			{
+				PRESCRIBED_ATTRIBUTE("Name", World, mName),
+				PrescribeInternal("Sectors", Datum::DatumTypes::Table)
+			};
+		}
 
 		/// <summary>
 		/// This method will find a Datum given a base Scope and a string represented relative path to the sought after Datum.
@@ -108,6 +122,17 @@ namespace Library
 		/// <returns>A const WorldState reference</returns>
 		const WorldState& GetWorldState() const;
 
+		/// <summary>
+		/// Gets a reference to the ScopeReclaimer that destroys deleted Scopes, which controls how much of each Update is spent on it
+		/// </summary>
+		/// <returns>A ScopeReclaimer reference</returns>
+		ScopeReclaimer& GetReclaimer();
+		/// <summary>
+		/// Gets a const reference to the ScopeReclaimer that destroys deleted Scopes
+		/// </summary>
+		/// <returns>A const ScopeReclaimer reference</returns>
+		const ScopeReclaimer& GetReclaimer() const;
+
 		/// <summary>
 		/// Creates a new Sector in this World and returns the address of the newly created Entity.
 		/// </summary>
@@ -117,12 +142,15 @@ namespace Library
 
 		/// <summary>
 		/// Given a Scope contained within the world mark it for delete so that it is removed on the next iteration of the game loop.
+		/// Marking a Scope more than once, or marking both a Scope and one of its descendants, deletes it only once.
+		/// The Scope is detached right away on that iteration. If the factory of its type recycles its products it is reset and handed back to it,
+		/// otherwise its memory is freed by the ScopeReclaimer over as many iterations as its frame budget needs.
 		/// </summary>
 		/// <param name="scope">The scope to be marked for delete</param>
 		void MarkScopeForDelete(Scope& scope);
 
 		/// <summary>
-		/// Updates all of the contained Sectors within the World based on the current WorldState.
+		/// Starts a new Scope change frame and updates all of the contained Sectors within the World based on the current WorldState, then spends up to the frame budget of the ScopeReclaimer destroying deleted Scopes.
 		/// </summary>
 		void Update();
 
@@ -171,5 +199,10 @@ namespace Library
 		/// An array of Scopes pending delete
 		/// </summary>
 		Vector<Scope*> mPendingDelete;
+
+		/// <summary>
+		/// Destroys the Scopes that were deleted from the world a few at a time each Update
+		/// </summary>
+		ScopeReclaimer mReclaimer;
 	};
 }
@@ -32,15 +32,15 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
-			TypeManager::RegisterType(Entity::TypeIdClass(), Attributed::TypeIdClass(), Entity::GetSignatures());
-			TypeManager::RegisterType(Sector::TypeIdClass(), Attributed::TypeIdClass(), Sector::GetSignatures());
-			TypeManager::RegisterType(World::TypeIdClass(), Attributed::TypeIdClass(), World::GetSignatures());
-			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
-			TypeManager::RegisterType(ActionList::TypeIdClass(), Action::TypeIdClass(), ActionList::GetSignatures());
-			TypeManager::RegisterType(ActionListWhile::TypeIdClass(), ActionList::TypeIdClass(), ActionListWhile::GetSignatures());
-			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
-			TypeManager::RegisterType(ActionDestroyAction::TypeIdClass(), Action::TypeIdClass(), ActionDestroyAction::GetSignatures());
-			TypeManager::RegisterType(ActionCreateAction::TypeIdClass(), Action::TypeIdClass(), ActionCreateAction::GetSignatures());
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionList, Action>();
+			AttributeReflection::RegisterType<ActionListWhile, ActionList>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			AttributeReflection::RegisterType<ActionDestroyAction, Action>();
+			AttributeReflection::RegisterType<ActionCreateAction, Action>();
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -410,6 +410,117 @@ namespace UnitTestLibraryDesktop
 		}
 
 
+		TEST_METHOD(ActionRecycling)
+		{
+			ActionIncrementFactory actionIncrementFactory;
+			ActionCreateActionFactory actionCreateFactory;
+			ActionListFactory actionListFactory;
+
+			World world;
+			Entity& entity = *(new Entity);
+			world.CreateSector("Sector")->Adopt(entity, "Entities");
+			entity["Value"] = 0;
+
+			// A run once action, with an auxiliary attribute holding a nested Scope
+			gsl::owner<Scope*> scope = Factory<Scope>::Create("ActionIncrement");
+			Assert::IsTrue(scope->Is(ActionIncrement::TypeIdClass()));
+			ActionIncrement* action = static_cast<ActionIncrement*>(scope);
+			const size_t prescribedCount = action->NumAttributes();
+			action->SetName("Once");
+			action->Find("RunOnce")->Set(1, 0);
+			action->Find("Target")->Set("Value"s, 0);
+			action->Find("Step")->Set(5, 0);
+			action->AppendScope("Nested")["Data"] = 10;
+			entity.Adopt(*action, "Actions");
+
+			world.Update();
+			Assert::AreEqual(5, entity["Value"].GetInt());
+			Assert::AreEqual(0_z, entity.Actions().Size());
+			Assert::AreEqual(1_z, actionIncrementFactory.Pool().Size());
+
+			// The next one created is the same object, reset to the state of a new one
+			gsl::owner<Scope*> recycled = Factory<Scope>::Create("ActionIncrement");
+			Assert::IsTrue(recycled == action);
+			Assert::AreEqual(0_z, actionIncrementFactory.Pool().Size());
+			Assert::AreEqual(prescribedCount, action->NumAttributes());
+			Assert::IsTrue(action->Name().empty());
+			Assert::AreEqual(0, action->Find("RunOnce")->GetInt());
+			Assert::IsTrue(action->Find("Target")->GetString().empty());
+			Assert::AreEqual(1, action->Find("Step")->GetInt());
+			Assert::IsNull(action->Find("Nested"));
+			Assert::IsTrue(action == action->Find("this")->GetPointer());
+			Assert::IsTrue(*action == ActionIncrement());
+
+			// Resetting members directly still drops the cached hash when there are no auxiliary attributes to truncate
+			ActionIncrement stepped;
+			stepped.Find("Step")->Set(5, 0);
+			Assert::IsFalse(stepped == ActionIncrement());
+			stepped.Reset();
+			Assert::IsTrue(stepped == ActionIncrement());
+
+			// Actions that keep running, or whose factory doesn't recycle, are destroyed as before
+			action->Find("Target")->Set("Value"s, 0);
+			entity.Adopt(*action, "Actions");
+			gsl::owner<Scope*> list = Factory<Scope>::Create("ActionList");
+			entity.Adopt(*list, "Actions");
+			world.MarkScopeForDelete(*list);
+			world.Update();
+			Assert::AreEqual(6, entity["Value"].GetInt());
+			Assert::AreEqual(1_z, entity.Actions().Size());
+			Assert::AreEqual(0_z, actionIncrementFactory.Pool().Size());
+			world.GetReclaimer().ReclaimAll();
+
+			// An ActionCreateAction deletes itself after it runs and goes back to its pool as well
+			ActionCreateAction* create = static_cast<ActionCreateAction*>(Factory<Scope>::Create("ActionCreateAction"));
+			create->Find("Prototype")->Set("ActionIncrement"s, 0);
+			create->Find("ActionName")->Set("Created"s, 0);
+			entity.Adopt(*create, "Actions");
+			world.Update();
+			Assert::AreEqual(2_z, entity.Actions().Size());
+			Assert::AreEqual(1_z, actionCreateFactory.Pool().Size());
+			Assert::IsTrue(Factory<Scope>::Create("ActionCreateAction") == create);
+			Assert::IsTrue(create->Find("Prototype")->GetString().empty());
+			delete create;
+
+			// A full pool deletes what it is handed
+			actionIncrementFactory.Pool().SetCapacity(0);
+			gsl::owner<Scope*> extra = Factory<Scope>::Create("ActionIncrement");
+			Assert::IsFalse(Factory<Scope>::Recycle(extra));
+			delete extra;
+		}
+
+		TEST_METHOD(ActionRecyclingSteadyState)
+		{
+			ActionIncrementFactory actionIncrementFactory;
+
+			World world;
+			Entity& entity = *(new Entity);
+			world.CreateSector("Sector")->Adopt(entity, "Entities");
+			entity["Value"] = 0;
+
+			const Factory<Scope>::Handle handle("ActionIncrement");
+			const size_t frames = 100;
+			Scope* first = nullptr;
+			for (size_t i = 0; i < frames; ++i)
+			{
+				Action* action = static_cast<Action*>(Factory<Scope>::Create(handle));
+				if (first == nullptr)
+				{
+					first = action;
+				}
+				Assert::IsTrue(first == action);
+
+				action->Find("RunOnce")->Set(1, 0);
+				action->Find("Target")->Set("Value"s, 0);
+				entity.Adopt(*action, "Actions");
+				world.Update();
+			}
+
+			Assert::AreEqual(static_cast<int>(frames), entity["Value"].GetInt());
+			Assert::AreEqual(1_z, actionIncrementFactory.Pool().Size());
+			Assert::IsTrue(world.GetReclaimer().IsEmpty());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "AttributedFoo.h"
+#include "AttributeHandle.h"
+#include "ActionIncrement.h"
+#include "ActionList.h"
+#include "Entity.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AttributeHandleTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionList, Action>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			TypeManager::RegisterType(AttributedFoo::TypeIdClass(), Attributed::TypeIdClass(), AttributedFoo::GetSignatures());
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(GetAndSet)
+		{
+			AttributeHandle<int32_t> step = AttributeHandle<int32_t>::Resolve<ActionIncrement>("Step");
+			ActionIncrement action("Increment");
+			Assert::AreEqual(1, step.Get(action));
+			Assert::AreEqual(1, step.Get(std::as_const(action)));
+			Assert::IsTrue(&action[step.Index()] == action.Find("Step"));
+
+			size_t version = action.Find("Step")->Version();
+			step.Set(action, 5);
+			Assert::AreEqual(5, action.Find("Step")->GetInt());
+			Assert::IsTrue(action.Find("Step")->Version() > version);
+
+			step.Get(action) = 7;
+			Assert::AreEqual(7, std::as_const(action).Find("Step")->GetInt());
+
+			// The handle follows the members of copies
+			ActionIncrement copy = action;
+			step.Set(copy, 9);
+			Assert::AreEqual(9, copy.Find("Step")->GetInt());
+			Assert::AreEqual(7, step.Get(action));
+		}
+
+		TEST_METHOD(DerivedTypes)
+		{
+			AttributeHandle<std::string> name = AttributeHandle<std::string>::Resolve<Action>("Name");
+			ActionIncrement increment("Increment");
+			ActionList list("List");
+			Assert::AreEqual("Increment"s, name.Get(increment));
+			Assert::AreEqual("List"s, name.Get(list));
+
+			name.Set(list, "Renamed"s);
+			Assert::AreEqual("Renamed"s, list.Find("Name")->GetString());
+
+			// Attributes of a parent resolve from the derived type as well
+			AttributeHandle<std::string> derivedName = AttributeHandle<std::string>::Resolve<ActionIncrement>("Name");
+			Assert::AreEqual(name.Offset(), derivedName.Offset());
+			Assert::AreEqual(name.Index(), derivedName.Index());
+		}
+
+		TEST_METHOD(Arrays)
+		{
+			AttributeHandle<float> array = AttributeHandle<float>::Resolve<AttributedFoo>("Array");
+			Assert::AreEqual(6_z, array.Size());
+
+			AttributedFoo foo;
+			for (size_t i = 0; i < array.Size(); ++i)
+			{
+				Assert::AreEqual(static_cast<float>(i + 1), array.Get(foo, i));
+			}
+
+			array.Set(foo, 10.0f, 3);
+			Assert::AreEqual(10.0f, foo.Find("Array")->GetFloat(3));
+		}
+
+		TEST_METHOD(ResolveErrors)
+		{
+			Assert::ExpectException<std::runtime_error>([]() { AttributeHandle<int32_t>::Resolve<ActionIncrement>("Missing"); });
+			Assert::ExpectException<std::runtime_error>([]() { AttributeHandle<float>::Resolve<ActionIncrement>("Step"); });
+			Assert::ExpectException<std::runtime_error>([]() { AttributeHandle<int32_t>::Resolve<Entity>("Actions"); });
+
+			TypeManager::UnregisterType(ActionIncrement::TypeIdClass());
+			Assert::ExpectException<std::runtime_error>([]() { AttributeHandle<int32_t>::Resolve<ActionIncrement>("Step"); });
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AttributeHandleTests::sStartMemState;
+}
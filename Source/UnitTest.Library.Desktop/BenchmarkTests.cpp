@@ -0,0 +1,860 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+// The benchmarks take seconds each and only report their times, so they are left out of the unit tests.
+// Define RUN_BENCHMARKS in the preprocessor definitions, preferably of a Release build, to run them
+#if defined(RUN_BENCHMARKS)
+
+#include "Foo.h"
+#include "DeepHierarchy.h"
+#include "KeyedParseHelper.h"
+#include "AttributedFoo.h"
+#include "Avatar.h"
+#include "Vector.h"
+#include "HashMap.h"
+#include "ConcurrentHashMap.h"
+#include "ParallelAlgorithms.h"
+#include "Scope.h"
+#include "Factory.h"
+#include "TypeManager.h"
+#include "AttributeReflection.h"
+#include "AttributeHandle.h"
+#include "ActionIncrement.h"
+#include "Entity.h"
+#include "Sector.h"
+#include "World.h"
+#include "ScopeReclaimer.h"
+#include "JsonParseMaster.h"
+#include "JsonTableParseHelper.h"
+#include "JsonTableLoader.h"
+#include "ToStringSpecializations.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(BenchmarkTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
+			TypeManager::RegisterType(AttributedFoo::TypeIdClass(), Attributed::TypeIdClass(), AttributedFoo::GetSignatures());
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+		}
+
+#pragma region Containers
+		TEST_METHOD(VectorPushBack)
+		{
+			const size_t count = 100000;
+			std::wstringstream results;
+			results << L"Vector::PushBack " << count << L" elements (ms)" << std::endl;
+			results << L"int: " << TimePushBack(42, count) << std::endl;
+			results << L"glm::mat4: " << TimePushBack(glm::mat4(1.0f), count) << std::endl;
+			results << L"std::string: " << TimePushBack(std::string("A string that does not fit in the small string buffer"), count) << std::endl;
+			Report(results);
+		}
+
+		TEST_METHOD(VectorParallelAlgorithms)
+		{
+			const size_t count = 200000;
+			Vector<int> serial(count);
+			std::mt19937 generator(0);
+			for (size_t i = 0; i < count; ++i)
+			{
+				serial.PushBack(static_cast<int>(generator() % count));
+			}
+			Vector<int> parallel = serial;
+			const std::wstring ints = std::to_wstring(count) + L" ints (serial / parallel)";
+
+			Report(L"Sort " + ints, {
+				Time([&serial] { std::sort(serial.begin(), serial.end()); }),
+				Time([&parallel] { ParallelSort(parallel.begin(), parallel.end()); }) });
+
+			auto twice = [](int value) { return value * 2; };
+			Report(L"Transform " + ints, {
+				Time([&serial, &twice] { std::transform(serial.begin(), serial.end(), serial.begin(), twice); }),
+				Time([&parallel, &twice] { ParallelTransform(parallel.begin(), parallel.end(), parallel.begin(), twice); }) });
+
+			auto isSmall = [count](int value) { return static_cast<size_t>(value) < count; };
+			Report(L"Partition " + ints, {
+				Time([&serial, &isSmall] { std::partition(serial.begin(), serial.end(), isSmall); }),
+				Time([&parallel, &isSmall] { ParallelPartition(parallel.begin(), parallel.end(), isSmall); }) });
+		}
+
+		TEST_METHOD(HashMapInsertLatency)
+		{
+			const int count = 100000;
+			std::wstringstream results;
+			results << L"Insert latency in ns of " << count << L" insertions starting from 11 buckets (p50 / p99 / max)" << std::endl;
+
+			auto report = [&results](const wchar_t* name, std::vector<double>& samples)
+			{
+				std::sort(samples.begin(), samples.end());
+				results << name << L": " << samples[samples.size() / 2] << L" / " << samples[samples.size() * 99 / 100] << L" / " << samples.back() << std::endl;
+			};
+
+			{
+				HashMap<int, int> map;
+				std::vector<double> samples = MeasureInserts(count, [&map](int i) { map.Insert(std::pair(i, i)); });
+				report(L"Incremental growth", samples);
+				Assert::AreEqual(static_cast<size_t>(count), map.Size());
+			}
+
+			{
+				// The old behaviour: nothing grows until a manual Resize rehashes every pair at once
+				HashMap<int, int> map;
+				map.SetMaxLoadFactor(static_cast<float>(count));
+				std::vector<double> samples = MeasureInserts(count, [&map](int i)
+				{
+					map.Insert(std::pair(i, i));
+					if (map.LoadFactor() > 2.0f)
+					{
+						map.Resize(map.BucketSize() * 2 + 1);
+					}
+				});
+				report(L"Full Resize", samples);
+				Assert::AreEqual(static_cast<size_t>(count), map.Size());
+			}
+
+			Report(results);
+		}
+
+		TEST_METHOD(HashMapLookupPolicies)
+		{
+			const int count = 1000;
+			const int lookups = 1000000;
+			std::wstringstream results;
+			results << L"Lookups per ms of " << count << L" keys (inlined policies / std::function)" << std::endl;
+
+			std::vector<int> intKeys;
+			std::vector<std::string> stringKeys;
+			for (int i = 0; i < count; ++i)
+			{
+				intKeys.push_back(i * 7919);
+				stringKeys.push_back("Attribute" + std::to_string(i));
+			}
+
+			results << L"int: " << MeasureLookups<HashMap<int, int>>(intKeys, lookups) << L" / " << MeasureLookups<DynamicHashMap<int, int>>(intKeys, lookups) << std::endl;
+			results << L"std::string: " << MeasureLookups<HashMap<std::string, int>>(stringKeys, lookups) << L" / "
+				<< MeasureLookups<DynamicHashMap<std::string, int>>(stringKeys, lookups) << std::endl;
+			Report(results);
+		}
+
+		TEST_METHOD(ConcurrentHashMapReaderScaling)
+		{
+			std::wstringstream results;
+			results << L"Lookups per ms with a registration every 1000 lookups (readers: 1 lock / 16 shards)" << std::endl;
+
+			for (size_t readers = 1; readers <= 32; readers *= 2)
+			{
+				double single = MeasureConcurrentLookups<1>(readers);
+				double sharded = MeasureConcurrentLookups<16>(readers);
+				results << readers << L": " << single << L" / " << sharded << std::endl;
+			}
+
+			Report(results);
+		}
+#pragma endregion
+
+#pragma region Scopes
+		TEST_METHOD(ScopeConstruction)
+		{
+			const int count = 100000;
+			double time = Time([count]
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					Scope scope;
+					scope.Append("Name") = "Event";
+					scope.Append("Delay") = 1.0f;
+					scope.Append("Count") = i;
+				}
+			});
+
+			Report(L"Constructing and destroying " + std::to_wstring(count) + L" Scopes with 3 attributes", { time });
+		}
+
+		TEST_METHOD(ScopeOrphan)
+		{
+			const size_t count = 50000;
+			Scope sector;
+			Vector<Scope*> entities;
+			entities.Reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				entities.PushBack(&sector.AppendScope("Entities"));
+			}
+
+			double time = Time([&entities]
+			{
+				for (Scope* entity : entities)
+				{
+					entity->Orphan(false);
+					delete entity;
+				}
+			});
+			Assert::AreEqual(0_z, sector.Find("Entities")->Size());
+
+			Report(L"Orphaning " + std::to_wstring(count) + L" children of one Scope", { time });
+		}
+
+		TEST_METHOD(ScopePrototypeInstancing)
+		{
+			Scope prototype;
+			prototype.Append("Name") = "A prototype name longer than the small string buffer"s;
+			Datum& tags = prototype.Append("Tags");
+			for (int i = 0; i < 8; ++i)
+			{
+				tags.PushBack("Tag number " + std::to_string(i) + " of the prototype");
+			}
+			Datum& path = prototype.Append("Path");
+			for (int i = 0; i < 16; ++i)
+			{
+				path.PushBack(glm::vec4(static_cast<float>(i)));
+			}
+			prototype.Append("Transform") = glm::mat4(1.0f);
+			prototype.AppendScope("Stats").Append("Health") = 10;
+
+			const size_t count = 100000;
+			Vector<gsl::owner<Scope*>> instances;
+			instances.Reserve(count);
+			double time = Time([&prototype, &instances, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					instances.PushBack(prototype.Clone());
+				}
+			});
+
+			for (Scope* instance : instances)
+			{
+				delete instance;
+			}
+
+			Report(L"Spawning " + std::to_wstring(count) + L" instances of a prototype", { time });
+		}
+
+		TEST_METHOD(ScopeDiff)
+		{
+			const size_t count = 20000;
+			Scope lhs = CreateEntities(count);
+			Scope rhs = lhs;
+			lhs.Hash();
+			rhs.Hash();
+
+			rhs.Find("Entities")->GetScope(count / 2)->Find("Position")->Set(glm::vec4(-1.0f), 0);
+			Vector<std::string> differences;
+			double diffTime = Time([&lhs, &rhs, &differences] { differences = Scope::Diff(lhs, rhs); });
+			Assert::AreEqual(1_z, differences.Size());
+
+			rhs.Find("Entities")->GetScope(count / 2)->Find("Position")->Set(glm::vec4(static_cast<float>(count / 2)), 0);
+			bool equal = false;
+			double equalityTime = Time([&lhs, &rhs, &equal] { equal = lhs == rhs; });
+			Assert::IsTrue(equal);
+
+			Report(L"One change among " + std::to_wstring(count) + L" Scopes (Diff / operator== of equal Scopes)", { diffTime, equalityTime });
+		}
+
+		TEST_METHOD(ScopeChangeTracking)
+		{
+			const size_t count = 20000;
+			Scope root = CreateEntities(count);
+
+			size_t since = Scope::AdvanceChangeFrame();
+			const size_t changes = 10;
+			for (size_t i = 0; i < changes; ++i)
+			{
+				root.Find("Entities")->GetScope(i * (count / changes))->Find("Position")->Set(glm::vec4(-1.0f), 0);
+			}
+
+			size_t tracked = 0;
+			double trackedTime = Time([&root, &tracked, since] { root.ForEachChangedAttribute(since, [&tracked](Scope&, Scope::PairType&) { ++tracked; }); });
+			Assert::AreEqual(changes, tracked);
+
+			// The same question answered by visiting every attribute
+			size_t scanned = 0;
+			double scanTime = Time([&root, &scanned, since]
+			{
+				const Datum& entities = *std::as_const(root).Find("Entities");
+				for (size_t i = 0; i < entities.Size(); ++i)
+				{
+					const Scope& entity = *entities.GetScope(i);
+					for (size_t j = 0; j < entity.NumAttributes(); ++j)
+					{
+						if (entity[j].ChangeFrame() >= since)
+						{
+							++scanned;
+						}
+					}
+				}
+			});
+			Assert::AreEqual(changes, scanned);
+
+			Report(std::to_wstring(changes) + L" changes among " + std::to_wstring(count) + L" Scopes (tracked / full scan)", { trackedTime, scanTime });
+		}
+
+		TEST_METHOD(ScopeReclaimerUpdateHitch)
+		{
+			const size_t entities = 20000;
+			double immediate = MeasureWorstUpdate(entities, std::chrono::duration_cast<ScopeReclaimer::Microseconds>(std::chrono::seconds(10)));
+			double deferred = MeasureWorstUpdate(entities, ScopeReclaimer::DefaultFrameBudget);
+
+			Report(L"Worst update deleting a Sector of " + std::to_wstring(entities) + L" entities (immediate / 1ms budget)", { immediate, deferred });
+		}
+
+		TEST_METHOD(WorldBatchedDelete)
+		{
+			auto measure = [](size_t count)
+			{
+				World world;
+				Sector* sector = world.CreateSector("Sector");
+				for (size_t i = 0; i < count; ++i)
+				{
+					Entity* entity = new Entity;
+					sector->Adopt(*entity, "Entities");
+					if (i % 2 == 0)
+					{
+						world.MarkScopeForDelete(*entity);
+					}
+				}
+
+				double time = Time([&world] { world.Update(); });
+				Assert::AreEqual(count / 2, sector->Entities().Size());
+				return time;
+			};
+
+			double small = measure(10000);
+			double large = measure(40000);
+			Report(L"Update deleting half of 10000 / 40000 entities", { small, large });
+
+			// Four times the entities costs about four times as long when deletion is linear, and sixteen times when it is quadratic
+			Assert::IsTrue(large < small * 10.0);
+		}
+#pragma endregion
+
+#pragma region Reflection
+		TEST_METHOD(RTTIIs)
+		{
+			const size_t count = 1000000;
+			Level8 deepest;
+			const Level1& object = deepest;
+			const RTTI::IdType root = Level1::TypeIdClass();
+
+			size_t matches = 0;
+			double recordTime = Time([&object, &matches, root, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					matches += object.Is(root);
+				}
+			});
+			double walkTime = Time([&object, &matches, root, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					matches += object.WalkIs(root);
+				}
+			});
+			Assert::AreEqual(count * 2, matches);
+
+			Report(std::to_wstring(count) + L" checks against the root of an 8 level hierarchy (type records / virtual walk)", { recordTime, walkTime });
+		}
+
+		TEST_METHOD(TypeManagerReflection)
+		{
+			const size_t count = 20000;
+			auto construct = [count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					ActionIncrement action;
+				}
+			};
+
+			TypeManager::Clear();
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			double reflectedTime = Time(construct);
+			TypeManager::Clear();
+
+			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
+			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
+			double walkedTime = Time(construct);
+
+			Report(L"Constructing " + std::to_wstring(count) + L" ActionIncrements (generated Populate / signatures)", { reflectedTime, walkedTime });
+		}
+
+		TEST_METHOD(AttributeHandleReads)
+		{
+			const size_t count = 1000000;
+			ActionIncrement action;
+			AttributeHandle<int32_t> step = AttributeHandle<int32_t>::Resolve<ActionIncrement>("Step");
+
+			int64_t sum = 0;
+			double handleTime = Time([&action, &step, &sum, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					sum += step.Get(std::as_const(action));
+				}
+			});
+			double lookupTime = Time([&action, &sum, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					sum += std::as_const(action).Find("Step")->GetInt();
+				}
+			});
+			Assert::AreEqual(static_cast<int64_t>(count * 2), sum);
+
+			Report(std::to_wstring(count) + L" reads of a prescribed attribute (AttributeHandle / Find)", { handleTime, lookupTime });
+		}
+
+		TEST_METHOD(FactoryCreateBatch)
+		{
+			AttributedFooFactory fooFactory;
+			const size_t count = 10000;
+
+			Vector<gsl::owner<Scope*>> batch;
+			double batchTime = Time([&batch, count] { batch = Factory<Scope>::CreateBatch("AttributedFoo", count); });
+
+			Vector<gsl::owner<Scope*>> single(count);
+			double singleTime = Time([&single, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					single.PushBack(Factory<Scope>::Create("AttributedFoo"));
+				}
+			});
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				delete batch[i];
+				delete single[i];
+			}
+
+			Report(L"Creating " + std::to_wstring(count) + L" AttributedFoos (CreateBatch / Create)", { batchTime, singleTime });
+		}
+
+		TEST_METHOD(ActionRecycling)
+		{
+			ActionIncrementFactory actionIncrementFactory;
+			const size_t count = 10000;
+
+			double recycledTime = Time([count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					gsl::owner<Scope*> action = Factory<Scope>::Create("ActionIncrement");
+					(*action)["Argument"] = static_cast<int>(i);
+					Assert::IsTrue(Factory<Scope>::Recycle(action));
+				}
+			});
+
+			actionIncrementFactory.Pool().SetCapacity(0);
+			double deletedTime = Time([count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					gsl::owner<Scope*> action = Factory<Scope>::Create("ActionIncrement");
+					(*action)["Argument"] = static_cast<int>(i);
+					delete action;
+				}
+			});
+
+			Report(std::to_wstring(count) + L" transient ActionIncrements (recycled / deleted)", { recycledTime, deletedTime });
+		}
+#pragma endregion
+
+#pragma region Json
+		TEST_METHOD(JsonStreamParse)
+		{
+			const size_t count = 20000;
+			const std::string rawJson = GenerateEntities(count);
+
+			double times[2];
+			Scope scopes[2];
+			const JsonParseMaster::ParseMode modes[] = { JsonParseMaster::ParseMode::Document, JsonParseMaster::ParseMode::Stream };
+			for (size_t i = 0; i < 2; ++i)
+			{
+				JsonTableParseHelper::TableSharedData sharedData(&scopes[i]);
+				JsonParseMaster parseMaster(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.SetParseMode(modes[i]);
+
+				std::istringstream stream(rawJson);
+				times[i] = Time([&parseMaster, &stream] { parseMaster.Parse(stream); });
+			}
+
+			Assert::AreEqual(count, scopes[1]["Entities"].Size());
+			Assert::IsTrue(scopes[0] == scopes[1]);
+
+			Report(L"Parsing " + std::to_wstring(rawJson.size() / 1024) + L" KB of tables (Document / Stream)", { times[0], times[1] });
+		}
+
+		TEST_METHOD(JsonFileParse)
+		{
+			const size_t count = 20000;
+			{
+				std::ofstream file("EntitiesBenchmark.json", std::ios::binary);
+				file << GenerateEntities(count);
+			}
+
+			// Reading the file through a stream, the way ParseFromFile used to, against mapping it in each mode
+			double times[3];
+			Scope scopes[3];
+			for (size_t i = 0; i < 3; ++i)
+			{
+				JsonTableParseHelper::TableSharedData sharedData(&scopes[i]);
+				JsonParseMaster parseMaster(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.SetParseMode(i == 2 ? JsonParseMaster::ParseMode::Stream : JsonParseMaster::ParseMode::Document);
+
+				times[i] = Time([&parseMaster, i]
+				{
+					if (i == 0)
+					{
+						std::ifstream file("EntitiesBenchmark.json");
+						parseMaster.Parse(file);
+					}
+					else
+					{
+						parseMaster.ParseFromFile("EntitiesBenchmark.json");
+					}
+				});
+			}
+
+			Assert::AreEqual(count, scopes[2]["Entities"].Size());
+			Assert::IsTrue(scopes[0] == scopes[1]);
+			Assert::IsTrue(scopes[0] == scopes[2]);
+
+			Report(L"Loading tables from a file (Document stream / Document mapped / Stream mapped)", { times[0], times[1], times[2] });
+		}
+
+		TEST_METHOD(JsonTableLoad)
+		{
+			EntityFactory entityFactory;
+			AvatarFactory avatarFactory;
+			SectorFactory sectorFactory;
+
+			JsonTableParseHelper::TableSharedData sharedData;
+			JsonParseMaster parseMaster(sharedData);
+			JsonTableParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+
+			const size_t fileCount = 64;
+			JsonTableLoader serialLoader(parseMaster, 1);
+			JsonTableLoader parallelLoader(parseMaster);
+			for (size_t i = 0; i < fileCount; ++i)
+			{
+				const std::string filename = "LoaderBenchmark" + std::to_string(i) + ".json";
+				std::ofstream file(filename);
+				file << GenerateEntities(200, "Avatar");
+				file.close();
+
+				serialLoader.AddFile(filename, "Sector");
+				parallelLoader.AddFile(filename, "Sector");
+			}
+
+			World serialWorld;
+			World parallelWorld;
+			double serialTime = Time([&serialLoader, &serialWorld] { serialLoader.LoadInto(serialWorld, "Sectors"); });
+			double parallelTime = Time([&parallelLoader, &parallelWorld] { parallelLoader.LoadInto(parallelWorld, "Sectors"); });
+
+			Assert::AreEqual(fileCount, parallelWorld.Sectors().Size());
+			for (size_t i = 0; i < fileCount; ++i)
+			{
+				Assert::IsTrue(*serialWorld.Sectors().GetScope(i) == *parallelWorld.Sectors().GetScope(i));
+			}
+
+			Report(L"Loading " + std::to_wstring(fileCount) + L" sector files (1 thread / " + std::to_wstring(parallelLoader.ThreadCount()) + L" threads)",
+				{ serialTime, parallelTime });
+		}
+
+		TEST_METHOD(JsonKeyedDispatch)
+		{
+			// Each member is only accepted by one of a dozen helpers, the old dispatch offered it to each of them in turn
+			const size_t memberCount = 12 * 4000;
+			std::ostringstream builder;
+			builder << "{";
+			for (size_t i = 0; i < memberCount; ++i)
+			{
+				builder << (i == 0 ? "" : ",") << "\"mKey" << (i % 12) << "\": " << i;
+			}
+			builder << "}";
+			const std::string rawJson = builder.str();
+
+			double times[2];
+			for (size_t i = 0; i < 2; ++i)
+			{
+				const bool declaresKeys = i == 1;
+				JsonTableParseHelper::TableSharedData sharedData;
+				JsonParseMaster parseMaster(sharedData);
+				parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+				KeyedParseHelper<0> helper0(declaresKeys); KeyedParseHelper<1> helper1(declaresKeys); KeyedParseHelper<2> helper2(declaresKeys);
+				KeyedParseHelper<3> helper3(declaresKeys); KeyedParseHelper<4> helper4(declaresKeys); KeyedParseHelper<5> helper5(declaresKeys);
+				KeyedParseHelper<6> helper6(declaresKeys); KeyedParseHelper<7> helper7(declaresKeys); KeyedParseHelper<8> helper8(declaresKeys);
+				KeyedParseHelper<9> helper9(declaresKeys); KeyedParseHelper<10> helper10(declaresKeys); KeyedParseHelper<11> helper11(declaresKeys);
+				IJsonParseHelper* helpers[] = { &helper0, &helper1, &helper2, &helper3, &helper4, &helper5, &helper6, &helper7, &helper8, &helper9, &helper10, &helper11 };
+				for (IJsonParseHelper* helper : helpers)
+				{
+					parseMaster.AddHelper(*helper);
+				}
+
+				times[i] = Time([&parseMaster, &rawJson] { parseMaster.Parse(rawJson); });
+				Assert::AreEqual(memberCount / 12, helper11.mHandled);
+				Assert::AreEqual(declaresKeys ? memberCount / 12 : memberCount, helper0.mOffered);
+			}
+
+			Report(L"Dispatching " + std::to_wstring(memberCount) + L" members among 12 helpers (offered to each / keyed)", { times[0], times[1] });
+		}
+#pragma endregion
+
+	private:
+		/// <summary>
+		/// Calls the passed in function once and times it
+		/// </summary>
+		/// <param name="function">The work being timed</param>
+		/// <returns>The time the call took in milliseconds</returns>
+		template<typename TFunction>
+		static double Time(TFunction function)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			function();
+			auto end = std::chrono::high_resolution_clock::now();
+			return std::chrono::duration<double, std::milli>(end - start).count();
+		}
+
+		/// <summary>
+		/// Writes a line of times in milliseconds to the test output, such as "Sort (serial / parallel): 2 ms / 1 ms"
+		/// </summary>
+		/// <param name="description">What was timed, including what each of the times stands for</param>
+		/// <param name="times">The times in milliseconds</param>
+		static void Report(const std::wstring& description, std::initializer_list<double> times)
+		{
+			std::wstringstream results;
+			results << description << L":";
+			const wchar_t* separator = L" ";
+			for (double time : times)
+			{
+				results << separator << time << L" ms";
+				separator = L" / ";
+			}
+			results << std::endl;
+			Report(results);
+		}
+
+		/// <summary>
+		/// Writes a table of results to the test output
+		/// </summary>
+		/// <param name="results">The lines of the table</param>
+		static void Report(const std::wstringstream& results)
+		{
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		template<typename T>
+		static double TimePushBack(const T& value, size_t count)
+		{
+			return Time([&value, count]
+			{
+				Vector<T> vector;
+				for (size_t i = 0; i < count; ++i)
+				{
+					vector.PushBack(value);
+				}
+				Assert::AreEqual(count, vector.Size());
+			});
+		}
+
+		/// <summary>
+		/// Times every call of insert individually
+		/// </summary>
+		/// <returns>The latency of each insertion in nanoseconds</returns>
+		template<typename Inserter>
+		static std::vector<double> MeasureInserts(int count, Inserter insert)
+		{
+			std::vector<double> samples;
+			samples.reserve(count);
+			for (int i = 0; i < count; ++i)
+			{
+				samples.push_back(Time([&insert, i] { insert(i); }) * 1000000.0);
+			}
+
+			return samples;
+		}
+
+		/// <summary>
+		/// Fills a map of type TMap with keys and looks them up round robin
+		/// </summary>
+		/// <returns>The number of lookups per millisecond</returns>
+		template<typename TMap, typename TKey>
+		static double MeasureLookups(const std::vector<TKey>& keys, int lookups)
+		{
+			TMap map(keys.size());
+			for (size_t i = 0; i < keys.size(); ++i)
+			{
+				map.Insert(std::pair(keys[i], static_cast<int>(i)));
+			}
+
+			int found = 0;
+			double time = Time([&map, &keys, &found, lookups]
+			{
+				for (int i = 0; i < lookups; ++i)
+				{
+					found += map.Find(keys[i % keys.size()])->second;
+				}
+			});
+
+			Assert::IsTrue(found > 0);
+			return lookups / time;
+		}
+
+		/// <summary>
+		/// Runs readers threads that look up registered names while one of them periodically registers and unregisters a name
+		/// </summary>
+		/// <returns>The total number of lookups per millisecond across all readers</returns>
+		template<size_t ShardCount>
+		static double MeasureConcurrentLookups(size_t readers)
+		{
+			const int names = 512;
+			const int lookupsPerReader = 100000;
+
+			ConcurrentHashMap<std::string, int, ShardCount> map(names);
+			std::vector<std::string> keys;
+			keys.reserve(names);
+			for (int i = 0; i < names; ++i)
+			{
+				keys.push_back("Type" + std::to_string(i));
+				map.TryEmplace(keys.back(), i);
+			}
+
+			std::atomic<int> found = 0;
+			double time = Time([&map, &keys, &found, readers]
+			{
+				std::vector<std::thread> threads;
+				threads.reserve(readers);
+				for (size_t r = 0; r < readers; ++r)
+				{
+					threads.emplace_back([&map, &keys, &found, r]
+					{
+						const std::string registered = "Registered" + std::to_string(r);
+						int count = 0;
+						for (int i = 0; i < lookupsPerReader; ++i)
+						{
+							if (i % 1000 == 0)
+							{
+								map.TryEmplace(registered, i);
+								map.Remove(registered);
+							}
+
+							map.Visit(keys[(i * 7 + r) % names], [&count](int) { ++count; });
+						}
+						found += count;
+					});
+				}
+
+				for (auto& thread : threads)
+				{
+					thread.join();
+				}
+			});
+
+			Assert::AreEqual(static_cast<int>(readers) * lookupsPerReader, found.load());
+			return (readers * lookupsPerReader) / time;
+		}
+
+		/// <summary>
+		/// Builds a Scope holding a number of entities, each with a name and a position
+		/// </summary>
+		/// <param name="count">The number of entities</param>
+		/// <returns>The Scope holding the entities in its Entities attribute</returns>
+		static Scope CreateEntities(size_t count)
+		{
+			Scope root;
+			for (size_t i = 0; i < count; ++i)
+			{
+				Scope& entity = root.AppendScope("Entities");
+				entity.Append("Name") = "Entity " + std::to_string(i);
+				entity.Append("Position") = glm::vec4(static_cast<float>(i));
+			}
+
+			return root;
+		}
+
+		/// <summary>
+		/// Deletes a Sector full of entities and updates the world until it has been destroyed
+		/// </summary>
+		/// <returns>The longest time a single update took in milliseconds</returns>
+		static double MeasureWorstUpdate(size_t entities, ScopeReclaimer::Microseconds frameBudget)
+		{
+			World world;
+			world.GetReclaimer().SetFrameBudget(frameBudget);
+			world.CreateSector("Kept");
+			Sector* sector = world.CreateSector("Doomed");
+			for (size_t i = 0; i < entities; ++i)
+			{
+				Entity* entity = new Entity;
+				entity->AppendScope("Child").Append("Name") = "Child"s;
+				sector->Adopt(*entity, "Entities");
+			}
+
+			world.MarkScopeForDelete(*sector);
+
+			double worst = 0.0;
+			do
+			{
+				worst = std::max(worst, Time([&world] { world.Update(); }));
+			} while (!world.GetReclaimer().IsEmpty());
+
+			Assert::AreEqual(1_z, world.Sectors().Size());
+			return worst;
+		}
+
+		/// <summary>
+		/// Builds a world file sized document: many nested tables, each with a few attributes
+		/// </summary>
+		/// <param name="count">The number of tables</param>
+		/// <param name="className">The class of each table, empty for plain Scopes</param>
+		/// <returns>The JSON text of the document</returns>
+		static std::string GenerateEntities(size_t count, const std::string& className = std::string())
+		{
+			const std::string classMember = className.empty() ? std::string() : R"("class": ")" + className + R"(", )";
+			std::ostringstream builder;
+			builder << R"({ "Entities": { "table": [)";
+			for (size_t i = 0; i < count; ++i)
+			{
+				builder << (i == 0 ? "" : ",") << "{ " << classMember << R"("table": { "Health": { "integer": )" << i << R"( }, "Name": { "string": "Entity )" << i
+					<< R"json(" }, "Position": { "vector": "vec4(1.0, 2.0, 3.0, 4.0)" }, "Speeds": { "float": [1.5, 2.5, 3.5] } } })json";
+			}
+			builder << "] } }";
+			return builder.str();
+		}
+	};
+}
+
+#endif
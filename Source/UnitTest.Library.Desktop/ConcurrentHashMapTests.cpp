@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "ConcurrentHashMap.h"
+#include "ToStringSpecializations.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace UnitTests;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ConcurrentHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(InsertVisitRemove)
+		{
+			ConcurrentHashMap<std::string, Foo> map(20);
+			Assert::AreEqual(0_z, map.Size());
+			Assert::AreEqual(20_z, map.BucketSize());
+
+			Assert::IsTrue(map.Insert(std::pair(std::string("A"), Foo(1))));
+			const std::pair<const std::string, Foo> b("B", Foo(2));
+			Assert::IsTrue(map.Insert(b));
+			Assert::IsTrue(map.TryEmplace("C", 3));
+			Assert::IsFalse(map.TryEmplace("A", 10));
+			Assert::IsFalse(map.Insert(b));
+			Assert::AreEqual(3_z, map.Size());
+
+			Foo found;
+			Assert::IsTrue(map.Visit("A", [&found](const Foo& foo) { found = foo; }));
+			Assert::AreEqual(Foo(1), found);
+			Assert::IsFalse(map.Visit("D", [&found](const Foo& foo) { found = foo; }));
+			Assert::AreEqual(Foo(1), found);
+			Assert::IsTrue(map.ContainsKey("C"));
+			Assert::IsFalse(map.ContainsKey("D"));
+
+			int sum = 0;
+			map.ForEach([&sum](const std::pair<const std::string, Foo>& pair) { sum += pair.second.Data(); });
+			Assert::AreEqual(6, sum);
+
+			Assert::IsTrue(map.Remove("B"));
+			Assert::IsFalse(map.Remove("B"));
+			Assert::AreEqual(2_z, map.Size());
+
+			map.Resize(3);
+			Assert::AreEqual(8_z, map.BucketSize());
+			Assert::IsTrue(map.ContainsKey("A"));
+			Assert::IsTrue(map.ContainsKey("C"));
+
+			map.Clear();
+			Assert::AreEqual(0_z, map.Size());
+			Assert::IsFalse(map.ContainsKey("A"));
+		}
+
+		TEST_METHOD(ConcurrentReadersAndWriters)
+		{
+			ConcurrentHashMap<int, int> map(64);
+			for (int i = 0; i < 256; ++i)
+			{
+				map.Insert(std::pair(i, i * 2));
+			}
+
+			std::atomic<bool> mismatch = false;
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 4; ++t)
+			{
+				threads.emplace_back([&map, &mismatch]
+				{
+					for (int i = 0; i < 10000; ++i)
+					{
+						int key = i % 256;
+						map.Visit(key, [&mismatch, key](int value)
+						{
+							if (value != key * 2)
+							{
+								mismatch = true;
+							}
+						});
+					}
+				});
+			}
+
+			threads.emplace_back([&map]
+			{
+				for (int i = 256; i < 1256; ++i)
+				{
+					map.Insert(std::pair(i, i * 2));
+					map.Remove(i - 256);
+				}
+			});
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::IsFalse(mismatch);
+			Assert::AreEqual(256_z, map.Size());
+			for (int i = 1000; i < 1256; ++i)
+			{
+				Assert::IsTrue(map.ContainsKey(i));
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ConcurrentHashMapTests::sStartMemState;
+}
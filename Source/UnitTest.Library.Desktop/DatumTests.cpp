@@ -14,6 +14,7 @@
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
 using namespace UnitTests;
+using namespace std::string_literals;
 
 namespace Library
 {
@@ -326,6 +327,91 @@ namespace Library
 		}
 	}
 
+	template<typename T>
+	const T& Front(const Datum& datum)
+	{
+		return datum.Span<T>()[0];
+	}
+
+	template<typename T>
+	void TestCopyOnWrite(std::initializer_list<T> list, const T& replacement)
+	{
+		const T& first = *list.begin();
+		{
+			Datum datum = list;
+			Assert::IsFalse(datum.IsSharedStorage());
+
+			Datum copy(datum);
+			Assert::IsTrue(datum.IsSharedStorage());
+			Assert::IsTrue(copy.IsSharedStorage());
+			Assert::AreEqual(std::as_const(datum).Span<T>().data(), std::as_const(copy).Span<T>().data());
+
+			// Reading does not copy, writing copies only the datum written to
+			Assert::IsTrue(copy == datum);
+			Assert::IsNotNull(std::as_const(copy).Find(first));
+			Assert::IsTrue(copy.IsSharedStorage());
+
+			copy.Set(replacement, 0);
+			Assert::IsFalse(datum.IsSharedStorage());
+			Assert::IsFalse(copy.IsSharedStorage());
+			Assert::AreEqual(first, Front<T>(datum));
+			Assert::AreEqual(replacement, Front<T>(copy));
+			Assert::AreEqual(list.size(), copy.Size());
+		}
+		{
+			Datum datum = list;
+			Datum copy;
+			copy = datum;
+			Datum third = copy;
+
+			third.PushBack(replacement);
+			Assert::AreEqual(list.size() + 1, third.Size());
+			Assert::AreEqual(list.size(), datum.Size());
+			Assert::IsTrue(copy.IsSharedStorage());
+
+			copy.PopBack();
+			Assert::AreEqual(list.size() - 1, copy.Size());
+			Assert::AreEqual(list.size(), datum.Size());
+			Assert::IsFalse(datum.IsSharedStorage());
+
+			copy = datum;
+			Assert::IsTrue(copy.RemoveAt(0));
+			Assert::AreEqual(first, Front<T>(datum));
+
+			copy = datum;
+			Assert::IsTrue(copy.Remove(first));
+			Assert::AreEqual(first, Front<T>(datum));
+
+			copy = datum;
+			copy.Resize(1);
+			Assert::AreEqual(list.size(), datum.Size());
+
+			copy = datum;
+			copy.Clear();
+			Assert::AreEqual(0_z, copy.Size());
+			Assert::AreEqual(list.size(), datum.Size());
+			Assert::IsFalse(datum.IsSharedStorage());
+			copy.PushBack(replacement);
+			Assert::AreEqual(first, Front<T>(datum));
+
+			copy = datum;
+			copy.Span<T>()[0] = replacement;
+			Assert::AreEqual(first, Front<T>(datum));
+
+			copy = datum;
+			*copy.Find(first) = replacement;
+			Assert::AreEqual(first, Front<T>(datum));
+		}
+		{
+			// The storage outlives whichever copy is destroyed first
+			Datum* datum = new Datum(list);
+			Datum copy(*datum);
+			delete datum;
+			Assert::IsFalse(copy.IsSharedStorage());
+			Assert::AreEqual(first, Front<T>(copy));
+		}
+	}
+
 	template<typename T>
 	void TestEquality(std::initializer_list<T> list1, std::initializer_list<T> list2)
 	{
@@ -639,6 +725,51 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(CopyOnWrite)
+		{
+			TestCopyOnWrite({ 5, 6, 7 }, 10);
+			TestCopyOnWrite({ 5.0f, 6.1f, 7.2f }, 10.0f);
+			TestCopyOnWrite({ glm::vec4(1.0f), glm::vec4(2.0f), glm::vec4(3.0f) }, glm::vec4(10.0f));
+			TestCopyOnWrite({ glm::mat4(1.0f), glm::mat4(2.0f), glm::mat4(3.0f) }, glm::mat4(10.0f));
+			TestCopyOnWrite({ std::string("Hello"), std::string("Goodbye"), std::string("Gooday") }, std::string("A string too long for the small string optimization"));
+
+			Datum strings = { std::string("Hello"), std::string("Goodbye") };
+			Datum copy = strings;
+			copy.Set(std::string("Moved"), 1);
+			copy.SetFromString("Parsed", 0);
+			Assert::AreEqual(std::string("Hello"), strings.GetString(0));
+			Assert::AreEqual(std::string("Goodbye"), strings.GetString(1));
+			Assert::AreEqual(std::string("Parsed"), copy.GetString(0));
+
+			int array[3] = { 5, 6, 7 };
+			Datum external;
+			external.SetStorage(array, 3);
+			Datum externalCopy = external;
+			Assert::IsFalse(externalCopy.IsSharedStorage());
+			Assert::IsFalse(external.IsSharedStorage());
+		}
+
+		TEST_METHOD(Hash)
+		{
+			Assert::AreEqual(Datum({ 5, 6, 7 }).Hash(), Datum({ 5, 6, 7 }).Hash());
+			Assert::AreNotEqual(Datum({ 5, 6, 7 }).Hash(), Datum({ 7, 6, 5 }).Hash());
+			Assert::AreNotEqual(Datum({ 5, 6, 7 }).Hash(), Datum({ 5, 6 }).Hash());
+			Assert::AreNotEqual(Datum(5).Hash(), Datum(5.0f).Hash());
+			Assert::AreEqual(Datum(glm::mat4(2.0f)).Hash(), Datum(glm::mat4(2.0f)).Hash());
+			Assert::AreEqual(Datum({ "ab"s, "c"s }).Hash(), Datum({ "ab"s, "c"s }).Hash());
+			Assert::AreNotEqual(Datum({ "ab"s, "c"s }).Hash(), Datum({ "a"s, "bc"s }).Hash());
+			Assert::AreNotEqual(Datum("ab"s).Hash(), Datum("ba"s).Hash());
+			Assert::AreEqual(Datum().Hash(), Datum().Hash());
+
+			int array[2] = { 5, 6 };
+			Datum external;
+			external.SetStorage(array, 2);
+			Assert::AreEqual(Datum({ 5, 6 }).Hash(), external.Hash());
+
+			Foo a(10), b(10);
+			Assert::AreEqual(Datum(&a).Hash(), Datum(&b).Hash());
+		}
+
 		TEST_METHOD(Equality)
 		{
 			TestEquality({ 5, 6, 7 }, { 15, 16, 17, 18 });
@@ -716,6 +847,120 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(MoveSemanticsStrings)
+		{
+			Datum datum;
+			std::string hello = "Hello";
+			datum.PushBack(std::move(hello));
+			Assert::IsTrue(Datum::DatumTypes::String == datum.Type());
+			Assert::AreEqual(std::string("Hello"), datum.GetString());
+
+			std::string& emplaced = datum.EmplaceBack<std::string>(3, 'a');
+			Assert::AreEqual(std::string("aaa"), emplaced);
+			Assert::AreEqual(2_z, datum.Size());
+
+			datum.Set(std::string("Goodbye"), 1);
+			Assert::AreEqual(std::string("Goodbye"), datum.GetString(1));
+			Assert::ExpectException<std::runtime_error>([&datum] { datum.Set(std::string("Goodbye"), 2); });
+
+			Datum intDatum = 10;
+			Assert::ExpectException<std::runtime_error>([&intDatum] { intDatum.PushBack(std::string("Hello")); });
+			Assert::ExpectException<std::runtime_error>([&intDatum] { intDatum.Set(std::string("Hello"), 0); });
+		}
+
+		TEST_METHOD(Span)
+		{
+			Datum datum = { 3, 1, 2 };
+			gsl::span<int> span = datum.Span<int>();
+			Assert::AreEqual(3, static_cast<int>(span.size()));
+
+			std::sort(span.begin(), span.end());
+			Assert::AreEqual(1, datum.GetInt(0));
+			Assert::AreEqual(3, datum.GetInt(2));
+
+			const Datum& constDatum = datum;
+			gsl::span<const int> constSpan = constDatum.Span<int>();
+			Assert::AreEqual(&datum.GetInt(0), constSpan.data());
+
+			Assert::ExpectException<std::runtime_error>([&datum] { datum.Span<float>(); });
+		}
+
+		TEST_METHOD(Version)
+		{
+			Datum datum;
+			Assert::AreEqual(0_z, datum.Version());
+			Assert::AreEqual(0_z, datum.ChangeFrame());
+
+			size_t version = datum.Version();
+			auto assertWritten = [&datum, &version]()
+			{
+				Assert::IsTrue(datum.Version() > version);
+				Assert::AreEqual(Scope::ChangeFrame(), datum.ChangeFrame());
+				version = datum.Version();
+			};
+
+			datum.PushBack(1);
+			assertWritten();
+			datum.Set(2, 0);
+			assertWritten();
+			datum.Resize(4);
+			assertWritten();
+			datum.Clear();
+			assertWritten();
+
+			// Reading through the const interface is not a write
+			datum.PushBack(3);
+			assertWritten();
+			std::as_const(datum).GetInt();
+			std::as_const(datum).Find(3);
+			Assert::AreEqual(version, datum.Version());
+
+			// Nor is reading through a getter, only Edit counts the reference it returns as written
+			datum.GetInt();
+			datum.Span<int>();
+			Assert::AreEqual(version, datum.Version());
+			datum.Edit<int>() = 4;
+			assertWritten();
+			Assert::AreEqual(4, datum.GetInt());
+			Assert::ExpectException<std::runtime_error>([&datum] { datum.Edit<float>(); });
+
+			// A write through a getter is not tracked until it is reported
+			datum.GetInt() = 7;
+			Assert::AreEqual(version, datum.Version());
+			datum.MarkModified();
+			assertWritten();
+			datum.Edit<int>() = 4;
+			assertWritten();
+
+			// A getter that throws leaves shared storage shared
+			Datum shared = datum;
+			Assert::ExpectException<std::runtime_error>([&shared] { shared.GetInt(99); });
+			Assert::ExpectException<std::runtime_error>([&shared] { shared.GetFloat(); });
+			Assert::ExpectException<std::runtime_error>([&shared] { shared.Edit<int>(99); });
+			Assert::IsTrue(shared.IsSharedStorage());
+			Assert::AreEqual(version, datum.Version());
+
+			// Writes to external storage are only seen when they go through the datum, or are reported
+			int32_t external[] = { 1, 2 };
+			Datum externalDatum;
+			externalDatum.SetStorage(external, 2);
+			size_t externalVersion = externalDatum.Version();
+			external[0] = 5;
+			Assert::AreEqual(externalVersion, externalDatum.Version());
+			externalDatum.MarkModified();
+			Assert::IsTrue(externalDatum.Version() > externalVersion);
+
+			// A copy counts its writes on its own
+			Datum copy = datum;
+			copy.Set(4, 0);
+			Assert::AreEqual(version, datum.Version());
+
+			size_t frame = Scope::AdvanceChangeFrame();
+			Assert::AreEqual(frame, Scope::ChangeFrame());
+			datum.Set(5, 0);
+			Assert::AreEqual(frame, datum.ChangeFrame());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
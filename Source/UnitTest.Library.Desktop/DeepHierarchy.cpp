@@ -0,0 +1,14 @@
+#include "pch.h"
+#include "DeepHierarchy.h"
+
+namespace UnitTests
+{
+	RTTI_DEFINITIONS(Level1);
+	RTTI_DEFINITIONS(Level2);
+	RTTI_DEFINITIONS(Level3);
+	RTTI_DEFINITIONS(Level4);
+	RTTI_DEFINITIONS(Level5);
+	RTTI_DEFINITIONS(Level6);
+	RTTI_DEFINITIONS(Level7);
+	RTTI_DEFINITIONS(Level8);
+}
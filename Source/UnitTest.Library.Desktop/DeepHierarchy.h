@@ -0,0 +1,35 @@
+#pragma once
+
+#include "RTTI.h"
+
+namespace UnitTests
+{
+	/// <summary>
+	/// The root of a deep hierarchy for the RTTI tests. WalkIs checks the type the way Is used to, with one virtual call per level
+	/// </summary>
+	class Level1 : public Library::RTTI
+	{
+		RTTI_DECLARATIONS(Level1, Library::RTTI);
+
+	public:
+		virtual bool WalkIs(Library::RTTI::IdType id) const { return id == TypeIdClass(); }
+	};
+
+#define DEEP_LEVEL(Type, ParentType)																			\
+	class Type : public ParentType																				\
+	{																											\
+		RTTI_DECLARATIONS(Type, ParentType);																	\
+	public:																										\
+		bool WalkIs(Library::RTTI::IdType id) const override { return id == TypeIdClass() || ParentType::WalkIs(id); }	\
+	};
+
+	DEEP_LEVEL(Level2, Level1)
+	DEEP_LEVEL(Level3, Level2)
+	DEEP_LEVEL(Level4, Level3)
+	DEEP_LEVEL(Level5, Level4)
+	DEEP_LEVEL(Level6, Level5)
+	DEEP_LEVEL(Level7, Level6)
+	DEEP_LEVEL(Level8, Level7)
+
+#undef DEEP_LEVEL
+}
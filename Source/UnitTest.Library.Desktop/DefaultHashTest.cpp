@@ -2,6 +2,7 @@
 #include "CppUnitTest.h"
 #include "Foo.h"
 #include "DefaultHash.h"
+#include "DefaultEquality.h"
 #include "ToStringSpecializations.h"
 #include <string>
 
@@ -179,6 +180,20 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(CaseInsensitive)
+		{
+			CaseInsensitiveHash hash;
+			CaseInsensitiveEquality equality;
+			std::string a("Integer"), b("INTEGER"), c("integers");
+
+			Assert::AreEqual(hash(a), hash(b));
+			Assert::AreEqual(hash(a), hash("integer"));
+			Assert::AreNotEqual(hash(a), hash(c));
+			Assert::IsTrue(equality(a, b));
+			Assert::IsTrue(equality("integer", a));
+			Assert::IsFalse(equality(a, c));
+			Assert::IsFalse(equality("[nteger", a));
+		}
 
 	private:
 		static _CrtMemState sStartMemState;
@@ -29,11 +29,11 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
-			TypeManager::RegisterType(Entity::TypeIdClass(), Attributed::TypeIdClass(), Entity::GetSignatures());
-			TypeManager::RegisterType(Sector::TypeIdClass(), Attributed::TypeIdClass(), Sector::GetSignatures());
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
 			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
-			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
-			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
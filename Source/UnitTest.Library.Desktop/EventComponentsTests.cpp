@@ -33,17 +33,17 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
-			TypeManager::RegisterType(Entity::TypeIdClass(), Attributed::TypeIdClass(), Entity::GetSignatures());
-			TypeManager::RegisterType(Sector::TypeIdClass(), Attributed::TypeIdClass(), Sector::GetSignatures());
-			TypeManager::RegisterType(World::TypeIdClass(), Attributed::TypeIdClass(), World::GetSignatures());
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
 			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
-			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
-			TypeManager::RegisterType(ActionList::TypeIdClass(), Action::TypeIdClass(), ActionList::GetSignatures());
-			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
-			TypeManager::RegisterType(EventMessageAttributed::TypeIdClass(), Attributed::TypeIdClass(), EventMessageAttributed::GetSignatures());
-			TypeManager::RegisterType(Reaction::TypeIdClass(), ActionList::TypeIdClass(), Reaction::GetSignatures());
-			TypeManager::RegisterType(ReactionAttributed::TypeIdClass(), Reaction::TypeIdClass(), ReactionAttributed::GetSignatures());
-			TypeManager::RegisterType(ActionEvent::TypeIdClass(), Action::TypeIdClass(), ActionEvent::GetSignatures());
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionList, Action>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			AttributeReflection::RegisterType<EventMessageAttributed, Attributed>();
+			AttributeReflection::RegisterType<Reaction, ActionList>();
+			AttributeReflection::RegisterType<ReactionAttributed, Reaction>();
+			AttributeReflection::RegisterType<ActionEvent, Action>();
 
 		}
 
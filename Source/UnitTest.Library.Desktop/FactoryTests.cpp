@@ -6,6 +6,9 @@
 #include "AttributedBar.h"
 #include "TypeManager.h"
 #include "ToStringSpecializations.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -173,6 +176,114 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(Factory<Scope>::Factories().BucketSize(), 41_z);
 		}
 
+		TEST_METHOD(Handles)
+		{
+			Factory<Scope>::Handle handle("AttributedFoo");
+			Assert::AreEqual("AttributedFoo"s, handle.ClassName());
+			Assert::IsNull(handle.Get());
+			Assert::IsNull(Factory<Scope>::Create(handle));
+
+			{
+				AttributedFooFactory fooFactory;
+				Assert::IsTrue(handle.Get() == &fooFactory);
+
+				gsl::owner<Scope*> foo = Factory<Scope>::Create(handle);
+				Assert::IsTrue(foo->Is(AttributedFoo::TypeIdClass()));
+				delete foo;
+
+				// Rebinding to another class looks the new name up
+				AttributedBarFactory barFactory;
+				Assert::IsTrue(handle.Get("AttributedBar") == &barFactory);
+				Assert::AreEqual("AttributedBar"s, handle.ClassName());
+			}
+
+			// A handle notices its factory being removed
+			Assert::IsNull(handle.Get());
+			AttributedBarFactory barFactory;
+			Assert::IsTrue(handle.Get() == &barFactory);
+
+			Factory<Scope>::Handle empty;
+			Assert::IsNull(empty.Get());
+		}
+
+		TEST_METHOD(SharedHandleWhileRemoving)
+		{
+			// Creating through a handle holds the factory's shard lock, so threads sharing it never reach a factory that is being destroyed
+			const Factory<Scope>::Handle handle("AttributedFoo");
+			std::atomic<bool> done = false;
+			std::atomic<bool> mismatch = false;
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 4; ++t)
+			{
+				threads.emplace_back([&handle, &done, &mismatch]
+				{
+					while (!done)
+					{
+						gsl::owner<Scope*> product = Factory<Scope>::Create(handle);
+						if (product != nullptr && !product->Is(AttributedFoo::TypeIdClass()))
+						{
+							mismatch = true;
+						}
+						delete product;
+
+						for (Scope* batched : Factory<Scope>::CreateBatch(handle, 2))
+						{
+							delete batched;
+						}
+					}
+				});
+			}
+
+			for (int i = 0; i < 200; ++i)
+			{
+				AttributedFooFactory fooFactory;
+				std::this_thread::yield();
+			}
+
+			done = true;
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::IsFalse(mismatch);
+			Assert::IsNull(Factory<Scope>::Create(handle));
+		}
+
+		TEST_METHOD(CreateBatch)
+		{
+			AttributedFooFactory fooFactory;
+			Assert::AreEqual(0_z, Factory<Scope>::CreateBatch("AttributedBar", 4).Size());
+
+			Vector<gsl::owner<Scope*>> foos = Factory<Scope>::CreateBatch("AttributedFoo", 5);
+			Assert::AreEqual(5_z, foos.Size());
+			for (size_t i = 0; i < foos.Size(); ++i)
+			{
+				Assert::IsTrue(foos[i]->Is(AttributedFoo::TypeIdClass()));
+				Assert::AreEqual(0, foos[i]->Find("Data")->GetInt());
+				if (i > 0)
+				{
+					// All of them share one allocation
+					Assert::AreEqual(reinterpret_cast<uint8_t*>(foos[1]) - reinterpret_cast<uint8_t*>(foos[0]), reinterpret_cast<uint8_t*>(foos[i]) - reinterpret_cast<uint8_t*>(foos[i - 1]));
+				}
+			}
+
+			// Deleted in any order, the allocation is freed with the last of them
+			delete foos[2];
+			delete foos[0];
+			delete foos[4];
+			delete foos[1];
+			delete foos[3];
+
+			Factory<Scope>::Handle handle("AttributedFoo");
+			Vector<gsl::owner<Scope*>> batch = Factory<Scope>::CreateBatch(handle, 3);
+			Assert::AreEqual(3_z, batch.Size());
+			for (Scope* scope : batch)
+			{
+				delete scope;
+			}
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
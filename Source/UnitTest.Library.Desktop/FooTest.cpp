@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "Foo.h"
+#include "DeepHierarchy.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -98,7 +99,35 @@ namespace UnitTestLibraryDesktop
 			RTTI* rtti = &a;
 			Assert::IsFalse(rtti->Is("Vector"s));
 			Assert::IsTrue(rtti->Is("Foo"s));
-			//Assert::IsTrue()
+			Assert::IsFalse(rtti->Is("RTTI"s));
+			Assert::IsTrue(rtti->Is(Foo::TypeIdClass()));
+			Assert::IsFalse(rtti->Is(RTTI::TypeIdClass()));
+			Assert::IsTrue(rtti->As<Foo>() == &a);
+			Assert::IsTrue(rtti->QueryInterface(Foo::TypeIdClass()) == rtti);
+		}
+
+		TEST_METHOD(RTTIHierarchy)
+		{
+			Level8 deepest;
+			Level4 middle;
+			RTTI* rtti = &deepest;
+
+			const RTTI::IdType ids[] = { Level1::TypeIdClass(), Level2::TypeIdClass(), Level3::TypeIdClass(), Level4::TypeIdClass(),
+				Level5::TypeIdClass(), Level6::TypeIdClass(), Level7::TypeIdClass(), Level8::TypeIdClass() };
+			for (size_t i = 0; i < std::size(ids); ++i)
+			{
+				Assert::IsTrue(rtti->Is(ids[i]));
+				Assert::AreEqual(i < 4, middle.Is(ids[i]));
+				Assert::AreEqual(middle.WalkIs(ids[i]), middle.Is(ids[i]));
+			}
+
+			Assert::IsTrue(rtti->Is("Level1"s));
+			Assert::IsTrue(rtti->Is("Level8"s));
+			Assert::IsFalse(middle.Is("Level5"s));
+			Assert::IsFalse(rtti->Is(Foo::TypeIdClass()));
+			Assert::IsTrue(rtti->As<Level3>() == &deepest);
+			Assert::IsNull(static_cast<RTTI&>(middle).As<Level5>());
+			Assert::IsNull(rtti->QueryInterface(Foo::TypeIdClass()));
 		}
 
 	private:
@@ -3,10 +3,13 @@
 #include "Foo.h"
 #include "HashMap.h"
 #include "ToStringSpecializations.h"
+#include <algorithm>
+#include <cctype>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
 using namespace UnitTests;
+using namespace std::string_literals;
 
 namespace Library
 {
@@ -390,7 +393,323 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TryEmplace)
+		{
+			HashMap<Foo, Foo> map(3);
+			auto [it, inserted] = map.TryEmplace(Foo(0), 10);
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(Foo(10), it->second);
+
+			Foo key(0);
+			std::tie(it, inserted) = map.TryEmplace(key, 20);
+			Assert::IsFalse(inserted);
+			Assert::AreEqual(Foo(10), it->second);
+
+			std::pair<const Foo, Foo> a(Foo(1), Foo(30));
+			std::tie(it, inserted) = map.Insert(std::move(a));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(Foo(30), it->second);
+			Assert::AreEqual(2_z, map.Size());
+		}
+
+		TEST_METHOD(EmplaceAllocations)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			HashMap<Foo, Foo> copyMap(3);
+			HashMap<Foo, Foo> moveMap(3);
+			std::pair<const Foo, Foo> copyPair(Foo(0), Foo(10));
+			Foo moveKey(0);
+			Foo moveData(10);
+
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+
+			sAllocationCount = 0;
+			copyMap.Insert(copyPair);
+			size_t copyAllocations = sAllocationCount;
+
+			sAllocationCount = 0;
+			moveMap.TryEmplace(std::move(moveKey), std::move(moveData));
+			size_t moveAllocations = sAllocationCount;
+
+			_CrtSetAllocHook(previousHook);
+
+			// Copying the pair allocates the node and both Foo's, emplacing only allocates the node
+			Assert::AreEqual(3_z, copyAllocations);
+			Assert::AreEqual(1_z, moveAllocations);
+			Assert::AreEqual(*copyMap.begin(), *moveMap.begin());
+#endif
+		}
+
+		TEST_METHOD(PooledChains)
+		{
+			HashMap<int, int> map(5);
+			for (int i = 0; i < 10; ++i)
+			{
+				map.Insert(std::pair(i, i));
+			}
+
+			// Growing relinks the nodes into the new buckets, so the pairs stay where they are
+			const std::pair<const int, int>* pair = &*map.Find(3);
+			map.Resize(23);
+			Assert::IsTrue(pair == &*map.Find(3));
+
+			HashMap<int, int> copy(map);
+			Assert::AreEqual(map.Size(), copy.Size());
+			Assert::IsTrue(pair != &*copy.Find(3));
+			copy.Resize(7);
+			Assert::AreEqual(3, copy.At(3));
+
+#if defined(DEBUG) || defined(_DEBUG)
+			// The chains share the nodes of the HashMap, so nodes freed in one bucket are reused by any other
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+			sAllocationCount = 0;
+			for (int i = 0; i < 10; ++i)
+			{
+				map.Remove(i);
+				map.Insert(std::pair(i + 100, i));
+			}
+			size_t allocations = sAllocationCount;
+			_CrtSetAllocHook(previousHook);
+
+			Assert::AreEqual(0_z, allocations);
+			Assert::AreEqual(10_z, map.Size());
+#endif
+
+			// An empty HashMap returns its nodes to the heap
+			map.Clear();
+			map.Insert(std::pair(1, 1));
+			Assert::AreEqual(1, map.At(1));
+		}
+
+		TEST_METHOD(TransparentLookup)
+		{
+			const std::string longKey = "ThisKeyIsFarTooLongForTheSmallStringBuffer";
+			HashMap<std::string, int> map(7);
+			map.Insert(std::pair(longKey, 1));
+			map.Insert(std::pair(std::string("Short"), 2));
+
+			const char* cKey = "ThisKeyIsFarTooLongForTheSmallStringBuffer";
+			std::string_view viewKey(longKey);
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+			sAllocationCount = 0;
+#endif
+
+			auto it = map.Find(viewKey);
+			bool containsLiteral = map.ContainsKey("ThisKeyIsFarTooLongForTheSmallStringBuffer");
+			bool containsMissing = map.ContainsKey("ThisKeyIsFarTooLongForTheSmallStringBufferToo");
+			int& atPointer = map.At(cKey);
+
+#if defined(DEBUG) || defined(_DEBUG)
+			size_t allocations = sAllocationCount;
+			_CrtSetAllocHook(previousHook);
+			Assert::AreEqual(0_z, allocations);
+#endif
+
+			Assert::IsTrue(it != map.end());
+			Assert::AreEqual(longKey, it->first);
+			Assert::IsTrue(containsLiteral);
+			Assert::IsFalse(containsMissing);
+			Assert::AreEqual(1, atPointer);
+
+			const HashMap<std::string, int>& constMap = map;
+			Assert::AreEqual(2, constMap.At("Short"));
+			Assert::IsTrue(constMap.Find(std::string_view("Short")) != constMap.end());
+			Assert::IsTrue(constMap.Find("Missing") == constMap.end());
+			Assert::ExpectException<std::runtime_error>([&map] { map.At("Missing"); });
+			Assert::ExpectException<std::runtime_error>([&constMap] { constMap.At(std::string_view("Missing")); });
+
+			// A custom hash can only be called with a std::string, so the lookup falls back to building one
+			DynamicHashMap<std::string, int> customMap(7, [](const std::string& key) { return key.size(); });
+			customMap.Insert(std::pair(longKey, 3));
+			Assert::AreEqual(3, customMap.At(viewKey));
+			Assert::IsFalse(customMap.ContainsKey("Short"));
+		}
+
+		TEST_METHOD(AutomaticGrowth)
+		{
+			HashMap<Foo, Foo> map(3);
+			Assert::AreEqual(2.0f, map.MaxLoadFactor());
+			map.SetMaxLoadFactor(1.0f);
+
+			Vector<const std::pair<const Foo, Foo>*> addresses;
+			for (int i = 0; i < 4; ++i)
+			{
+				addresses.PushBack(&*map.Insert(std::pair(Foo(i), Foo(i * 10))).first);
+			}
+
+			// The fourth insertion exceeded the load factor, so the pairs are migrated over the next few operations
+			Assert::AreEqual(7_z, map.BucketSize());
+			Assert::IsTrue(map.IsRehashing());
+			Assert::AreEqual(4_z, map.Size());
+			Assert::AreEqual(4_z, static_cast<size_t>(std::distance(map.begin(), map.end())));
+			for (int i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(Foo(i * 10), map.At(Foo(i)));
+			}
+
+			for (int i = 4; i < 7; ++i)
+			{
+				map.Insert(std::pair(Foo(i), Foo(i * 10)));
+			}
+
+			Assert::IsFalse(map.IsRehashing());
+			Assert::AreEqual(7_z, map.BucketSize());
+			Assert::AreEqual(1.0f, map.LoadFactor());
+			for (int i = 0; i < 4; ++i)
+			{
+				Assert::IsTrue(&*map.Find(Foo(i)) == addresses[i]);
+			}
+
+			map.Insert(std::pair(Foo(7), Foo(70)));
+			Assert::AreEqual(15_z, map.BucketSize());
+			Assert::IsTrue(map.Remove(Foo(7)));
+			Assert::IsTrue(map.IsRehashing());
+
+			HashMap<Foo, Foo> copy(map);
+			Assert::IsTrue(copy.IsRehashing());
+			Assert::AreEqual(1.0f, copy.MaxLoadFactor());
+			Assert::AreEqual(Foo(30), copy.At(Foo(3)));
+
+			map.Clear();
+			Assert::IsFalse(map.IsRehashing());
+			Assert::AreEqual(15_z, map.BucketSize());
+			Assert::IsTrue(map.begin() == map.end());
+		}
+
+		TEST_METHOD(MigrationFinishesBeforeGrowth)
+		{
+			// ReserveForInsert asserts that no insertion grows the HashMap while pairs are left in the old buckets
+			for (float maxLoadFactor : { 0.1f, 0.5f, 1.0f, 2.0f, 8.0f })
+			{
+				HashMap<int, int> map(1);
+				map.SetMaxLoadFactor(maxLoadFactor);
+
+				size_t growths = 0;
+				for (int i = 0; i < 5000; ++i)
+				{
+					size_t bucketSize = map.BucketSize();
+					map.Insert(std::pair(i, i));
+					if (map.BucketSize() != bucketSize)
+					{
+						++growths;
+					}
+
+					// Lowering the load factor mid migration brings the next growth closer, the remaining buckets are spread over fewer insertions
+					if (i == 2500 && map.IsRehashing())
+					{
+						map.SetMaxLoadFactor(maxLoadFactor / 2.0f);
+					}
+				}
+
+				Assert::IsTrue(growths > 5);
+				Assert::AreEqual(5000_z, map.Size());
+				for (int i = 0; i < 5000; ++i)
+				{
+					Assert::AreEqual(i, map.At(i));
+				}
+			}
+		}
+
+		TEST_METHOD(ResizeKeepsFunctors)
+		{
+			DynamicHashMap<std::string, int> map(3, [](const std::string& key) { return key.size(); });
+			map.Insert(std::pair(std::string("One"), 1));
+			const std::pair<const std::string, int>* address = &*map.Find("One");
+
+			map.Resize(13);
+			Assert::AreEqual(13_z, map.BucketSize());
+			Assert::IsTrue(&*map.Find("One") == address);
+			Assert::AreEqual(1_z, map.LookupLength("Two"));
+		}
+
+		TEST_METHOD(LookupChainLength)
+		{
+			// A HashMap that grows compares no more pairs per lookup than one stuck at 11 buckets
+			for (int count = 10; count <= 10000; count *= 10)
+			{
+				HashMap<std::string, int> growing;
+				HashMap<std::string, int> fixed;
+				fixed.SetMaxLoadFactor(static_cast<float>(count));
+				for (int i = 0; i < count; ++i)
+				{
+					growing.Insert(std::pair("Attribute" + std::to_string(i), i));
+					fixed.Insert(std::pair("Attribute" + std::to_string(i), i));
+				}
+
+				auto [growingMean, growingMax] = MeasureLookupLength(growing, count);
+				auto [fixedMean, fixedMax] = MeasureLookupLength(fixed, count);
+				Assert::IsTrue(growingMean <= fixedMean);
+				Assert::IsTrue(growingMax <= fixedMax);
+				Assert::AreEqual(11_z, fixed.BucketSize());
+			}
+		}
+
+		TEST_METHOD(Policies)
+		{
+			struct LengthHash final
+			{
+				size_t operator()(const std::string& key) const { return key.size(); }
+			};
+
+			struct CaseInsensitiveEquality final
+			{
+				bool operator()(const std::string& lhs, const std::string& rhs) const
+				{
+					return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+				}
+			};
+
+			HashMap<std::string, int, LengthHash, CaseInsensitiveEquality> map(5);
+			map.Insert(std::pair(std::string("Health"), 100));
+			Assert::AreEqual(100, map.At("HEALTH"s));
+			Assert::AreEqual(100, map.At(std::string_view("health")));
+			Assert::IsFalse(map.ContainsKey("Healt"));
+			Assert::AreEqual(1_z, map.LookupLength("Shield"));
+
+			DynamicHashMap<std::string, int> dynamicMap;
+			dynamicMap.Insert(std::pair(std::string("Health"), 100));
+			Assert::AreEqual(100, dynamicMap.At("Health"));
+			Assert::IsFalse(dynamicMap.ContainsKey("HEALTH"));
+
+			// The default policies carry no state, unlike a pair of std::function
+			Assert::IsTrue(sizeof(HashMap<std::string, int>) < sizeof(DynamicHashMap<std::string, int>));
+		}
+
 	private:
+		/// <summary>
+		/// Looks up every attribute inserted by LookupChainLength
+		/// </summary>
+		/// <returns>The mean and max number of pairs compared per lookup</returns>
+		static std::pair<double, size_t> MeasureLookupLength(const HashMap<std::string, int>& map, int count)
+		{
+			size_t total = 0;
+			size_t longest = 0;
+			for (int i = 0; i < count; ++i)
+			{
+				size_t length = map.LookupLength("Attribute" + std::to_string(i));
+				total += length;
+				longest = std::max(longest, length);
+			}
+
+			return std::pair(static_cast<double>(total) / count, longest);
+		}
+
+#if defined(DEBUG) || defined(_DEBUG)
+		static int CountAllocations(int allocType, void*, size_t, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC)
+			{
+				++sAllocationCount;
+			}
+
+			return 1;
+		}
+
+		inline static size_t sAllocationCount = 0;
+#endif
+
 		static _CrtMemState sStartMemState;
 	};
 
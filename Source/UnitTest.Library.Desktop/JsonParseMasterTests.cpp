@@ -2,10 +2,14 @@
 #include "CppUnitTest.h"
 #include "JsonParseMaster.h"
 #include "IJsonParseHelper.h"
+#include "KeyedParseHelper.h"
+#include "JsonStreamReader.h"
+#include "MemoryMappedFile.h"
 #include "Stack.h"
 #include <fstream>
 #include <istream>
 #include <iostream>
+#include <sstream>
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -459,6 +463,299 @@ namespace UnitTestLibraryDesktop
 			delete parseMaster3;
 		}
 
+		TEST_METHOD(StreamParser)
+		{
+			TestParseHelper::TestSharedData sharedData;
+			TestParseHelper parseHelper;
+			JsonParseMaster parseMaster(sharedData);
+			parseMaster.AddHelper(parseHelper);
+			Assert::IsTrue(parseMaster.GetParseMode() == JsonParseMaster::ParseMode::Document);
+			parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+			Assert::IsTrue(parseMaster.GetParseMode() == JsonParseMaster::ParseMode::Stream);
+
+			const std::string rawJson = R"({
+				"mInt": 20, 
+				"mFloat": 5.5, 
+				"mString": "Hello", 
+				"mArray": [1, 2, 3, 4, 5, 6], 
+				"mObject" : { "mInt" : 30 },
+				"mObjectArray": [
+					{ "mInt" : 30 },
+					{ "mObject" : { "mString" : "Goodbye" } }
+				],
+				"mEmpty": {},
+				"mEmptyArray": []
+			})";
+
+			parseMaster.Parse(rawJson);
+			Assert::AreEqual(sharedData.mStartHandlersCalled, 15_z);
+			Assert::AreEqual(sharedData.mEndHandlersCalled, 15_z);
+			Assert::AreEqual(sharedData.mMaxDepth, 3_z);
+			Assert::AreEqual(sharedData.Depth(), 0_z);
+		}
+
+		TEST_METHOD(StreamBaz)
+		{
+			Baz baz;
+			BazParseHelper::BazSharedData sharedData(&baz);
+			JsonParseMaster parseMaster(sharedData);
+			BazParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+			parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+
+			// Objects no helper accepts are skipped along with everything in them
+			const std::string rawJson = R"({"mObject": {"mInt": 99, "mArray": [[7], {"mInt": 98}]}, "mInt": -20, "mFloat": 5.5e0, "mString": "Tab\t\"Quote\" é😀", "mArray": [1, 2, 3, 4, 5, 6], "mFlags": [true, false, null]})";
+
+			parseMaster.Parse(rawJson);
+			Assert::IsTrue(parseHelper.mInitialized);
+			Assert::AreEqual(baz.mInt, -20);
+			Assert::AreEqual(baz.mFloat, 5.5f);
+			Assert::AreEqual(baz.mString, "Tab\t\"Quote\" \xC3\xA9\xF0\x9F\x98\x80"s);
+			Assert::AreEqual(sharedData.Depth(), 0_z);
+
+			int testArray[] = { 1, 2, 3, 4, 5, 6 };
+			for (size_t i = 0; i < Baz::ArraySize; ++i)
+			{
+				Assert::AreEqual(baz.mArray[i], testArray[i]);
+			}
+
+			// Clones parse the same way as the parser they were cloned from
+			JsonParseMaster* clone = parseMaster.Clone();
+			Assert::IsTrue(clone->GetParseMode() == JsonParseMaster::ParseMode::Stream);
+			clone->GetSharedData()->As<BazParseHelper::BazSharedData>()->SetBaz(&baz);
+			clone->Parse(R"({"mInt": 7})"s);
+			Assert::AreEqual(baz.mInt, 7);
+			delete clone;
+		}
+
+		TEST_METHOD(StreamErrors)
+		{
+			Baz baz;
+			BazParseHelper::BazSharedData sharedData(&baz);
+			JsonParseMaster parseMaster(sharedData);
+			BazParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+			parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+
+			const std::string malformed[] =
+			{
+				R"([1, 2])",
+				R"({"mInt": 20,})",
+				R"({"mObject": {"mInt": 20})",
+				R"({"mString": "Unterminated})",
+				R"({"mInt": 2x})",
+				R"({"mString": "\q"})",
+				R"({"mInt": tru})",
+				R"({"mInt": 20} {})",
+				""
+			};
+
+			for (const std::string& rawJson : malformed)
+			{
+				Assert::ExpectException<std::runtime_error>([&parseMaster, &rawJson] { parseMaster.Parse(rawJson); });
+				Assert::AreEqual(sharedData.Depth(), 0_z);
+			}
+		}
+
+		TEST_METHOD(StreamReader)
+		{
+			// A buffer of a few characters makes every token straddle a refill
+			std::istringstream stream("{ \"key\" :\n[ 12345678901, 18446744073709551615, -0.25, \"long string value\" ], \"skipped\": {\"a\": [1, {\"b\": null}]} }");
+			JsonStreamReader reader(stream, 3);
+
+			std::string key;
+			Json::Value value;
+			reader.Expect('{');
+			reader.ReadString(key);
+			Assert::AreEqual("key"s, key);
+			reader.Expect(':');
+			Assert::AreEqual(1_z, reader.Line());
+			reader.Expect('[');
+			Assert::AreEqual(2_z, reader.Line());
+
+			reader.ReadScalar(value);
+			Assert::IsTrue(value.isInt64());
+			Assert::AreEqual(12345678901LL, static_cast<long long>(value.asInt64()));
+			reader.Expect(',');
+			reader.ReadScalar(value);
+			Assert::IsTrue(value.isUInt64());
+			Assert::IsFalse(value.isInt64());
+			reader.Expect(',');
+			reader.ReadScalar(value);
+			Assert::IsTrue(value.isDouble());
+			Assert::AreEqual(-0.25, value.asDouble());
+			reader.Expect(',');
+			reader.ReadScalar(value);
+			Assert::AreEqual("long string value"s, value.asString());
+			Assert::IsFalse(reader.ConsumeIf(','));
+			reader.Expect(']');
+
+			reader.Expect(',');
+			reader.ReadString(key);
+			reader.Expect(':');
+			reader.SkipValue();
+			reader.Expect('}');
+			Assert::IsTrue(reader.AtEnd());
+			Assert::AreEqual('\0', reader.Peek());
+		}
+
+		TEST_METHOD(StreamFile)
+		{
+			{
+				std::ofstream file("ParseTest.json");
+				file << "{\n\t\"mInt\": 20,\n\t\"mFloat\": 5.5,\n\t\"mString\": \"A string long enough to span a few words, with an \\\"escape\\\" in it\",\n\t\"mArray\": [1, 2, 3, 4, 5, 6]\n}";
+			}
+
+			const JsonParseMaster::ParseMode modes[] = { JsonParseMaster::ParseMode::Document, JsonParseMaster::ParseMode::Stream };
+			for (JsonParseMaster::ParseMode mode : modes)
+			{
+				Baz baz;
+				BazParseHelper::BazSharedData sharedData(&baz);
+				JsonParseMaster parseMaster(sharedData);
+				BazParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.SetParseMode(mode);
+
+				parseMaster.ParseFromFile("ParseTest.json");
+				Assert::AreEqual("ParseTest.json"s, parseMaster.GetFileName());
+				Assert::AreEqual(baz.mInt, 20);
+				Assert::AreEqual(baz.mFloat, 5.5f);
+				Assert::AreEqual(baz.mString, "A string long enough to span a few words, with an \"escape\" in it"s);
+				Assert::AreEqual(baz.mArray[5], 6);
+				Assert::AreEqual(sharedData.Depth(), 0_z);
+
+				Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseFromFile("MissingParseTest.json"); });
+			}
+
+			{
+				std::ofstream file("ParseTest.json");
+				file << R"({"mInt": 20, "mFloat": )";
+			}
+
+			Baz baz;
+			BazParseHelper::BazSharedData sharedData(&baz);
+			JsonParseMaster parseMaster(sharedData);
+			BazParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseFromFile("ParseTest.json"); });
+			parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseFromFile("ParseTest.json"); });
+		}
+
+		TEST_METHOD(MappedFile)
+		{
+			const std::string contents = "{ \"mInt\": 20 }";
+			{
+				std::ofstream file("MappedTest.json", std::ios::binary);
+				file << contents;
+			}
+			{
+				std::ofstream file("EmptyMappedTest.json", std::ios::binary);
+			}
+
+			MemoryMappedFile file("MappedTest.json");
+			Assert::AreEqual(contents.size(), file.Size());
+			Assert::AreEqual(contents, std::string(file.Data(), file.Size()));
+
+			MemoryMappedFile movedFile(std::move(file));
+			Assert::IsNull(file.Data());
+			Assert::AreEqual(0_z, file.Size());
+			Assert::AreEqual(contents, std::string(movedFile.Data(), movedFile.Size()));
+
+			MemoryMappedFile emptyFile("EmptyMappedTest.json");
+			Assert::IsNull(emptyFile.Data());
+			Assert::AreEqual(0_z, emptyFile.Size());
+			emptyFile = std::move(movedFile);
+			Assert::AreEqual(contents.size(), emptyFile.Size());
+
+			Assert::ExpectException<std::runtime_error>([] { MemoryMappedFile missingFile("MissingMappedTest.json"); });
+		}
+
+		TEST_METHOD(MemoryReader)
+		{
+			// Strings are scanned a word at a time, so the special characters are placed at every offset within a word
+			const std::string rawJson = "{\n  \"a\": \"0123456\\\"89abcdef\\\\\",\n  \"b\": \"\\u00e9abcdefghijklmnop\\n\",\r\n\t\"c\": \"x\"\n}";
+			JsonStreamReader reader(rawJson.data(), rawJson.size());
+
+			std::string text;
+			reader.Expect('{');
+			reader.ReadString(text);
+			Assert::AreEqual(2_z, reader.Line());
+			reader.Expect(':');
+			reader.ReadString(text);
+			Assert::AreEqual("0123456\"89abcdef\\"s, text);
+			reader.Expect(',');
+			reader.ReadString(text);
+			Assert::AreEqual("b"s, text);
+			reader.Expect(':');
+			reader.ReadString(text);
+			Assert::AreEqual("\xC3\xA9" "abcdefghijklmnop\n"s, text);
+			reader.Expect(',');
+			reader.ReadString(text);
+			Assert::AreEqual(4_z, reader.Line());
+			reader.Expect(':');
+			reader.SkipValue();
+			reader.Expect('}');
+			Assert::IsTrue(reader.AtEnd());
+			Assert::AreEqual(5_z, reader.Line());
+
+			// A newline can't appear unescaped in a string, it still counts as a line
+			const std::string brokenJson = "\"abcdefgh\nijklmnop\"";
+			JsonStreamReader brokenReader(brokenJson.data(), brokenJson.size());
+			brokenReader.ReadString(text);
+			Assert::AreEqual(2_z, brokenReader.Line());
+
+			JsonStreamReader emptyReader(nullptr, 0);
+			Assert::IsTrue(emptyReader.AtEnd());
+			Assert::ExpectException<std::runtime_error>([&emptyReader] { emptyReader.Expect('{'); });
+		}
+
+		TEST_METHOD(KeyedDispatch)
+		{
+			const JsonParseMaster::ParseMode modes[] = { JsonParseMaster::ParseMode::Document, JsonParseMaster::ParseMode::Stream };
+			for (JsonParseMaster::ParseMode mode : modes)
+			{
+				TestParseHelper::TestSharedData sharedData;
+				JsonParseMaster parseMaster(sharedData);
+				parseMaster.SetParseMode(mode);
+				KeyedParseHelper<0> keyedHelper0;
+				TestParseHelper testHelper;
+				KeyedParseHelper<1> keyedHelper1;
+				parseMaster.AddHelper(keyedHelper0);
+				parseMaster.AddHelper(testHelper);
+				parseMaster.AddHelper(keyedHelper1);
+
+				// Helpers are offered only their own keys, regardless of case, alongside the helpers that declared none, in the order they were added
+				const std::string rawJson = R"({"mKey0": 1, "MKEY1": 2, "mOther": 3, "mObject": {"mkey0": 4}, "mArray": [5, 6]})";
+				parseMaster.Parse(rawJson);
+				Assert::AreEqual(2_z, keyedHelper0.mOffered);
+				Assert::AreEqual(2_z, keyedHelper0.mHandled);
+				Assert::AreEqual(0_z, keyedHelper1.mOffered);
+				Assert::AreEqual(5_z, sharedData.mStartHandlersCalled);
+
+				// The clone gets its own copy of the table
+				JsonParseMaster* clone = parseMaster.Clone();
+				clone->Parse(rawJson);
+				const KeyedParseHelper<0>* clonedHelper0 = clone->Helpers()[0]->As<KeyedParseHelper<0>>();
+				Assert::IsNotNull(clonedHelper0);
+				Assert::AreEqual(2_z, clonedHelper0->mHandled);
+				Assert::AreEqual(5_z, clone->GetSharedData()->As<TestParseHelper::TestSharedData>()->mStartHandlersCalled);
+				delete clone;
+
+				// Once the catch all helper is gone, keys no helper declared are offered to nobody
+				parseMaster.RemoveHelper(testHelper);
+				parseMaster.Parse(rawJson);
+				Assert::AreEqual(3_z, keyedHelper0.mOffered);
+				Assert::AreEqual(1_z, keyedHelper1.mOffered);
+				Assert::AreEqual(1_z, keyedHelper1.mHandled);
+				Assert::AreEqual(5_z, sharedData.mStartHandlersCalled);
+
+				JsonParseMaster movedParseMaster(std::move(parseMaster));
+				movedParseMaster.Parse(rawJson);
+				Assert::AreEqual(2_z, keyedHelper1.mHandled);
+			}
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
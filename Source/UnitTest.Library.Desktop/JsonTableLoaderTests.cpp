@@ -0,0 +1,245 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Factory.h"
+#include "TypeManager.h"
+#include "Avatar.h"
+#include "Sector.h"
+#include "World.h"
+#include "JsonTableParseHelper.h"
+#include "JsonTableLoader.h"
+#include "JsonParseMaster.h"
+#include "ToStringSpecializations.h"
+#include <fstream>
+#include <sstream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace Library
+{
+	class LoaderSharedData : public JsonParseMaster::SharedData
+	{
+		RTTI_DECLARATIONS(LoaderSharedData, JsonParseMaster::SharedData);
+
+	public:
+
+		LoaderSharedData* Create() override
+		{
+			return new LoaderSharedData;
+		}
+	};
+
+	RTTI_DEFINITIONS(LoaderSharedData);
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(JsonTableLoaderTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
+			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Construction)
+		{
+			JsonTableParseHelper::TableSharedData sharedData;
+			JsonParseMaster parseMaster(sharedData);
+
+			JsonTableLoader loader(parseMaster, 3);
+			Assert::AreEqual(3_z, loader.ThreadCount());
+			Assert::AreEqual(0_z, loader.Size());
+			Assert::AreEqual(0_z, loader.Load().Size());
+
+			loader.AddFragment(R"({ "Name": { "string": "A" } })");
+			loader.AddFile("Content/SectorTest.json");
+			Assert::AreEqual(2_z, loader.Size());
+			loader.Clear();
+			Assert::AreEqual(0_z, loader.Size());
+
+			JsonTableLoader defaultLoader(parseMaster);
+			Assert::IsTrue(defaultLoader.ThreadCount() > 0);
+
+			LoaderSharedData otherSharedData;
+			JsonParseMaster otherParseMaster(otherSharedData);
+			Assert::ExpectException<std::runtime_error>([&otherParseMaster] { JsonTableLoader otherLoader(otherParseMaster); });
+		}
+
+		TEST_METHOD(LoadSectors)
+		{
+			EntityFactory entityFactory;
+			AvatarFactory avatarFactory;
+			SectorFactory sectorFactory;
+
+			JsonTableParseHelper::TableSharedData sharedData;
+			JsonParseMaster parseMaster(sharedData);
+			JsonTableParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+
+			// Half of the sectors come from files and half from fragments, interleaved so the order they are adopted in shows
+			const size_t sectorCount = 8;
+			JsonTableLoader parallelLoader(parseMaster, 4);
+			JsonTableLoader serialLoader(parseMaster, 1);
+			for (size_t i = 0; i < sectorCount; ++i)
+			{
+				const std::string rawJson = GenerateSector(i, i + 1);
+				if (i % 2 == 0)
+				{
+					const std::string filename = "LoaderSector" + std::to_string(i) + ".json";
+					std::ofstream file(filename);
+					file << rawJson;
+					file.close();
+
+					parallelLoader.AddFile(filename, "Sector");
+					serialLoader.AddFile(filename, "Sector");
+				}
+				else
+				{
+					parallelLoader.AddFragment(rawJson, "Sector");
+					serialLoader.AddFragment(rawJson, "Sector");
+				}
+			}
+
+			World world;
+			World serialWorld;
+			parallelLoader.LoadInto(world, "Sectors");
+			serialLoader.LoadInto(serialWorld, "Sectors");
+
+			Assert::AreEqual(sectorCount, world.Sectors().Size());
+			for (size_t i = 0; i < sectorCount; ++i)
+			{
+				Sector* sector = world.Sectors().GetScope(i)->As<Sector>();
+				Assert::IsNotNull(sector);
+				Assert::IsTrue(sector->GetWorld() == &world);
+				Assert::AreEqual("Sector " + std::to_string(i), sector->Name());
+				Assert::AreEqual(i + 1, sector->Entities().Size());
+				Assert::IsTrue(sector->Entities().GetScope(i)->Is(Avatar::TypeIdClass()));
+				Assert::IsTrue(*sector == *serialWorld.Sectors().GetScope(i));
+			}
+
+			// The loaders keep their sources, loading again adds another copy of every sector
+			parallelLoader.LoadInto(world, "Sectors");
+			Assert::AreEqual(sectorCount * 2, world.Sectors().Size());
+			Assert::IsTrue(*world.Sectors().GetScope(sectorCount) == *world.Sectors().GetScope(0));
+		}
+
+		TEST_METHOD(LoadScopes)
+		{
+			JsonTableParseHelper::TableSharedData sharedData;
+			JsonParseMaster parseMaster(sharedData);
+			JsonTableParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+			parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+
+			JsonTableLoader loader(parseMaster, 2);
+			loader.AddFragment(R"({ "Health": { "integer": 1 } })");
+			loader.AddFragment(R"({ "Health": { "integer": 2 }, "Powers": { "table": { "Flight": { "float": 2.5 } } } })");
+			loader.AddFragment(R"({ "Health": { "integer": 3 } })");
+
+			Vector<Scope*> roots = loader.Load();
+			Assert::AreEqual(3_z, roots.Size());
+			for (size_t i = 0; i < roots.Size(); ++i)
+			{
+				Assert::IsNull(roots[i]->GetParent());
+				Assert::AreEqual(static_cast<int>(i + 1), roots[i]->operator[]("Health").GetInt());
+			}
+			Assert::AreEqual(2.5f, roots[1]->operator[]("Powers").GetScope()->operator[]("Flight").GetFloat());
+
+			for (Scope* root : roots)
+			{
+				delete root;
+			}
+
+			// The prototype parse master is only cloned, never used
+			Assert::IsNull(sharedData.GetScope());
+			Assert::AreEqual(0_z, sharedData.Depth());
+		}
+
+		TEST_METHOD(LoadErrors)
+		{
+			EntityFactory entityFactory;
+			AvatarFactory avatarFactory;
+			SectorFactory sectorFactory;
+
+			JsonTableParseHelper::TableSharedData sharedData;
+			JsonParseMaster parseMaster(sharedData);
+			JsonTableParseHelper parseHelper;
+			parseMaster.AddHelper(parseHelper);
+
+			const ParseModeList modes = { JsonParseMaster::ParseMode::Document, JsonParseMaster::ParseMode::Stream };
+			for (JsonParseMaster::ParseMode mode : modes)
+			{
+				parseMaster.SetParseMode(mode);
+				World world;
+
+				JsonTableLoader malformedLoader(parseMaster, 4);
+				for (size_t i = 0; i < 6; ++i)
+				{
+					malformedLoader.AddFragment(i == 3 ? R"({ "Name": { "string": "Broken" )" : GenerateSector(i, 2), "Sector");
+				}
+				Assert::ExpectException<std::runtime_error>([&malformedLoader, &world] { malformedLoader.LoadInto(world, "Sectors"); });
+				Assert::AreEqual(0_z, world.Sectors().Size());
+
+				JsonTableLoader unknownClassLoader(parseMaster, 4);
+				unknownClassLoader.AddFragment(GenerateSector(0, 1), "Sector");
+				unknownClassLoader.AddFragment(GenerateSector(1, 1), "Planet");
+				Assert::ExpectException<std::runtime_error>([&unknownClassLoader, &world] { unknownClassLoader.LoadInto(world, "Sectors"); });
+
+				JsonTableLoader missingFileLoader(parseMaster, 4);
+				missingFileLoader.AddFile("MissingLoaderSector.json", "Sector");
+				Assert::ExpectException<std::runtime_error>([&missingFileLoader, &world] { missingFileLoader.LoadInto(world, "Sectors"); });
+				Assert::AreEqual(0_z, world.Sectors().Size());
+			}
+		}
+
+	private:
+		using ParseModeList = std::initializer_list<JsonParseMaster::ParseMode>;
+
+		/// <summary>
+		/// Builds the JSON of a sector fragment holding a number of avatars
+		/// </summary>
+		/// <param name="index">The index in the name of the sector</param>
+		/// <param name="entityCount">The number of avatars in the sector</param>
+		/// <returns>The JSON text of the fragment</returns>
+		static std::string GenerateSector(size_t index, size_t entityCount)
+		{
+			std::ostringstream builder;
+			builder << R"({ "Name": { "string": "Sector )" << index << R"(" }, "Entities": { "table": [)";
+			for (size_t i = 0; i < entityCount; ++i)
+			{
+				builder << (i == 0 ? "" : ",") << R"({ "class": "Avatar", "table": { "Name": { "string": "Avatar )" << i << R"(" }, "Health": { "integer": )" << i << " } } }";
+			}
+			builder << "] } }";
+			return builder.str();
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState JsonTableLoaderTests::sStartMemState;
+}
@@ -369,6 +369,120 @@ namespace UnitTestLibraryDesktop
 			delete createdParseHelper;
 		}
 
+		TEST_METHOD(StreamMatchesDocument)
+		{
+			TypeManager::RegisterType(AttributedFoo::TypeIdClass(), Attributed::TypeIdClass(), AttributedFoo::GetSignatures());
+			AttributedFooFactory fooFactory;
+
+			// Members are written in alphabetical order, the order Document mode visits them in, so both modes build the same Scope
+			const std::string rawJson = R"(
+				{
+					"Foo": { "class": "AttributedFoo", "table": { "Data": { "integer": 10 }, "ExternalString": { "string": "\u00e9t\u00e9" } } },
+					"Health": { "integer": [1, 2, 3] },
+					"Powers":
+					{
+						"table":
+						[
+							{ "table": { "Flight": { "integer": 1 } } },
+							{ "table": { "Strength": { "table": { "Normal": { "integer": 1 }, "Super": { "float": 2.5 } } } } }
+						]
+					}
+				})";
+
+			Scope document;
+			{
+				JsonTableParseHelper::TableSharedData sharedData(&document);
+				JsonParseMaster parseMaster(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.Parse(rawJson);
+			}
+
+			Scope streamed;
+			{
+				JsonTableParseHelper::TableSharedData sharedData(&streamed);
+				JsonParseMaster parseMaster(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.SetParseMode(JsonParseMaster::ParseMode::Stream);
+				parseMaster.Parse(rawJson);
+			}
+
+			Assert::IsTrue(streamed["Foo"].GetScope()->Is(AttributedFoo::TypeIdClass()));
+			Assert::AreEqual("\xC3\xA9t\xC3\xA9"s, streamed["Foo"].GetScope()->operator[]("ExternalString").GetString());
+			Assert::AreEqual(2.5f, streamed["Powers"].GetScope(1)->operator[]("Strength").GetScope()->operator[]("Super").GetFloat());
+			Assert::IsTrue(document == streamed);
+
+			TypeManager::Clear();
+		}
+
+		TEST_METHOD(ClassAfterTable)
+		{
+			TypeManager::RegisterType(AttributedFoo::TypeIdClass(), Attributed::TypeIdClass(), AttributedFoo::GetSignatures());
+			AttributedFooFactory fooFactory;
+
+			const std::string classFirst = R"(
+				{
+					"Foo": { "class": "AttributedFoo", "table": { "Data": { "integer": 10 }, "Inventory": { "table": { "Gold": { "integer": 5 } } } } },
+					"Foos":
+					{
+						"table":
+						[
+							{ "class": "AttributedFoo", "table": { "Data": { "integer": 1 }, "ExternalString": { "string": "First" } } },
+							{ "class": "AttributedFoo", "table": { "Data": { "integer": 2 }, "Name": { "string": "Second" } } }
+						]
+					}
+				})";
+
+			// The same content with the class of every object after its table, which only Stream mode visits in that order
+			const std::string tableFirst = R"(
+				{
+					"Foo": { "table": { "Data": { "integer": 10 }, "Inventory": { "table": { "Gold": { "integer": 5 } } } }, "class": "AttributedFoo" },
+					"Foos":
+					{
+						"table":
+						[
+							{ "table": { "Data": { "integer": 1 }, "ExternalString": { "string": "First" } }, "class": "AttributedFoo" },
+							{ "class": "AttributedFoo", "table": { "Data": { "integer": 2 }, "Name": { "string": "Second" } } }
+						]
+					}
+				})";
+
+			auto parse = [](const std::string& rawJson, JsonParseMaster::ParseMode mode, Scope& scope)
+			{
+				JsonTableParseHelper::TableSharedData sharedData(&scope);
+				JsonParseMaster parseMaster(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.SetParseMode(mode);
+				parseMaster.Parse(rawJson);
+			};
+
+			Scope expected;
+			parse(classFirst, JsonParseMaster::ParseMode::Document, expected);
+
+			for (JsonParseMaster::ParseMode mode : { JsonParseMaster::ParseMode::Document, JsonParseMaster::ParseMode::Stream })
+			{
+				Scope scope;
+				parse(tableFirst, mode, scope);
+
+				Assert::AreEqual(1_z, scope["Foo"].Size());
+				Scope& foo = *scope["Foo"].GetScope();
+				Assert::IsTrue(foo.Is(AttributedFoo::TypeIdClass()));
+				Assert::AreEqual(10, static_cast<const AttributedFoo&>(foo).Data());
+				Assert::AreEqual(5, foo["Inventory"].GetScope()->operator[]("Gold").GetInt());
+				Assert::IsTrue(foo["Inventory"].GetScope()->GetParent() == &foo);
+
+				Assert::AreEqual(2_z, scope["Foos"].Size());
+				Assert::AreEqual(1, scope["Foos"].GetScope(0)->operator[]("Data").GetInt());
+				Assert::AreEqual("First"s, static_cast<AttributedFoo*>(scope["Foos"].GetScope(0))->mExternalString);
+				Assert::AreEqual(2, scope["Foos"].GetScope(1)->operator[]("Data").GetInt());
+				Assert::IsTrue(scope == expected);
+			}
+
+			TypeManager::Clear();
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
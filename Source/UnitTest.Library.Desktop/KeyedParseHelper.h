@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include "IJsonParseHelper.h"
+#include "DefaultEquality.h"
+
+namespace UnitTests
+{
+	/// <summary>
+	/// Handles the scalar members with a single key, mKey followed by Id, and counts the members it was offered.
+	/// Each Id is a separate type, so any number of them can be added to one parse master
+	/// </summary>
+	template<size_t Id>
+	class KeyedParseHelper final : public Library::IJsonParseHelper
+	{
+		RTTI_DECLARATIONS(KeyedParseHelper, Library::IJsonParseHelper);
+
+	public:
+
+		inline static const std::string Key = "mKey" + std::to_string(Id);
+
+		explicit KeyedParseHelper(bool declaresKey = true) : mDeclaresKey(declaresKey) {}
+
+		IJsonParseHelper* Create() override
+		{
+			return new KeyedParseHelper(mDeclaresKey);
+		}
+
+		void GetHandledKeys(Library::Vector<std::string>& keys) const override
+		{
+			// Declared twice, the helper must still be offered each member once
+			if (mDeclaresKey)
+			{
+				keys.PushBack(Key);
+				keys.PushBack(Key);
+			}
+		}
+
+		bool HandlesValueKind(ValueKind kind) const override
+		{
+			return kind == ValueKind::Scalar;
+		}
+
+		bool StartHandler(Library::JsonParseMaster::SharedData&, const std::string& jsonKey, Json::Value& object, bool, size_t) override
+		{
+			++mOffered;
+			return !object.isObject() && Library::CaseInsensitiveEquality()(jsonKey, Key);
+		}
+
+		bool EndHandler(Library::JsonParseMaster::SharedData&, const std::string&) override
+		{
+			++mHandled;
+			return true;
+		}
+
+		size_t mOffered = 0;
+		size_t mHandled = 0;
+
+	private:
+		bool mDeclaresKey;
+	};
+
+	template<size_t Id>
+	Library::RTTI::IdType KeyedParseHelper<Id>::TypeIdInstance() const
+	{
+		return TypeIdClass();
+	}
+}
@@ -450,7 +450,125 @@ namespace UnitTestLibraryDesktop
 
 #pragma endregion
 
+		TEST_METHOD(Emplace)
+		{
+			SList<Foo> list;
+			list.EmplaceBack(20);
+			list.EmplaceFront(10);
+			Assert::AreEqual(2_z, list.Size());
+			Assert::AreEqual(Foo(10), list.Front());
+			Assert::AreEqual(Foo(20), list.Back());
+
+			Foo a(30);
+			auto it = list.PushBack(std::move(a));
+			Assert::AreEqual(Foo(30), *it);
+			Assert::AreEqual(Foo(30), list.Back());
+
+			Foo b(0);
+			it = list.PushFront(std::move(b));
+			Assert::AreEqual(Foo(0), *it);
+			Assert::AreEqual(4_z, list.Size());
+		}
+
+		TEST_METHOD(NodeReuse)
+		{
+			SList<int> list;
+			for (int i = 0; i < 100; ++i)
+			{
+				list.PushBack(i);
+			}
+			list.Clear();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+			sAllocationCount = 0;
+#endif
+
+			for (int i = 0; i < 100; ++i)
+			{
+				list.PushFront(i);
+				list.PushBack(i);
+				list.PopFront();
+			}
+			list.InsertAfter(10, list.begin());
+			list.Remove(10);
+
+#if defined(DEBUG) || defined(_DEBUG)
+			size_t allocations = sAllocationCount;
+			_CrtSetAllocHook(previousHook);
+
+			// Nodes released by Clear and PopFront are handed out again without touching the heap
+			Assert::AreEqual(0_z, allocations);
+#endif
+
+			Assert::AreEqual(100_z, list.Size());
+			Assert::AreEqual(0, list.Front());
+			Assert::AreEqual(99, list.Back());
+
+			list.ShrinkToFit();
+			Assert::AreEqual(100_z, list.Size());
+			list.Clear();
+			list.ShrinkToFit();
+			list.PushBack(1);
+			Assert::AreEqual(1, list.Front());
+		}
+
+		TEST_METHOD(SharedNodes)
+		{
+			using SharedList = SList<int, Library::SharedNodes>;
+			SharedList::NodePool nodePool;
+			SharedList source;
+			SharedList destination;
+			Assert::ExpectException<std::runtime_error>([&source] { source.PushBack(0); });
+
+			source.SetNodePool(nodePool);
+			destination.SetNodePool(nodePool);
+			for (int i = 1; i <= 3; ++i)
+			{
+				source.PushBack(i);
+			}
+			const int* front = &source.Front();
+
+			// The node is relinked, so the data stays where it is
+			source.TransferFront(destination);
+			Assert::AreEqual(2_z, source.Size());
+			Assert::AreEqual(1_z, destination.Size());
+			Assert::IsTrue(front == &destination.Front());
+			Assert::AreEqual(4_z, nodePool.Capacity());
+
+			// Nodes freed by one list are reused by the other
+			destination.Clear();
+			source.PushBack(4);
+			source.PushBack(5);
+			Assert::AreEqual(4_z, nodePool.Capacity());
+
+			SharedList::NodePool otherPool;
+			SharedList other;
+			other.SetNodePool(otherPool);
+			Assert::ExpectException<std::runtime_error>([&source, &other] { source.TransferFront(other); });
+			Assert::ExpectException<std::runtime_error>([&source, &otherPool] { source.SetNodePool(otherPool); });
+
+			SharedList copy(source);
+			Assert::AreEqual(source.Size(), copy.Size());
+			copy.TransferFront(destination);
+			Assert::AreEqual(1_z, destination.Size());
+		}
+
 	private:
+#if defined(DEBUG) || defined(_DEBUG)
+		static int CountAllocations(int allocType, void*, size_t, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC)
+			{
+				++sAllocationCount;
+			}
+
+			return 1;
+		}
+
+		inline static size_t sAllocationCount = 0;
+#endif
+
 		static _CrtMemState sStartMemState;
 	};
 
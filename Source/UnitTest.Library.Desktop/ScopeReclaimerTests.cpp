@@ -0,0 +1,241 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "TypeManager.h"
+#include "Entity.h"
+#include "Sector.h"
+#include "World.h"
+#include "Event.h"
+#include "EventMessageAttributed.h"
+#include "ReactionAttributed.h"
+#include "ScopeReclaimer.h"
+#include "ToStringSpecializations.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ScopeReclaimerTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionList, Action>();
+			AttributeReflection::RegisterType<Reaction, ActionList>();
+			AttributeReflection::RegisterType<ReactionAttributed, Reaction>();
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+			Event<EventMessageAttributed>::UnsubscribeAll();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			ScopeReclaimer reclaimer;
+			Assert::IsTrue(reclaimer.IsEmpty());
+			Assert::AreEqual(0_z, reclaimer.PendingBytes());
+			Assert::IsTrue(ScopeReclaimer::DefaultFrameBudget == reclaimer.FrameBudget());
+
+			reclaimer.SetFrameBudget(ScopeReclaimer::Microseconds(250));
+			Assert::IsTrue(ScopeReclaimer::Microseconds(250) == reclaimer.FrameBudget());
+
+			ScopeReclaimer budgeted(ScopeReclaimer::Microseconds(0));
+			Assert::IsTrue(ScopeReclaimer::Microseconds(0) == budgeted.FrameBudget());
+			Assert::AreEqual(0_z, budgeted.Reclaim());
+			Assert::AreEqual(0_z, budgeted.ReclaimAll());
+		}
+
+		TEST_METHOD(Enqueue)
+		{
+			ScopeReclaimer reclaimer;
+
+			Scope* root = CreateHierarchy(3, 4);
+			size_t footprint = root->Footprint();
+			Assert::IsTrue(footprint >= sizeof(Scope));
+
+			Scope& child = *root->Find("Child")->GetScope();
+			Assert::ExpectException<std::runtime_error>([&reclaimer, &child] { reclaimer.Enqueue(&child); });
+			Assert::IsTrue(reclaimer.IsEmpty());
+
+			// Queuing doesn't walk the hierarchy, Reclaim retires it before destroying any of it
+			reclaimer.Enqueue(root);
+			Assert::IsFalse(reclaimer.IsEmpty());
+			Assert::IsFalse(reclaimer.IsRetired());
+			Assert::AreEqual(0_z, reclaimer.PendingBytes());
+
+			// 1 + 3 + 9 + 27 + 81 Scopes
+			Assert::AreEqual(121_z, reclaimer.ReclaimAll());
+			Assert::IsTrue(reclaimer.IsEmpty());
+			Assert::AreEqual(0_z, reclaimer.PendingBytes());
+
+			Vector<gsl::owner<Scope*>> roots{ CreateHierarchy(2, 1), CreateHierarchy(2, 1) };
+			reclaimer.Enqueue(roots);
+			Assert::AreEqual(6_z, reclaimer.ReclaimAll());
+		}
+
+		TEST_METHOD(FrameBudget)
+		{
+			ScopeReclaimer reclaimer(ScopeReclaimer::Microseconds(0));
+			reclaimer.Enqueue(CreateHierarchy(2, 3));
+
+			// With no budget every call still makes progress, one Scope at a time. Every Scope is retired and counted before the first one is destroyed
+			size_t pendingBytes = reclaimer.PendingBytes();
+			size_t frames = 0;
+			while (!reclaimer.IsRetired())
+			{
+				Assert::AreEqual(0_z, reclaimer.Reclaim());
+				Assert::IsTrue(reclaimer.PendingBytes() > pendingBytes);
+				pendingBytes = reclaimer.PendingBytes();
+				++frames;
+			}
+
+			Assert::AreEqual(15_z, frames);
+			while (!reclaimer.IsEmpty())
+			{
+				Assert::AreEqual(1_z, reclaimer.Reclaim());
+				Assert::IsTrue(reclaimer.PendingBytes() < pendingBytes);
+				pendingBytes = reclaimer.PendingBytes();
+				++frames;
+			}
+
+			Assert::AreEqual(30_z, frames);
+			Assert::AreEqual(0_z, reclaimer.PendingBytes());
+
+			reclaimer.SetFrameBudget(std::chrono::duration_cast<ScopeReclaimer::Microseconds>(std::chrono::seconds(10)));
+			reclaimer.Enqueue(CreateHierarchy(2, 3));
+			Assert::AreEqual(15_z, reclaimer.Reclaim());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			ScopeReclaimer reclaimer(ScopeReclaimer::Microseconds(0));
+			reclaimer.Enqueue(CreateHierarchy(2, 2));
+			reclaimer.Reclaim();
+			Assert::IsFalse(reclaimer.IsRetired());
+
+			// The Scopes left to retire move along with the pending ones
+			ScopeReclaimer retiring(std::move(reclaimer));
+			Assert::IsTrue(reclaimer.IsRetired());
+			while (!retiring.IsRetired())
+			{
+				retiring.Reclaim();
+			}
+			reclaimer = std::move(retiring);
+			size_t pendingBytes = reclaimer.PendingBytes();
+			Assert::IsTrue(pendingBytes > 0);
+
+			ScopeReclaimer copy(reclaimer);
+			Assert::IsTrue(copy.IsEmpty());
+			Assert::IsTrue(reclaimer.FrameBudget() == copy.FrameBudget());
+
+			ScopeReclaimer moved(std::move(reclaimer));
+			Assert::AreEqual(pendingBytes, moved.PendingBytes());
+			Assert::AreEqual(0_z, reclaimer.PendingBytes());
+
+			copy.Enqueue(CreateHierarchy(1, 1));
+			copy = moved;
+			Assert::IsTrue(copy.IsEmpty());
+
+			copy = std::move(moved);
+			Assert::AreEqual(pendingBytes, copy.PendingBytes());
+			Assert::AreEqual(7_z, copy.ReclaimAll());
+
+			// Anything left pending is destroyed along with the reclaimer
+			copy.Enqueue(CreateHierarchy(3, 3));
+		}
+
+		TEST_METHOD(DeferredWorldDelete)
+		{
+			World world;
+			world.GetReclaimer().SetFrameBudget(ScopeReclaimer::Microseconds(0));
+
+			Sector* sector = world.CreateSector("Doomed");
+			for (size_t i = 0; i < 10; ++i)
+			{
+				Entity* entity = new Entity;
+				sector->Adopt(*entity, "Entities");
+			}
+			ReactionAttributed* reaction = new ReactionAttributed("Reaction", "Subtype");
+			sector->Entities().GetScope(0)->Adopt(*reaction, "Reactions");
+			Assert::AreEqual(1_z, Event<EventMessageAttributed>::NumSubscribers());
+
+			world.MarkScopeForDelete(*sector);
+			world.Update();
+
+			// The Sector leaves the world right away but is retired and then destroyed over the following updates
+			Assert::AreEqual(0_z, world.Sectors().Size());
+			Assert::IsFalse(world.GetReclaimer().IsEmpty());
+
+			size_t updates = 1;
+			while (!world.GetReclaimer().IsRetired())
+			{
+				world.Update();
+				++updates;
+			}
+
+			Assert::AreEqual(0_z, Event<EventMessageAttributed>::NumSubscribers());
+			Assert::IsTrue(world.GetReclaimer().PendingBytes() > 0);
+
+			while (!world.GetReclaimer().IsEmpty())
+			{
+				world.Update();
+				++updates;
+			}
+
+			// One Sector, ten Entities and one Reaction, each retired and then destroyed
+			Assert::AreEqual(24_z, updates);
+			Assert::AreEqual(0_z, world.GetReclaimer().PendingBytes());
+
+			world.CreateSector("Pending");
+			world.MarkScopeForDelete(*world.Sectors().GetScope(0));
+			world.Update();
+		}
+
+	private:
+		/// <summary>
+		/// Creates a Scope hierarchy where every Scope above the given depth has the given number of children
+		/// </summary>
+		/// <returns>The heap allocated root of the hierarchy</returns>
+		static gsl::owner<Scope*> CreateHierarchy(size_t children, size_t depth)
+		{
+			Scope* root = new Scope;
+			root->Append("Name") = "Scope"s;
+			if (depth > 0)
+			{
+				for (size_t i = 0; i < children; ++i)
+				{
+					root->Adopt(*CreateHierarchy(children, depth - 1), "Child");
+				}
+			}
+
+			return root;
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ScopeReclaimerTests::sStartMemState;
+}
@@ -132,6 +132,13 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(*foundDatum, scope[1]);
 				Assert::AreEqual(foundScope, &scope);
 			}
+
+			{
+				std::string_view name("Powers");
+				Assert::IsTrue(scopeChild->Search(name) == &scope[1]);
+				Assert::IsTrue(scopeChild->Find(name) == nullptr);
+				Assert::IsTrue(scope.Find("Child"s) == &scope[0]);
+			}
 		}
 
 		TEST_METHOD(FindNestedScope)
@@ -311,7 +318,454 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(scopeChild1->IsDescendantOf(scope));
 		}
 
+		TEST_METHOD(AppendMovedName)
+		{
+			Scope scope;
+			std::string name = "Health";
+			Datum& datum = scope.Append(std::move(name));
+			Assert::IsTrue(&datum == scope.Find("Health"));
+			Assert::IsTrue(&datum == &scope.Append(std::string("Health")));
+			Assert::IsTrue(&datum == &scope["Health"]);
+			Assert::AreEqual(1_z, scope.NumAttributes());
+			Assert::ExpectException<std::runtime_error>([&scope] { scope.Append(std::string()); });
+		}
+
+		TEST_METHOD(InlineAttributes)
+		{
+			Scope scope;
+			Vector<Datum*> addresses;
+			for (size_t i = 0; i < Scope::InlineAttributeCapacity; ++i)
+			{
+				addresses.PushBack(&scope.Append("Attribute" + std::to_string(i)));
+			}
+
+			Assert::IsFalse(scope.IsHashed());
+			Assert::AreEqual(11_z, scope.BucketSize());
+
+			scope.Append("Overflow") = 5;
+			Assert::IsTrue(scope.IsHashed());
+			Assert::AreEqual(Scope::InlineAttributeCapacity + 1, scope.NumAttributes());
+			Assert::IsTrue(*scope.Find("Overflow") == 5);
+			for (size_t i = 0; i < Scope::InlineAttributeCapacity; ++i)
+			{
+				Assert::IsTrue(scope.Find("Attribute" + std::to_string(i)) == addresses[i]);
+				Assert::IsTrue(&scope[i] == addresses[i]);
+			}
+			Assert::IsTrue(scope.Find("Attribute") == nullptr);
+
+			Scope* child = new Scope;
+			scope.Adopt(*child, "Attribute3");
+			Assert::AreEqual(Datum::DatumTypes::Table, scope[3].Type());
+
+			Scope moved(std::move(scope));
+			Assert::IsTrue(moved.IsHashed());
+			Assert::IsFalse(scope.IsHashed());
+			Assert::AreEqual(0_z, scope.NumAttributes());
+			Assert::IsTrue(scope.Find("Attribute0") == nullptr);
+			Assert::IsTrue(moved.Find("Attribute3") == &moved[3]);
+			Assert::AreEqual(&moved, child->GetParent());
+			Assert::IsTrue(*moved.Find("Overflow") == 5);
+
+			Scope copy(moved);
+			Assert::IsTrue(copy == moved);
+			const std::string lastInline = "Attribute" + std::to_string(Scope::InlineAttributeCapacity - 1);
+			Assert::IsTrue(copy.Find(lastInline) == &copy[Scope::InlineAttributeCapacity - 1]);
+		}
+
+		TEST_METHOD(SmallScopeAllocations)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+			sAllocationCount = 0;
+			{
+				Scope scope;
+				scope.Append("A") = 1;
+				scope.Append("B") = 2.0f;
+				scope["C"] = 3;
+			}
+			size_t allocations = sAllocationCount;
+			_CrtSetAllocHook(previousHook);
+
+			// The attributes are stored inline, so a small Scope only allocates the storage of each Datum's value
+			Assert::AreEqual(3_z, allocations);
+#endif
+		}
+
+		TEST_METHOD(SmallScopeFootprint)
+		{
+			// A Scope used to own a HashMap with 11 bucket chains, a node for every attribute and a Vector keeping their order
+			const size_t attributeCount = 3;
+			const size_t hashMapLayout = sizeof(RTTI) + sizeof(Scope*) + sizeof(HashMap<std::string, Datum>) + sizeof(Vector<Scope::PairType*>)
+				+ 11 * sizeof(HashMap<std::string, Datum>::ChainType) + attributeCount * (sizeof(Scope::PairType) + sizeof(void*) + sizeof(Scope::PairType*));
+
+			Scope scope;
+			scope.Append("A") = 1;
+			scope.Append("B") = 2.0f;
+			scope.Append("C") = 3;
+			Assert::IsFalse(scope.IsHashed());
+
+			// The inline attributes replace all of it, even counting the names and values stored on top of the Scope itself
+			Assert::IsTrue(sizeof(Scope) < hashMapLayout);
+			Assert::IsTrue(scope.Footprint() < hashMapLayout);
+		}
+
+		TEST_METHOD(ChildSlots)
+		{
+			Scope scope;
+			Vector<Scope*> children;
+			for (size_t i = 0; i < 5; ++i)
+			{
+				children.PushBack(&scope.AppendScope("Children"));
+			}
+			Scope* adopted = new Scope;
+			scope.Adopt(*adopted, "Children");
+
+			{
+				auto [datum, index] = scope.FindNestedScope(adopted);
+				Assert::IsTrue(datum == scope.Find("Children"));
+				Assert::AreEqual(5_z, index);
+			}
+
+			children[1]->Orphan();
+			delete children[1];
+			Datum& datum = *scope.Find("Children");
+			Assert::AreEqual(5_z, datum.Size());
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				Assert::AreEqual(i, scope.FindNestedScope(datum.GetScope(i)).second);
+			}
+
+			// Swap removal moves the last child into the orphaned slot
+			children[0]->Orphan(false);
+			delete children[0];
+			Assert::AreEqual(4_z, datum.Size());
+			Assert::AreEqual(adopted, datum.GetScope(0));
+			Assert::AreEqual(0_z, scope.FindNestedScope(adopted).second);
+
+			Scope other;
+			other.Adopt(*adopted, "Adopted");
+			Assert::AreEqual(3_z, datum.Size());
+			Assert::IsTrue(scope.FindNestedScope(adopted).first == nullptr);
+			Assert::IsTrue(other.FindNestedScope(adopted).first == other.Find("Adopted"));
+
+			// Moving the parent moves its inline Datums, so the children must learn their new slots
+			Scope moved(std::move(scope));
+			Datum& movedDatum = *moved.Find("Children");
+			for (size_t i = 0; i < movedDatum.Size(); ++i)
+			{
+				auto [found, index] = moved.FindNestedScope(movedDatum.GetScope(i));
+				Assert::IsTrue(found == &movedDatum);
+				Assert::AreEqual(i, index);
+			}
+
+			Scope copy(moved);
+			Datum& copyDatum = *copy.Find("Children");
+			Scope* orphan = copyDatum.GetScope(0);
+			orphan->Orphan(false);
+			delete orphan;
+			Assert::AreEqual(2_z, copyDatum.Size());
+			Assert::AreEqual(0_z, copy.FindNestedScope(copyDatum.GetScope(0)).second);
+			Assert::AreEqual(1_z, copy.FindNestedScope(copyDatum.GetScope(1)).second);
+		}
+
+		TEST_METHOD(PrototypeInstancing)
+		{
+			Scope prototype;
+			prototype.Append("Name") = "A prototype name longer than the small string buffer"s;
+			Datum& tags = prototype.Append("Tags");
+			for (int i = 0; i < 8; ++i)
+			{
+				tags.PushBack("Tag number " + std::to_string(i) + " of the prototype");
+			}
+			Datum& path = prototype.Append("Path");
+			for (int i = 0; i < 16; ++i)
+			{
+				path.PushBack(glm::vec4(static_cast<float>(i)));
+			}
+			prototype.Append("Transform") = glm::mat4(1.0f);
+			Scope& stats = prototype.AppendScope("Stats");
+			stats.Append("Health") = 10;
+
+			// An instance shares the storage of every value with the prototype until it writes to one of them
+			{
+				gsl::owner<Scope*> instance = prototype.Clone();
+				Assert::IsTrue(*instance == prototype);
+				Assert::IsTrue(instance->Find("Name")->IsSharedStorage());
+				Assert::IsTrue(instance->Find("Tags")->IsSharedStorage());
+				Assert::IsTrue(instance->Find("Stats")->GetScope()->Find("Health")->IsSharedStorage());
+				Assert::IsFalse(instance->Find("Stats")->IsSharedStorage());
+
+				instance->Find("Name")->Set("Instance"s, 0);
+				instance->Find("Stats")->GetScope()->Find("Health")->GetInt() = 5;
+				Assert::IsFalse(instance->Find("Name")->IsSharedStorage());
+				Assert::IsTrue(instance->Find("Tags")->IsSharedStorage());
+				Assert::AreEqual("A prototype name longer than the small string buffer"s, prototype.Find("Name")->GetString());
+				Assert::AreEqual(10, stats.Find("Health")->GetInt());
+				delete instance;
+			}
+			Assert::IsFalse(prototype.Find("Tags")->IsSharedStorage());
+
+#if defined(DEBUG) || defined(_DEBUG)
+			// Spawning shared instances allocates less than spawning instances that own every value
+			auto spawn = [&prototype](bool detach)
+			{
+				Vector<gsl::owner<Scope*>> instances;
+				instances.Reserve(10);
+
+				_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+				sAllocatedBytes = 0;
+				for (size_t i = 0; i < 10; ++i)
+				{
+					Scope* instance = prototype.Clone();
+					if (detach)
+					{
+						DetachValues(*instance);
+					}
+					instances.PushBack(instance);
+				}
+				_CrtSetAllocHook(previousHook);
+
+				for (Scope* instance : instances)
+				{
+					delete instance;
+				}
+
+				return sAllocatedBytes;
+			};
+
+			size_t sharedBytes = spawn(false);
+			size_t copiedBytes = spawn(true);
+			Assert::IsTrue(sharedBytes < copiedBytes);
+#endif
+		}
+
+		TEST_METHOD(StructuralHash)
+		{
+			Scope scope;
+			scope.Append("A") = 1;
+			scope.Append("B") = "Hello"s;
+			Scope& child = scope.AppendScope("Child");
+			child.Append("C") = glm::vec4(1.0f);
+
+			Scope copy = scope;
+			Assert::AreEqual(scope.Hash(), copy.Hash());
+
+			// Attribute order doesn't matter for equality, so it doesn't for the hash either
+			Scope reordered;
+			reordered.AppendScope("Child").Append("C") = glm::vec4(1.0f);
+			reordered.Append("B") = "Hello"s;
+			reordered.Append("A") = 1;
+			Assert::IsTrue(reordered == scope);
+			Assert::AreEqual(scope.Hash(), reordered.Hash());
+
+			// Every way of changing a descendant reaches the cached hashes of its ancestors
+			size_t original = scope.Hash();
+			child.Find("C")->Set(glm::vec4(2.0f), 0);
+			Assert::AreNotEqual(original, scope.Hash());
+			Assert::IsFalse(scope == copy);
+			child.Find("C")->Edit<glm::vec4>() = glm::vec4(1.0f);
+			Assert::AreEqual(original, scope.Hash());
+			Assert::IsTrue(scope == copy);
+
+			child.Append("D");
+			Assert::AreNotEqual(original, scope.Hash());
+			Assert::IsFalse(scope == copy);
+			copy.Find("Child")->GetScope()->Append("D");
+			Assert::AreEqual(scope.Hash(), copy.Hash());
+
+			size_t beforeAdopt = scope.Hash();
+			Scope* adopted = new Scope;
+			scope.Adopt(*adopted, "Child");
+			Assert::AreNotEqual(beforeAdopt, scope.Hash());
+			adopted->Orphan();
+			delete adopted;
+			Assert::AreEqual(beforeAdopt, scope.Hash());
+
+			scope.Find("B")->PushBack("World"s);
+			Assert::AreNotEqual(beforeAdopt, scope.Hash());
+			scope.Find("B")->PopBack();
+			Assert::AreEqual(beforeAdopt, scope.Hash());
+
+			Scope moved = std::move(copy);
+			Assert::AreEqual(scope.Hash(), moved.Hash());
+			moved.Find("A")->Set(5, 0);
+			Assert::AreNotEqual(scope.Hash(), moved.Hash());
+
+			scope.Clear();
+			Assert::AreEqual(Scope().Hash(), scope.Hash());
+
+			// A write through a getter leaves the cached hash stale, but equality still compares the attributes
+			Scope lhs;
+			Scope rhs;
+			lhs["X"] = 1;
+			rhs["X"] = 2;
+			Assert::IsFalse(lhs == rhs);
+			Assert::AreNotEqual(lhs.Hash(), rhs.Hash());
+			lhs["X"].GetInt() = 2;
+			Assert::IsTrue(lhs == rhs);
+			lhs.MarkModified("X");
+			Assert::AreEqual(lhs.Hash(), rhs.Hash());
+		}
+
+		TEST_METHOD(Diff)
+		{
+			Scope lhs;
+			lhs.Append("Name") = "World"s;
+			for (int i = 0; i < 3; ++i)
+			{
+				Scope& entity = lhs.AppendScope("Entities");
+				entity.Append("Health") = i;
+				entity.AppendScope("Stats").Append("Speed") = 1.0f;
+			}
+			Scope rhs = lhs;
+			Assert::AreEqual(0_z, Scope::Diff(lhs, rhs).Size());
+
+			rhs.Find("Entities")->GetScope(1)->Find("Health")->Set(10, 0);
+			rhs.Find("Entities")->GetScope(2)->Find("Stats")->GetScope()->Find("Speed")->Set(2.0f, 0);
+			rhs.AppendScope("Entities");
+			rhs.Append("Time") = 1;
+			lhs.Append("Paused") = 0;
+
+			Vector<std::string> differences = Scope::Diff(lhs, rhs);
+			Assert::AreEqual(5_z, differences.Size());
+			Assert::AreEqual("Entities[1].Health"s, differences[0]);
+			Assert::AreEqual("Entities[2].Stats[0].Speed"s, differences[1]);
+			Assert::AreEqual("Entities[3]"s, differences[2]);
+			Assert::AreEqual("Paused"s, differences[3]);
+			Assert::AreEqual("Time"s, differences[4]);
+
+			// Pointers are compared through their targets, which can change without the Scopes holding them being marked
+			Scope first;
+			first.Append("Value") = 1;
+			Scope second = first;
+			Scope lhsHolder;
+			lhsHolder.AppendScope("Child").Append("Target") = &first;
+			Scope rhsHolder;
+			rhsHolder.AppendScope("Child").Append("Target") = &second;
+			Assert::IsTrue(lhsHolder == rhsHolder);
+			Assert::AreEqual(0_z, Scope::Diff(lhsHolder, rhsHolder).Size());
+
+			second.Find("Value")->Set(2, 0);
+			Assert::IsFalse(lhsHolder == rhsHolder);
+			differences = Scope::Diff(lhsHolder, rhsHolder);
+			Assert::AreEqual(1_z, differences.Size());
+			Assert::AreEqual("Child[0].Target"s, differences[0]);
+			second.Find("Value")->Set(1, 0);
+			Assert::IsTrue(lhsHolder == rhsHolder);
+
+			// A Pointer back to an ancestor is hashed without following it
+			lhsHolder.Find("Child")->GetScope()->Append("Root") = &lhsHolder;
+			Scope copy = lhsHolder;
+			Assert::AreEqual(lhsHolder.Hash(), copy.Hash());
+			Assert::IsTrue(lhsHolder == copy);
+		}
+
+		TEST_METHOD(ChangeTracking)
+		{
+			Scope root;
+			root.Append("Health") = 100;
+			Scope& first = root.AppendScope("Children");
+			first.Append("Position") = glm::vec4(0.0f);
+			Scope& second = root.AppendScope("Children");
+			second.Append("Position") = glm::vec4(0.0f);
+			Scope& grandchild = second.AppendScope("Children");
+			grandchild.Append("Position") = glm::vec4(0.0f);
+
+			size_t since = Scope::AdvanceChangeFrame();
+			Vector<Scope*> visited;
+			auto collect = [&visited](Scope& scope) { visited.PushBack(&scope); };
+
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(0_z, visited.Size());
+
+			grandchild.Find("Position")->Set(glm::vec4(1.0f), 0);
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(1_z, visited.Size());
+			Assert::IsTrue(visited[0] == &grandchild);
+
+			// A Scope whose own attributes changed is visited before its changed descendants
+			visited.Clear();
+			second.Append("Velocity");
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(2_z, visited.Size());
+			Assert::IsTrue(visited[0] == &second);
+			Assert::IsTrue(visited[1] == &grandchild);
+
+			Vector<std::string> attributes;
+			root.ForEachChangedAttribute(since, [&attributes](Scope&, Scope::PairType& pair) { attributes.PushBack(pair.first); });
+			Assert::AreEqual(2_z, attributes.Size());
+			Assert::AreEqual("Velocity"s, attributes[0]);
+			Assert::AreEqual("Position"s, attributes[1]);
+
+			// Earlier changes are still found by asking from an earlier frame
+			since = Scope::AdvanceChangeFrame();
+			visited.Clear();
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(0_z, visited.Size());
+			first.Find("Position")->Edit<glm::vec4>() = glm::vec4(2.0f);
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(1_z, visited.Size());
+			Assert::IsTrue(visited[0] == &first);
+			visited.Clear();
+			root.ForEachChangedScope(since - 1, collect);
+			Assert::AreEqual(3_z, visited.Size());
+
+			// Writes through a getter are not tracked
+			since = Scope::AdvanceChangeFrame();
+			visited.Clear();
+			first.Find("Position")->GetVector() = glm::vec4(3.0f);
+			root.ForEachChangedScope(since, collect);
+			Assert::AreEqual(0_z, visited.Size());
+
+			// Writes that bypass a Datum are reported by name
+			since = Scope::AdvanceChangeFrame();
+			root.MarkModified("Health");
+			attributes.Clear();
+			root.ForEachChangedAttribute(since, [&attributes](Scope&, Scope::PairType& pair) { attributes.PushBack(pair.first); });
+			Assert::AreEqual(1_z, attributes.Size());
+			Assert::AreEqual("Health"s, attributes[0]);
+			Assert::ExpectException<std::runtime_error>([&root]() { root.MarkModified("Missing"); });
+		}
+
 	private:
+		/// <summary>
+		/// Gives every value Datum of the Scope and its descendants its own storage, as if each of them had been written to
+		/// </summary>
+		static void DetachValues(Scope& scope)
+		{
+			for (size_t i = 0; i < scope.NumAttributes(); ++i)
+			{
+				Datum& datum = scope[i];
+				if (datum.Type() == Datum::DatumTypes::Table)
+				{
+					for (size_t j = 0; j < datum.Size(); ++j)
+					{
+						DetachValues(*datum.GetScope(j));
+					}
+				}
+				else if (datum.Type() != Datum::DatumTypes::Unknown && !datum.IsExternalStorage())
+				{
+					datum.Resize(datum.Size());
+				}
+			}
+		}
+
+#if defined(DEBUG) || defined(_DEBUG)
+		static int CountAllocations(int allocType, void*, size_t size, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC)
+			{
+				++sAllocationCount;
+				sAllocatedBytes += size;
+			}
+
+			return 1;
+		}
+#endif
+
+		inline static size_t sAllocationCount = 0;
+		inline static size_t sAllocatedBytes = 0;
+
 		static _CrtMemState sStartMemState;
 	};
 
@@ -27,9 +27,9 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
-			TypeManager::RegisterType(Entity::TypeIdClass(), Attributed::TypeIdClass(), Entity::GetSignatures());
-			TypeManager::RegisterType(Sector::TypeIdClass(), Attributed::TypeIdClass(), Sector::GetSignatures());
-			TypeManager::RegisterType(World::TypeIdClass(), Attributed::TypeIdClass(), World::GetSignatures());
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
 			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
 		}
 
@@ -147,6 +147,38 @@ namespace UnitTestLibraryDesktop
 		}
 
 
+		TEST_METHOD(CreateEntities)
+		{
+			EntityFactory entityFactory;
+			AvatarFactory avatarFactory;
+
+			WorldState testState;
+			Sector sector;
+			Assert::ExpectException<std::runtime_error>([&sector] { sector.CreateEntities("AttributedFoo", 3); });
+
+			Entity* named = sector.CreateEntity("Avatar", "Paul");
+			Vector<Entity*> avatars = sector.CreateEntities("Avatar", 10);
+			Assert::AreEqual(10_z, avatars.Size());
+			Assert::AreEqual(11_z, sector.Entities().Size());
+			for (Entity* entity : avatars)
+			{
+				Assert::IsTrue(entity->Is(Avatar::TypeIdClass()));
+				Assert::AreEqual(entity->GetSector(), &sector);
+				Assert::AreEqual(entity->Find("Health")->GetInt(), 100);
+			}
+
+			// Entities of a batch are deleted one at a time like any other
+			avatars[3]->Orphan();
+			delete avatars[3];
+			named->Orphan();
+			delete named;
+			Assert::AreEqual(9_z, sector.Entities().Size());
+
+			sector.Update(testState);
+			Assert::AreEqual(static_cast<Avatar*>(avatars[0])->mUpdateCount, 1_z);
+			Assert::AreEqual(0_z, sector.CreateEntities("Avatar", 0).Size());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -0,0 +1,179 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "SmallVector.h"
+#include "Scope.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace UnitTests;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Iterator)
+		{
+			Foo a(10);
+			Foo b(20);
+			SmallVector<Foo, 2> vector = { a, b, a, b };
+
+			for (auto it = vector.begin(); it != vector.end(); ++it)
+			{
+				Assert::AreEqual(*it, a);
+				Assert::AreEqual(*(it++), a);
+				Assert::AreEqual(*it, b);
+			}
+
+			auto it = vector.end();
+			--it;
+			Assert::AreEqual(*(it--), b);
+			Assert::AreEqual(*it, a);
+			Assert::ExpectException<std::runtime_error>([&vector] { ++vector.end(); });
+			Assert::ExpectException<std::runtime_error>([&vector] { --vector.begin(); });
+
+			const SmallVector<Foo, 2>& constVector = vector;
+			size_t count = 0;
+			for (const Foo& foo : constVector)
+			{
+				Assert::AreEqual(foo, count % 2 == 0 ? a : b);
+				++count;
+			}
+			Assert::AreEqual(4_z, count);
+		}
+
+		TEST_METHOD(InlineStorage)
+		{
+			Foo a(10);
+			SmallVector<Foo, 4> vector;
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(4_z, vector.Capacity());
+			Assert::ExpectException<std::runtime_error>([&vector] { vector.Front(); });
+			Assert::ExpectException<std::runtime_error>([&vector] { vector.Back(); });
+			Assert::ExpectException<std::runtime_error>([&vector] { vector[0]; });
+
+			for (int i = 0; i < 4; ++i)
+			{
+				vector.EmplaceBack(i);
+			}
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(4_z, vector.Capacity());
+
+			vector.PushBack(a);
+			Assert::IsFalse(vector.IsInline());
+			Assert::IsTrue(vector.Capacity() > 4_z);
+			for (int i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(Foo(i), vector.At(i));
+			}
+			Assert::AreEqual(a, vector.Back());
+
+			SmallVector<Foo, 4> reserved(10);
+			Assert::IsFalse(reserved.IsInline());
+			Assert::AreEqual(10_z, reserved.Capacity());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			SmallVector<Foo, 2> small = { Foo(1), Foo(2) };
+			SmallVector<Foo, 2> large = { Foo(1), Foo(2), Foo(3), Foo(4) };
+
+			SmallVector<Foo, 2> smallCopy(small);
+			Assert::IsTrue(smallCopy.IsInline());
+			Assert::AreEqual(Foo(2), smallCopy.Back());
+
+			SmallVector<Foo, 2> largeCopy;
+			largeCopy = large;
+			Assert::AreEqual(4_z, largeCopy.Size());
+			Assert::AreEqual(Foo(4), largeCopy.Back());
+
+			SmallVector<Foo, 2> smallMoved(std::move(small));
+			Assert::IsTrue(smallMoved.IsInline());
+			Assert::AreEqual(2_z, smallMoved.Size());
+			Assert::IsTrue(small.IsEmpty());
+
+			SmallVector<Foo, 2> largeMoved(std::move(large));
+			Assert::IsFalse(largeMoved.IsInline());
+			Assert::AreEqual(4_z, largeMoved.Size());
+			Assert::IsTrue(large.IsEmpty());
+			Assert::IsTrue(large.IsInline());
+			Assert::AreEqual(2_z, large.Capacity());
+
+			largeMoved = std::move(smallMoved);
+			Assert::IsTrue(largeMoved.IsInline());
+			Assert::AreEqual(Foo(1), largeMoved.Front());
+		}
+
+		TEST_METHOD(RemoveAndShrink)
+		{
+			SmallVector<Foo, 2> vector = { Foo(1), Foo(2), Foo(3), Foo(4), Foo(5) };
+			Assert::IsTrue(vector.Remove(Foo(2)));
+			Assert::IsFalse(vector.Remove(Foo(10)));
+			Assert::AreEqual(Foo(3), vector[1]);
+
+			Assert::IsTrue(vector.Remove(vector.Find(Foo(3)), vector.Find(Foo(5))));
+			Assert::AreEqual(2_z, vector.Size());
+			Assert::AreEqual(Foo(5), vector.Back());
+
+			SmallVector<Foo, 2> other;
+			Assert::ExpectException<std::runtime_error>([&vector, &other] { vector.Remove(other.begin()); });
+
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(2_z, vector.Capacity());
+			Assert::AreEqual(Foo(1), vector.Front());
+
+			vector.Resize(6);
+			Assert::IsFalse(vector.IsInline());
+			vector.Resize(1);
+			vector.PopBack();
+			Assert::IsTrue(vector.IsEmpty());
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+		}
+
+		TEST_METHOD(SmallScopesStayInline)
+		{
+			Scope scope;
+			scope.Append("A");
+			scope.Append("B");
+			scope.AppendScope("C");
+			Assert::IsTrue(scope.GetOrderVector().IsInline());
+
+			for (size_t i = 0; i < Scope::OrderVectorType::InlineCapacity; ++i)
+			{
+				scope.Append(std::to_string(i));
+			}
+			Assert::IsFalse(scope.GetOrderVector().IsInline());
+			Assert::AreEqual(Scope::OrderVectorType::InlineCapacity + 3, scope.NumAttributes());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState SmallVectorTests::sStartMemState;
+}
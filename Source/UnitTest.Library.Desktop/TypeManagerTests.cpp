@@ -3,6 +3,9 @@
 #include "AttributedFoo.h"
 #include "AttributedBar.h"
 #include "TypeManager.h"
+#include "AttributeReflection.h"
+#include "ActionIncrement.h"
+#include "Entity.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -58,6 +61,57 @@ namespace UnitTestLibraryDesktop
 			TypeManager::UnregisterType(AttributedBar::TypeIdClass());
 		}
 
+		TEST_METHOD(Reflection)
+		{
+			constexpr size_t stepHash = AttributeNameHash("Step");
+			Assert::AreEqual(DefaultHash<std::string_view>()("Step"), stepHash);
+			static_assert(DatumTypeOf<float[6]>::Type == Datum::DatumTypes::Float && DatumTypeOf<float[6]>::Size == 6);
+			static_assert(ActionIncrement::PrescribedAttributes().size() == 2);
+
+			Vector<Signature> signatures = ActionIncrement::GetSignatures();
+			Assert::AreEqual(2_z, signatures.Size());
+			Assert::AreEqual("Target"s, signatures[0].Name);
+			Assert::IsTrue(signatures[0].Type == Datum::DatumTypes::String);
+			Assert::AreEqual("Step"s, signatures[1].Name);
+			Assert::IsTrue(signatures[1].Type == Datum::DatumTypes::Integer);
+			Assert::IsTrue(signatures[1].IsExternal);
+			Assert::AreEqual(1_z, signatures[1].Size);
+
+			signatures = Entity::GetSignatures();
+			Assert::AreEqual("Actions"s, signatures[1].Name);
+			Assert::IsTrue(signatures[1].Type == Datum::DatumTypes::Table);
+			Assert::IsFalse(signatures[1].IsExternal);
+
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
+			Assert::IsTrue(TypeManager::GetPopulateFunction(ActionIncrement::TypeIdClass()) != nullptr);
+			ActionIncrement reflected("Increment");
+			TypeManager::Clear();
+
+			// Registered from the signatures alone, instances are populated by walking them
+			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
+			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
+			Assert::IsTrue(TypeManager::GetPopulateFunction(ActionIncrement::TypeIdClass()) == nullptr);
+			ActionIncrement walked("Increment");
+
+			Assert::IsTrue(reflected == walked);
+			const Scope::OrderVectorType& reflectedAttributes = reflected.GetAttributes();
+			const Scope::OrderVectorType& walkedAttributes = walked.GetAttributes();
+			Assert::AreEqual(walkedAttributes.Size(), reflectedAttributes.Size());
+			for (size_t i = 0; i < walkedAttributes.Size(); ++i)
+			{
+				Assert::AreEqual(walkedAttributes[i]->first, reflectedAttributes[i]->first);
+				Assert::IsTrue(walkedAttributes[i]->second.Type() == reflectedAttributes[i]->second.Type());
+				Assert::AreEqual(walkedAttributes[i]->second.IsExternalStorage(), reflectedAttributes[i]->second.IsExternalStorage());
+			}
+
+			// The external attributes are bound to the members of the instance
+			Assert::AreEqual("Increment"s, reflected.Find("Name")->GetString());
+			Assert::AreEqual(1, reflected.Find("Step")->GetInt());
+
+			TypeManager::Clear();
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
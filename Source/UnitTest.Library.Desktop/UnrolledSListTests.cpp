@@ -0,0 +1,174 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "UnrolledSList.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace UnitTests;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(UnrolledSListTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			UnrolledSList<Foo, 3> list;
+			Assert::IsTrue(list.IsEmpty());
+			Assert::ExpectException<std::runtime_error>([&list] { list.Front(); });
+			Assert::ExpectException<std::runtime_error>([&list] { list.Back(); });
+
+			for (int i = 0; i < 5; ++i)
+			{
+				list.PushBack(Foo(i));
+			}
+			list.PushFront(Foo(-1));
+			list.EmplaceFront(-2);
+			list.EmplaceBack(5);
+			Assert::AreEqual(8_z, list.Size());
+			Assert::AreEqual(Foo(-2), list.Front());
+			Assert::AreEqual(Foo(5), list.Back());
+
+			int expected = -2;
+			for (const Foo& foo : list)
+			{
+				Assert::AreEqual(Foo(expected++), foo);
+			}
+
+			list.PopFront();
+			list.PopBack();
+			Assert::AreEqual(Foo(-1), list.Front());
+			Assert::AreEqual(Foo(4), list.Back());
+			Assert::AreEqual(6_z, list.Size());
+
+			while (!list.IsEmpty())
+			{
+				list.PopBack();
+			}
+			Assert::AreEqual(0_z, list.Size());
+			Assert::IsTrue(list.begin() == list.end());
+		}
+
+		TEST_METHOD(InsertAfterSplitsFullNodes)
+		{
+			UnrolledSList<Foo, 2> list;
+			list.PushBack(Foo(1));
+			list.PushBack(Foo(3));
+			list.PushBack(Foo(4));
+
+			auto it = list.InsertAfter(Foo(2), list.begin());
+			Assert::AreEqual(Foo(2), *it);
+			list.InsertAfter(Foo(5), list.Find(Foo(4)));
+			list.InsertAfter(Foo(0), list.end());
+			Assert::AreEqual(6_z, list.Size());
+			Assert::AreEqual(Foo(0), list.Back());
+
+			int expected = 1;
+			for (auto listIt = list.begin(); listIt != list.end(); ++listIt)
+			{
+				if (expected == 6)
+				{
+					Assert::AreEqual(Foo(0), *listIt);
+					break;
+				}
+				Assert::AreEqual(Foo(expected++), *listIt);
+			}
+
+			UnrolledSList<Foo, 2> other;
+			Assert::ExpectException<std::runtime_error>([&list, &other] { list.InsertAfter(Foo(1), other.begin()); });
+			Assert::ExpectException<std::runtime_error>([&list] { ++list.end(); });
+			Assert::ExpectException<std::runtime_error>([&list] { *list.end(); });
+		}
+
+		TEST_METHOD(FindAndRemove)
+		{
+			UnrolledSList<Foo, 4> list;
+			for (int i = 0; i < 10; ++i)
+			{
+				list.PushBack(Foo(i));
+			}
+
+			Assert::AreEqual(Foo(7), *list.Find(Foo(7)));
+			Assert::IsTrue(list.Find(Foo(20)) == list.end());
+			const UnrolledSList<Foo, 4>& constList = list;
+			Assert::AreEqual(Foo(3), *constList.Find(Foo(3)));
+			Assert::IsTrue(constList.Find(Foo(20)) == constList.end());
+
+			Assert::IsTrue(list.Remove(Foo(0)));
+			Assert::IsTrue(list.Remove(Foo(5)));
+			Assert::IsTrue(list.Remove(list.Find(Foo(9))));
+			Assert::IsFalse(list.Remove(Foo(20)));
+			Assert::IsFalse(list.Remove(list.end()));
+			Assert::AreEqual(7_z, list.Size());
+			Assert::AreEqual(Foo(1), list.Front());
+			Assert::AreEqual(Foo(8), list.Back());
+
+			UnrolledSList<Foo, 4> other;
+			Assert::ExpectException<std::runtime_error>([&list, &other] { list.Remove(other.begin()); });
+
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			list.PushBack(Foo(1));
+			Assert::AreEqual(Foo(1), list.Front());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			UnrolledSList<Foo, 3> list;
+			for (int i = 0; i < 7; ++i)
+			{
+				list.PushBack(Foo(i));
+			}
+
+			UnrolledSList<Foo, 3> copy(list);
+			Assert::AreEqual(list.Size(), copy.Size());
+			auto copyIt = copy.cbegin();
+			for (const Foo& foo : list)
+			{
+				Assert::AreEqual(foo, *copyIt++);
+			}
+
+			UnrolledSList<Foo, 3> assigned;
+			assigned.PushBack(Foo(100));
+			assigned = list;
+			Assert::AreEqual(7_z, assigned.Size());
+			Assert::AreEqual(Foo(6), assigned.Back());
+
+			UnrolledSList<Foo, 3> moved(std::move(copy));
+			Assert::AreEqual(7_z, moved.Size());
+			Assert::IsTrue(copy.IsEmpty());
+
+			assigned = std::move(moved);
+			Assert::AreEqual(Foo(0), assigned.Front());
+			Assert::IsTrue(moved.IsEmpty());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState UnrolledSListTests::sStartMemState;
+}
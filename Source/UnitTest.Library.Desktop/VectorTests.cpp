@@ -2,7 +2,11 @@
 #include "CppUnitTest.h"
 #include "Foo.h"
 #include "Vector.h"
+#include "Stack.h"
+#include "ParallelAlgorithms.h"
 #include "ToStringSpecializations.h"
+#include <random>
+#include <glm/glm.hpp>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -451,6 +455,139 @@ namespace UnitTestLibraryDesktop
 
 #pragma endregion
 
+		TEST_METHOD(EmplaceBack)
+		{
+			Vector<Foo> vector;
+			auto it = vector.EmplaceBack(10);
+			Assert::AreEqual(Foo(10), *it);
+			vector.EmplaceBack(20);
+			Assert::AreEqual(2_z, vector.Size());
+			Assert::AreEqual(Foo(20), vector.Back());
+
+			Stack<Foo> stack;
+			stack.Emplace(30);
+			Assert::AreEqual(Foo(30), stack.Peek());
+		}
+
+		TEST_METHOD(RelocationSafeGrowth)
+		{
+			const std::string longString = "This string is too long to fit in the small string buffer";
+			Vector<std::string> vector;
+			for (size_t i = 0; i < 100; ++i)
+			{
+				vector.PushBack(longString + std::to_string(i));
+			}
+
+			for (size_t i = 0; i < vector.Size(); ++i)
+			{
+				Assert::AreEqual(longString + std::to_string(i), vector[i]);
+			}
+
+			Assert::IsTrue(vector.Remove(vector.Find(longString + "10")));
+			Assert::AreEqual(longString + "11", vector[10]);
+			Assert::IsTrue(vector.Remove(vector.begin(), vector.Find(longString + "5")));
+			Assert::AreEqual(longString + "5", vector.Front());
+			Assert::AreEqual(94_z, vector.Size());
+
+			vector.ShrinkToFit();
+			Assert::AreEqual(vector.Size(), vector.Capacity());
+			Assert::AreEqual(longString + "99", vector.Back());
+
+			static_assert(IsTriviallyRelocatableV<int>);
+			static_assert(IsTriviallyRelocatableV<glm::mat4>);
+			static_assert(!IsTriviallyRelocatableV<std::string>);
+		}
+
+		TEST_METHOD(ReserveStrategyPolicy)
+		{
+			struct DoubleReserveStrategy
+			{
+				size_t operator()(const size_t, const size_t capacity) const
+				{
+					return capacity * 2;
+				}
+			};
+
+			Vector<int, DoubleReserveStrategy> vector(4);
+			for (int i = 0; i < 5; ++i)
+			{
+				vector.PushBack(i);
+			}
+
+			Assert::AreEqual(8_z, vector.Capacity());
+		}
+
+		TEST_METHOD(RandomAccessIterators)
+		{
+			Vector<int> vector = { 5, 3, 1, 4, 2 };
+			auto it = vector.begin();
+			Assert::AreEqual(4, it[3]);
+			Assert::AreEqual(2, *(it + 4));
+			Assert::AreEqual(2, *(4 + it));
+			Assert::AreEqual(5, *((it + 4) - 4));
+			Assert::AreEqual(5, static_cast<int>(vector.end() - vector.begin()));
+			Assert::IsTrue(it < it + 1);
+			Assert::IsTrue(it + 1 > it);
+			Assert::IsTrue(it <= it);
+			Assert::IsTrue(it >= it);
+			Assert::ExpectException<std::runtime_error>([&it] { it -= 1; });
+			Assert::ExpectException<std::runtime_error>([&it] { it += 6; });
+
+			Vector<int> other;
+			Assert::ExpectException<std::runtime_error>([&vector, &other] { vector.begin() - other.begin(); });
+
+			std::sort(vector.begin(), vector.end());
+			for (int i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(i + 1, vector[i]);
+			}
+
+			const Vector<int>& constVector = vector;
+			auto constIt = constVector.begin();
+			constIt += 2;
+			Assert::AreEqual(3, *constIt);
+			Assert::AreEqual(2, static_cast<int>(constIt - constVector.begin()));
+			Assert::IsTrue(std::is_sorted(constVector.begin(), constVector.end()));
+
+			Vector<std::string> strings = { "c", "a", "b" };
+			Assert::AreEqual(1_z, strings.begin()->size());
+			std::nth_element(strings.begin(), strings.begin() + 1, strings.end());
+			Assert::AreEqual(std::string("b"), strings[1]);
+		}
+
+		TEST_METHOD(ParallelAlgorithms)
+		{
+			const size_t count = 200000;
+			Vector<int> serial(count);
+			std::mt19937 generator(0);
+			for (size_t i = 0; i < count; ++i)
+			{
+				serial.PushBack(static_cast<int>(generator() % count));
+			}
+			Vector<int> parallel = serial;
+
+			std::sort(serial.begin(), serial.end());
+			ParallelSort(parallel.begin(), parallel.end());
+			for (size_t i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(serial[i], parallel[i]);
+			}
+
+			std::transform(serial.begin(), serial.end(), serial.begin(), [](int value) { return value * 2; });
+			ParallelTransform(parallel.begin(), parallel.end(), parallel.begin(), [](int value) { return value * 2; });
+			for (size_t i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(serial[i], parallel[i]);
+			}
+
+			auto isSmall = [count](int value) { return static_cast<size_t>(value) < count; };
+			auto serialIt = std::partition(serial.begin(), serial.end(), isSmall);
+			auto parallelIt = ParallelPartition(parallel.begin(), parallel.end(), isSmall);
+			Assert::AreEqual(serialIt - serial.begin(), parallelIt - parallel.begin());
+			Assert::IsTrue(std::all_of(parallel.begin(), parallelIt, isSmall));
+			Assert::IsTrue(std::none_of(parallelIt, parallel.end(), isSmall));
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -28,12 +28,12 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
-			TypeManager::RegisterType(Entity::TypeIdClass(), Attributed::TypeIdClass(), Entity::GetSignatures());
-			TypeManager::RegisterType(Sector::TypeIdClass(), Attributed::TypeIdClass(), Sector::GetSignatures());
-			TypeManager::RegisterType(World::TypeIdClass(), Attributed::TypeIdClass(), World::GetSignatures());
+			AttributeReflection::RegisterType<Entity, Attributed>();
+			AttributeReflection::RegisterType<Sector, Attributed>();
+			AttributeReflection::RegisterType<World, Attributed>();
 			TypeManager::RegisterType(Avatar::TypeIdClass(), Entity::TypeIdClass(), Avatar::GetSignatures());
-			TypeManager::RegisterType(Action::TypeIdClass(), Attributed::TypeIdClass(), Action::GetSignatures());
-			TypeManager::RegisterType(ActionIncrement::TypeIdClass(), Action::TypeIdClass(), ActionIncrement::GetSignatures());
+			AttributeReflection::RegisterType<Action, Attributed>();
+			AttributeReflection::RegisterType<ActionIncrement, Action>();
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -183,6 +183,87 @@ namespace UnitTestLibraryDesktop
 		}
 
 
+		TEST_METHOD(UpdateChangeTracking)
+		{
+			World world;
+			Sector* sector = world.CreateSector("Sector");
+			Vector<ActionIncrement*> actions;
+			for (size_t i = 0; i < 100; ++i)
+			{
+				Entity* entity = new Entity;
+				entity->Append("Count") = 0;
+				sector->Adopt(*entity, "Entities");
+
+				ActionIncrement* action = new ActionIncrement("Increment");
+				action->Find("Target")->Set("Missing"s, 0);
+				entity->Adopt(*action, "Actions");
+				actions.PushBack(action);
+			}
+
+			Vector<Scope*> visited;
+			auto collect = [&visited](Scope& scope) { visited.PushBack(&scope); };
+			size_t changedAttributes = 0;
+			auto count = [&changedAttributes](Scope&, Scope::PairType&) { ++changedAttributes; };
+
+			// Walking the world and every action reading its arguments is not a change
+			world.Update();
+			world.ForEachChangedScope(Scope::ChangeFrame(), collect);
+			world.ForEachChangedAttribute(Scope::ChangeFrame(), count);
+			Assert::AreEqual(0_z, visited.Size());
+			Assert::AreEqual(0_z, changedAttributes);
+
+			// Only the entities whose action wrote to them changed
+			for (size_t i = 0; i < actions.Size(); i += 2)
+			{
+				actions[i]->Find("Target")->Set("Count"s, 0);
+			}
+			world.Update();
+			world.ForEachChangedScope(Scope::ChangeFrame(), collect);
+			world.ForEachChangedAttribute(Scope::ChangeFrame(), count);
+			Assert::AreEqual(50_z, visited.Size());
+			Assert::AreEqual(50_z, changedAttributes);
+			for (Scope* scope : visited)
+			{
+				Assert::IsTrue(scope->Is(Entity::TypeIdClass()));
+				Assert::AreEqual(1, scope->Find("Count")->GetInt());
+			}
+		}
+
+		TEST_METHOD(BatchedDelete)
+		{
+			World world;
+			Sector* sector = world.CreateSector("Sector");
+			Vector<Entity*> entities;
+			for (size_t i = 0; i < 8; ++i)
+			{
+				Entity* entity = new Entity;
+				entity->SetName("Entity" + std::to_string(i));
+				sector->Adopt(*entity, "Entities");
+				entities.PushBack(entity);
+			}
+			Scope& survivingChild = entities[5]->AppendScope("Child");
+			Scope& deletedChild = entities[4]->AppendScope("Child");
+
+			// A Scope marked twice, or marked along with its parent, must still only be deleted once
+			world.MarkScopeForDelete(*entities[0]);
+			world.MarkScopeForDelete(deletedChild);
+			world.MarkScopeForDelete(*entities[4]);
+			world.MarkScopeForDelete(*entities[2]);
+			world.MarkScopeForDelete(*entities[4]);
+			world.MarkScopeForDelete(survivingChild);
+			world.Update();
+
+			Datum& remaining = sector->Entities();
+			Assert::AreEqual(5_z, remaining.Size());
+			const size_t expected[] = { 1, 3, 5, 6, 7 };
+			for (size_t i = 0; i < remaining.Size(); ++i)
+			{
+				Assert::AreEqual(entities[expected[i]], remaining.GetScope(i)->As<Entity>());
+				Assert::AreEqual(i, sector->FindNestedScope(remaining.GetScope(i)).second);
+			}
+			Assert::AreEqual(0_z, entities[5]->Find("Child")->Size());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};